@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdlib>
+#include <new>
+
+/* Sostituisce operator new/delete globali per contare le allocazioni del programma.
+   Va incluso da un solo file per eseguibile (ogni benchmark è un unico file). */
+
+static unsigned long	g_allocations = 0;
+
+#if __cplusplus >= 201103L
+# define BENCH_THROW_BAD_ALLOC
+# define BENCH_NOTHROW			noexcept
+#else
+# define BENCH_THROW_BAD_ALLOC	throw(std::bad_alloc)
+# define BENCH_NOTHROW			throw()
+#endif
+
+__attribute__((noinline)) void*	operator new(std::size_t size) BENCH_THROW_BAD_ALLOC
+{
+	void*	p;
+
+	g_allocations++;
+	p = std::malloc(size ? size : 1);
+	if (!p)
+		throw std::bad_alloc();
+	return (p);
+}
+
+/* noinline qui e su operator new: se le inlinea, g++ vede free() su memoria di 'new' e segnala un falso mismatch */
+__attribute__((noinline)) void	operator delete(void* p) BENCH_NOTHROW
+{
+	std::free(p);
+}
+
+#if __cplusplus >= 201402L
+__attribute__((noinline)) void	operator delete(void* p, std::size_t) BENCH_NOTHROW
+{
+	::operator delete(p);
+}
+#endif
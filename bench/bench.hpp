@@ -0,0 +1,41 @@
+#pragma once
+
+#include <time.h>
+#include <cstdlib>
+#include <cstdio>
+
+/* Piccole utility condivise dai benchmark: cronometro in nanosecondi,
+   generatore pseudo-casuale deterministico e una variabile 'sink' per
+   impedire al compilatore di eliminare il lavoro misurato. */
+namespace bench
+{
+	static volatile unsigned long	sink;
+
+	/* clock monotono al nanosecondo: la suite misura anche operazioni su 100 elementi */
+	inline double	now_ns()
+	{
+		struct timespec	ts;
+
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return (ts.tv_sec * 1e9 + ts.tv_nsec);
+	}
+
+	/* xorshift: stessa sequenza ad ogni esecuzione, indipendente da rand() */
+	inline unsigned long	next_rand()
+	{
+		static unsigned long	state = 88172645463325252UL;
+
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return (state);
+	}
+
+	/* Dimensione massima opzionale passata da riga di comando (es. ./bench/bounds 1000000) */
+	inline long	max_size_arg(int ac, char **av, long def)
+	{
+		if (ac > 1)
+			return (std::atol(av[1]));
+		return (def);
+	}
+}
@@ -0,0 +1,90 @@
+#include "bench.hpp"
+#include "../map.hpp"
+#include "../set.hpp"
+#include <map>
+#include <vector>
+#include <algorithm>
+
+/* Scaling di lower_bound / upper_bound / equal_range da 1K a 10M chiavi.
+   Le chiavi inserite sono pari, le query sono casuali in [0, 2N): metà cadono
+   tra due chiavi, metà su una chiave esistente. Con le discese radice-foglia
+   il costo per operazione deve crescere come log(n), non come n. */
+
+static const long	QUERIES = 200000;
+
+template <class Map>
+static void	fill(Map & m, std::vector<int> const & keys)
+{
+	for (size_t i = 0; i < keys.size(); i++)
+		m.insert(typename Map::value_type(keys[i], i));
+}
+
+template <class Map>
+static double	run_lower(Map & m, std::vector<int> const & queries)
+{
+	double	start = bench::now_ns();
+
+	for (size_t i = 0; i < queries.size(); i++)
+	{
+		typename Map::iterator	it = m.lower_bound(queries[i]);
+		if (it != m.end())
+			bench::sink += it->first;
+	}
+	return ((bench::now_ns() - start) / queries.size());
+}
+
+template <class Map>
+static double	run_upper(Map & m, std::vector<int> const & queries)
+{
+	double	start = bench::now_ns();
+
+	for (size_t i = 0; i < queries.size(); i++)
+	{
+		typename Map::iterator	it = m.upper_bound(queries[i]);
+		if (it != m.end())
+			bench::sink += it->first;
+	}
+	return ((bench::now_ns() - start) / queries.size());
+}
+
+template <class Map>
+static double	run_equal(Map & m, std::vector<int> const & queries)
+{
+	double	start = bench::now_ns();
+
+	for (size_t i = 0; i < queries.size(); i++)
+	{
+		if (m.equal_range(queries[i]).first != m.end())
+			bench::sink++;
+	}
+	return ((bench::now_ns() - start) / queries.size());
+}
+
+int	main(int ac, char **av)
+{
+	long	max = bench::max_size_arg(ac, av, 10000000);
+
+	std::printf("%-10s %-12s %12s %12s\n", "size", "op", "ft ns/op", "std ns/op");
+	for (long n = 1000; n <= max; n *= 10)
+	{
+		std::vector<int>	keys(n);
+		std::vector<int>	queries(QUERIES);
+
+		for (long i = 0; i < n; i++)
+			keys[i] = static_cast<int>(i * 2);
+		for (long i = n - 1; i > 0; i--)
+			std::swap(keys[i], keys[bench::next_rand() % (i + 1)]);
+		for (long i = 0; i < QUERIES; i++)
+			queries[i] = static_cast<int>(bench::next_rand() % (2 * n));
+
+		ft::map<int, int>	ftm;
+		std::map<int, int>	stdm;
+
+		fill(ftm, keys);
+		fill(stdm, keys);
+		std::printf("%-10ld %-12s %12.1f %12.1f\n", n, "lower_bound", run_lower(ftm, queries), run_lower(stdm, queries));
+		std::printf("%-10ld %-12s %12.1f %12.1f\n", n, "upper_bound", run_upper(ftm, queries), run_upper(stdm, queries));
+		std::printf("%-10ld %-12s %12.1f %12.1f\n", n, "equal_range", run_equal(ftm, queries), run_equal(stdm, queries));
+	}
+	return (0);
+}
@@ -0,0 +1,50 @@
+#include "bench.hpp"
+#include "../map.hpp"
+#include <map>
+#include <vector>
+
+/* Costruzione di una map da un range ordinato (come il caricamento di uno snapshot),
+   copia di una map esistente e assegnazione su una map già piena.
+   Tutte e tre devono scalare linearmente con n. */
+
+template <class Map>
+static void	run(char const * name, std::vector<typename Map::value_type> const & values)
+{
+	double	start = bench::now_ns();
+	Map		built(values.begin(), values.end());
+	double	buildNs = (bench::now_ns() - start) / values.size();
+
+	start = bench::now_ns();
+	Map		copy(built);
+	double	copyNs = (bench::now_ns() - start) / values.size();
+
+	start = bench::now_ns();
+	built = copy;
+	double	assignNs = (bench::now_ns() - start) / values.size();
+
+	bench::sink += copy.size() + built.size();
+	std::printf("%-10lu %-6s %12.1f %12.1f %12.1f\n", static_cast<unsigned long>(values.size()), name, buildNs, copyNs, assignNs);
+}
+
+int	main(int ac, char **av)
+{
+	long	max = bench::max_size_arg(ac, av, 10000000);
+
+	std::printf("%-10s %-6s %12s %12s %12s\n", "size", "impl", "range ns/el", "copy ns/el", "assign ns/el");
+	for (long n = 1000; n <= max; n *= 10)
+	{
+		std::vector<ft::pair<const int, int> >	ftValues;
+		std::vector<std::pair<const int, int> >	stdValues;
+
+		ftValues.reserve(n);
+		stdValues.reserve(n);
+		for (long i = 0; i < n; i++)
+		{
+			ftValues.push_back(ft::pair<const int, int>(static_cast<int>(i), static_cast<int>(i)));
+			stdValues.push_back(std::pair<const int, int>(static_cast<int>(i), static_cast<int>(i)));
+		}
+		run<ft::map<int, int> >("ft", ftValues);
+		run<std::map<int, int> >("std", stdValues);
+	}
+	return (0);
+}
@@ -0,0 +1,82 @@
+#include "bench.hpp"
+#include "../map.hpp"
+#include "../flat_map.hpp"
+#include <vector>
+
+/* Carico di sola lettura: la tabella viene costruita una volta da chiavi casuali
+   e poi interrogata con find (chiavi presenti e assenti) e lower_bound.
+   flat_map cerca con una ricerca binaria su un vettore contiguo, ft::map scende
+   nell'albero seguendo puntatori a nodi sparsi in memoria. */
+
+static const long	QUERIES = 1000000;
+
+template <class Map>
+static double	run_build(Map & m, std::vector<ft::pair<int, int> > const & values)
+{
+	double	start = bench::now_ns();
+
+	m.insert(values.begin(), values.end());
+	return ((bench::now_ns() - start) / values.size());
+}
+
+template <class Map>
+static double	run_find(Map const & m, std::vector<int> const & queries)
+{
+	double	start = bench::now_ns();
+
+	for (size_t i = 0; i < queries.size(); i++)
+	{
+		typename Map::const_iterator	it = m.find(queries[i]);
+
+		if (it != m.end())
+			bench::sink += it->second;
+	}
+	return ((bench::now_ns() - start) / queries.size());
+}
+
+template <class Map>
+static double	run_lower_bound(Map const & m, std::vector<int> const & queries)
+{
+	double	start = bench::now_ns();
+
+	for (size_t i = 0; i < queries.size(); i++)
+	{
+		typename Map::const_iterator	it = m.lower_bound(queries[i]);
+
+		if (it != m.end())
+			bench::sink += it->first;
+	}
+	return ((bench::now_ns() - start) / queries.size());
+}
+
+int	main(int ac, char **av)
+{
+	long	max = bench::max_size_arg(ac, av, 10000000);
+
+	std::printf("%-10s %-12s %12s %12s\n", "size", "op", "flat ns/op", "map ns/op");
+	for (long n = 1000; n <= max; n *= 100)
+	{
+		std::vector<ft::pair<int, int> >	values(n);
+		std::vector<int>					hits(QUERIES);
+		std::vector<int>					misses(QUERIES);
+
+		/* chiavi pari: una chiave dispari non è mai presente */
+		for (long i = 0; i < n; i++)
+			values[i] = ft::make_pair(static_cast<int>(bench::next_rand() % (4 * n)) * 2, static_cast<int>(i));
+		for (long q = 0; q < QUERIES; q++)
+		{
+			hits[q] = values[bench::next_rand() % n].first;
+			misses[q] = static_cast<int>(bench::next_rand() % (4 * n)) * 2 + 1;
+		}
+
+		ft::flat_map<int, int>	flat;
+		ft::map<int, int>		tree;
+
+		std::printf("%-10ld %-12s %12.1f %12.1f\n", n, "build", run_build(flat, values), run_build(tree, values));
+		std::printf("%-10ld %-12s %12.1f %12.1f\n", n, "find hit", run_find(flat, hits), run_find(tree, hits));
+		std::printf("%-10ld %-12s %12.1f %12.1f\n", n, "find miss", run_find(flat, misses), run_find(tree, misses));
+		std::printf("%-10ld %-12s %12.1f %12.1f\n", n, "lower_bound", run_lower_bound(flat, misses), run_lower_bound(tree, misses));
+		bench::sink += flat.size() + tree.size();
+	}
+	return (0);
+}
@@ -0,0 +1,118 @@
+#include "bench.hpp"
+#include "../map.hpp"
+#include "../unordered_map.hpp"
+#include <vector>
+#if __cplusplus >= 201103L
+# include <unordered_map>
+#endif
+
+/* Tabella di sessioni: chiavi casuali (id di sessione), il 90% delle operazioni sono ricerche puntuali.
+   build:     n inserimenti uno alla volta;
+   find hit:  ricerche di chiavi presenti;
+   find miss: ricerche di chiavi assenti;
+   mixed:     90% ricerche, 5% nuove sessioni, 5% sessioni chiuse (la dimensione resta costante).
+   ft::unordered_map è confrontata con ft::map e, in C++11, con std::unordered_map. */
+
+static const long	QUERIES = 1000000;
+
+struct Keys
+{
+	std::vector<int>	present;
+	std::vector<int>	hits;
+	std::vector<int>	misses;
+	std::vector<int>	fresh;
+};
+
+template <class Map>
+static double	run_build(Map & m, Keys const & k)
+{
+	double	start = bench::now_ns();
+
+	for (size_t i = 0; i < k.present.size(); i++)
+		m[k.present[i]] = static_cast<int>(i);
+	return ((bench::now_ns() - start) / k.present.size());
+}
+
+template <class Map>
+static double	run_find(Map const & m, std::vector<int> const & queries)
+{
+	double	start = bench::now_ns();
+
+	for (size_t i = 0; i < queries.size(); i++)
+	{
+		typename Map::const_iterator	it = m.find(queries[i]);
+
+		if (it != m.end())
+			bench::sink += it->second;
+	}
+	return ((bench::now_ns() - start) / queries.size());
+}
+
+/* Ogni 20 operazioni: 18 ricerche, un inserimento di una chiave nuova e la rimozione della più vecchia ancora presente. */
+template <class Map>
+static double	run_mixed(Map & m, Keys const & k)
+{
+	size_t	oldest = 0;
+	size_t	fresh = 0;
+	double	start = bench::now_ns();
+
+	for (long i = 0; i < QUERIES; i++)
+	{
+		long	slot = i % 20;
+
+		if (slot == 18)
+			m[k.fresh[fresh++ % k.fresh.size()]] = static_cast<int>(i);
+		else if (slot == 19)
+			m.erase(k.present[oldest++ % k.present.size()]);
+		else
+		{
+			typename Map::iterator	it = m.find(k.hits[i]);
+
+			if (it != m.end())
+				bench::sink += it->second;
+		}
+	}
+	return ((bench::now_ns() - start) / QUERIES);
+}
+
+template <class Map>
+static void	run(char const * name, long n, Keys const & k)
+{
+	Map		m;
+	double	build = run_build(m, k);
+	double	hit = run_find(m, k.hits);
+	double	miss = run_find(m, k.misses);
+	double	mixed = run_mixed(m, k);
+
+	bench::sink += m.size();
+	std::printf("%-10ld %-8s %12.1f %12.1f %12.1f %12.1f\n", n, name, build, hit, miss, mixed);
+}
+
+int	main(int ac, char **av)
+{
+	long	max = bench::max_size_arg(ac, av, 10000000);
+
+	std::printf("%-10s %-8s %12s %12s %12s %12s\n", "size", "impl", "build ns/op", "hit ns/op", "miss ns/op", "mixed ns/op");
+	for (long n = 1000; n <= max; n *= 10)
+	{
+		Keys	k;
+
+		/* chiavi pari presenti, dispari assenti */
+		k.present.resize(n);
+		for (long i = 0; i < n; i++)
+			k.present[i] = static_cast<int>(bench::next_rand() % 0x3fffffff) * 2;
+		for (long q = 0; q < QUERIES; q++)
+		{
+			k.hits.push_back(k.present[bench::next_rand() % n]);
+			k.misses.push_back(static_cast<int>(bench::next_rand() % 0x3fffffff) * 2 + 1);
+		}
+		for (long i = 0; i < QUERIES / 20 + 1; i++)
+			k.fresh.push_back(static_cast<int>(bench::next_rand() % 0x3fffffff) * 2);
+		run<ft::unordered_map<int, int> >("ft_hash", n, k);
+		run<ft::map<int, int> >("ft_map", n, k);
+#if __cplusplus >= 201103L
+		run<std::unordered_map<int, int> >("std_hash", n, k);
+#endif
+	}
+	return (0);
+}
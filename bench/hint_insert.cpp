@@ -0,0 +1,75 @@
+#include "bench.hpp"
+#include "../map.hpp"
+#include "../vector.hpp"
+#include <map>
+#include <vector>
+
+/* Inserimento con suggerimento su tre flussi di chiavi:
+   monotonic:   chiavi crescenti, suggerimento end() (come un push_back);
+   near-sorted: timestamp quasi crescenti (ogni chiave può scavalcare le vicine),
+                suggerimento l'iteratore restituito dall'inserimento precedente;
+   random:      chiavi casuali con lo stesso suggerimento, che quasi sempre è sbagliato.
+   Come riferimento viene misurato ft::vector::push_back sulle stesse chiavi. */
+
+template <class Map>
+static double	run_end(std::vector<int> const & keys)
+{
+	Map		m;
+	double	start = bench::now_ns();
+
+	for (size_t i = 0; i < keys.size(); i++)
+		m.insert(m.end(), typename Map::value_type(keys[i], 0));
+	bench::sink += m.size();
+	return ((bench::now_ns() - start) / keys.size());
+}
+
+template <class Map>
+static double	run_last(std::vector<int> const & keys)
+{
+	Map						m;
+	typename Map::iterator	hint = m.end();
+	double					start = bench::now_ns();
+
+	for (size_t i = 0; i < keys.size(); i++)
+		hint = m.insert(hint, typename Map::value_type(keys[i], 0));
+	bench::sink += m.size();
+	return ((bench::now_ns() - start) / keys.size());
+}
+
+static double	run_vector(std::vector<int> const & keys)
+{
+	ft::vector<int>	v;
+	double			start = bench::now_ns();
+
+	for (size_t i = 0; i < keys.size(); i++)
+		v.push_back(keys[i]);
+	bench::sink += v.size();
+	return ((bench::now_ns() - start) / keys.size());
+}
+
+int	main(int ac, char **av)
+{
+	long	max = bench::max_size_arg(ac, av, 1000000);
+
+	std::printf("%-10s %-12s %12s %12s %12s\n", "size", "keys", "ft ns/op", "std ns/op", "vector ns/op");
+	for (long n = 1000; n <= max; n *= 10)
+	{
+		std::vector<int>	monotonic(n);
+		std::vector<int>	nearSorted(n);
+		std::vector<int>	random(n);
+
+		for (long i = 0; i < n; i++)
+		{
+			monotonic[i] = static_cast<int>(i);
+			nearSorted[i] = static_cast<int>(i * 4 + bench::next_rand() % 8);
+			random[i] = static_cast<int>(bench::next_rand() % (4 * n));
+		}
+		std::printf("%-10ld %-12s %12.1f %12.1f %12.1f\n", n, "monotonic",
+			run_end<ft::map<int, int> >(monotonic), run_end<std::map<int, int> >(monotonic), run_vector(monotonic));
+		std::printf("%-10ld %-12s %12.1f %12.1f %12.1f\n", n, "near-sorted",
+			run_last<ft::map<int, int> >(nearSorted), run_last<std::map<int, int> >(nearSorted), run_vector(nearSorted));
+		std::printf("%-10ld %-12s %12.1f %12.1f %12.1f\n", n, "random",
+			run_last<ft::map<int, int> >(random), run_last<std::map<int, int> >(random), run_vector(random));
+	}
+	return (0);
+}
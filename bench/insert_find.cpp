@@ -0,0 +1,78 @@
+#include "bench.hpp"
+#include "../map.hpp"
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+/* Costo di insert e find su chiavi a 32 bit e su stringhe.
+   insert-miss: inserimento di N chiavi nuove in ordine casuale;
+   insert-hit:  reinserimento delle stesse N chiavi (tutte duplicate, nessuna allocazione);
+   find:        ricerca delle N chiavi presenti.
+   Con la discesa unica un insert-hit deve costare quanto un find, non il doppio. */
+
+static void	make_key(int i, int & key)
+{
+	key = i;
+}
+
+static void	make_key(int i, std::string & key)
+{
+	char	buf[32];
+
+	std::sprintf(buf, "order-%010d", i);
+	key = buf;
+}
+
+template <class Map>
+static double	run_insert(Map & m, std::vector<typename Map::key_type> const & keys)
+{
+	double	start = bench::now_ns();
+
+	for (size_t i = 0; i < keys.size(); i++)
+		bench::sink += m.insert(typename Map::value_type(keys[i], i)).second;
+	return ((bench::now_ns() - start) / keys.size());
+}
+
+template <class Map>
+static double	run_find(Map & m, std::vector<typename Map::key_type> const & keys)
+{
+	double	start = bench::now_ns();
+
+	for (size_t i = 0; i < keys.size(); i++)
+		bench::sink += m.find(keys[i])->second;
+	return ((bench::now_ns() - start) / keys.size());
+}
+
+template <class Key>
+static void	run(char const * name, long n)
+{
+	std::vector<Key>	keys(n);
+
+	for (long i = 0; i < n; i++)
+		make_key(static_cast<int>(i), keys[i]);
+	for (long i = n - 1; i > 0; i--)
+		std::swap(keys[i], keys[bench::next_rand() % (i + 1)]);
+
+	ft::map<Key, long>	ftm;
+	std::map<Key, long>	stdm;
+	double				ftMiss = run_insert(ftm, keys);
+	double				stdMiss = run_insert(stdm, keys);
+
+	std::printf("%-10ld %-8s %-12s %12.1f %12.1f\n", n, name, "insert-miss", ftMiss, stdMiss);
+	std::printf("%-10ld %-8s %-12s %12.1f %12.1f\n", n, name, "insert-hit", run_insert(ftm, keys), run_insert(stdm, keys));
+	std::printf("%-10ld %-8s %-12s %12.1f %12.1f\n", n, name, "find", run_find(ftm, keys), run_find(stdm, keys));
+}
+
+int	main(int ac, char **av)
+{
+	long	max = bench::max_size_arg(ac, av, 1000000);
+
+	std::printf("%-10s %-8s %-12s %12s %12s\n", "size", "key", "op", "ft ns/op", "std ns/op");
+	for (long n = 1000; n <= max; n *= 10)
+	{
+		run<int>("int32", n);
+		run<std::string>("string", n);
+	}
+	return (0);
+}
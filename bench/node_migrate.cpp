@@ -0,0 +1,103 @@
+#include "bench.hpp"
+#include "alloc_count.hpp"
+#include "../map.hpp"
+#include <map>
+#include <string>
+
+/* Migrazione di elementi tra due map, come una coda di lavori che passa da "in attesa" a "in corso":
+   a ogni passo si sposta un elemento a caso da una map all'altra.
+   - erase + insert: copia del valore nella destinazione (chiave e valore sono stringhe lunghe, quindi
+     due allocazioni per la copia) e distruzione dell'originale;
+   - extract + insert: il valore viene spostato nella node handle e da lì nel nodo di destinazione;
+     i nodi vengono dal pool, quindi non si alloca nulla.
+   Si confronta con std::map, dove extract() stacca il nodo stesso (serve C++17). */
+
+typedef std::string	Str;
+
+static Str	make_key(long i)
+{
+	char	buf[32];
+
+	std::snprintf(buf, sizeof(buf), "%012ld", i);
+	return (Str("job-identifier-") + buf);
+}
+
+template <class Map>
+static void	fill(Map & m, long n)
+{
+	for (long i = 0; i < n; i++)
+		m.insert(typename Map::value_type(make_key(i), Str(48, 'p')));
+}
+
+static void	report(char const * impl, char const * how, double ns, long steps, unsigned long allocs)
+{
+	std::printf("%-8s %-18s %10.1f %12.2f\n", impl, how, ns / steps, static_cast<double>(allocs) / steps);
+}
+
+template <class Map>
+static void	copy_migrate(char const * impl, long n, long steps)
+{
+	Map				from;
+	Map				to;
+	unsigned long	allocs;
+	double			start;
+
+	fill(from, n);
+	allocs = g_allocations;
+	start = bench::now_ns();
+	for (long s = 0; s < steps; s++)
+	{
+		Map &	src = (s / n) % 2 ? to : from;
+		Map &	dst = (s / n) % 2 ? from : to;
+		typename Map::iterator	it = src.find(make_key(bench::next_rand() % n));
+
+		if (it == src.end())
+			it = src.begin();
+		dst.insert(*it);
+		src.erase(it);
+	}
+	report(impl, "erase + insert", bench::now_ns() - start, steps, g_allocations - allocs);
+}
+
+template <class Map>
+static void	handle_migrate(char const * impl, long n, long steps)
+{
+	Map				from;
+	Map				to;
+	unsigned long	allocs;
+	double			start;
+
+	fill(from, n);
+	allocs = g_allocations;
+	start = bench::now_ns();
+	for (long s = 0; s < steps; s++)
+	{
+		Map &	src = (s / n) % 2 ? to : from;
+		Map &	dst = (s / n) % 2 ? from : to;
+		typename Map::iterator	it = src.find(make_key(bench::next_rand() % n));
+
+		if (it == src.end())
+			it = src.begin();
+		typename Map::node_type	handle = src.extract(it);
+
+		dst.insert(FT_MOVE(handle));
+	}
+	report(impl, "extract + insert", bench::now_ns() - start, steps, g_allocations - allocs);
+}
+
+int	main(int ac, char **av)
+{
+	long	n = bench::max_size_arg(ac, av, 100000);
+	long	steps = 4 * n;
+
+	/* make_key() costa un'allocazione per passo in tutte le varianti: è compresa nei conteggi. */
+	std::printf("n = %ld, %ld migrazioni\n", n, steps);
+	std::printf("%-8s %-18s %10s %12s\n", "impl", "how", "ns/step", "allocs/step");
+	copy_migrate<ft::map<Str, Str> >("ft", n, steps);
+	handle_migrate<ft::map<Str, Str> >("ft", n, steps);
+	copy_migrate<std::map<Str, Str> >("std", n, steps);
+#if __cplusplus >= 201703L
+	handle_migrate<std::map<Str, Str> >("std", n, steps);
+#endif
+	return (0);
+}
@@ -0,0 +1,87 @@
+#include "bench.hpp"
+#include "../map.hpp"
+#include <map>
+#include <iterator>
+
+/* Percentili e classifiche su una map viva: select(k) (l'elemento in posizione k, es. il p99),
+   rank(key) (quanti elementi stanno sotto una chiave) e begin() + k.
+   Con i contatori dei sottoalberi costano O(log n); std::map deve scorrere k elementi. */
+
+static const long	QUERIES = 1000;
+
+template <class Map>
+static void	fill(Map & m, long n)
+{
+	for (long i = 0; i < n; i++)
+		m.insert(typename Map::value_type(static_cast<int>(bench::next_rand() % (8 * n)), 0));
+}
+
+static double	ft_select(ft::map<int, int> const & m)
+{
+	double	start = bench::now_ns();
+
+	for (long q = 0; q < QUERIES; q++)
+		bench::sink += m.select(m.size() * 99 / 100 - q % 16)->first;
+	return ((bench::now_ns() - start) / QUERIES);
+}
+
+static double	ft_rank(ft::map<int, int> const & m, long n)
+{
+	double	start = bench::now_ns();
+
+	for (long q = 0; q < QUERIES; q++)
+		bench::sink += m.rank(static_cast<int>(bench::next_rand() % (8 * n)));
+	return ((bench::now_ns() - start) / QUERIES);
+}
+
+static double	ft_advance(ft::map<int, int> const & m)
+{
+	double	start = bench::now_ns();
+
+	for (long q = 0; q < QUERIES; q++)
+		bench::sink += (m.begin() + static_cast<long>(m.size() / 2 + q % 16))->first;
+	return ((bench::now_ns() - start) / QUERIES);
+}
+
+static double	std_select(std::map<int, int> const & m, long queries)
+{
+	double	start = bench::now_ns();
+
+	for (long q = 0; q < queries; q++)
+	{
+		std::map<int, int>::const_iterator	it = m.begin();
+
+		std::advance(it, m.size() * 99 / 100 - q % 16);
+		bench::sink += it->first;
+	}
+	return ((bench::now_ns() - start) / queries);
+}
+
+static double	std_rank(std::map<int, int> const & m, long n, long queries)
+{
+	double	start = bench::now_ns();
+
+	for (long q = 0; q < queries; q++)
+		bench::sink += std::distance(m.begin(), m.lower_bound(static_cast<int>(bench::next_rand() % (8 * n))));
+	return ((bench::now_ns() - start) / queries);
+}
+
+int	main(int ac, char **av)
+{
+	long	max = bench::max_size_arg(ac, av, 1000000);
+
+	std::printf("%-10s %-12s %12s %12s\n", "size", "op", "ft ns/op", "std ns/op");
+	for (long n = 1000; n <= max; n *= 10)
+	{
+		ft::map<int, int>	ftm;
+		std::map<int, int>	stdm;
+		long				stdQueries = n >= 1000000 ? 20 : 200;
+
+		fill(ftm, n);
+		fill(stdm, n);
+		std::printf("%-10ld %-12s %12.1f %12.1f\n", n, "select(p99)", ft_select(ftm), std_select(stdm, stdQueries));
+		std::printf("%-10ld %-12s %12.1f %12.1f\n", n, "rank(key)", ft_rank(ftm, n), std_rank(stdm, n, stdQueries));
+		std::printf("%-10ld %-12s %12.1f %12s\n", n, "begin()+k", ft_advance(ftm), "-");
+	}
+	return (0);
+}
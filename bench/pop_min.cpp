@@ -0,0 +1,57 @@
+#include "bench.hpp"
+#include "../map.hpp"
+#include <map>
+
+/* Coda di priorità su map: begin() seguito da erase(begin()) fino a svuotarla,
+   e letture ripetute di begin()/rbegin(). Con minimo e massimo in cache
+   il costo per operazione non deve dipendere da n. */
+
+template <class Map>
+static void	fill(Map & m, long n)
+{
+	for (long i = 0; i < n; i++)
+		m.insert(typename Map::value_type(static_cast<int>(bench::next_rand() % (4 * n)), 0));
+}
+
+template <class Map>
+static double	run_pop(Map & m)
+{
+	size_t	n = m.size();
+	double	start = bench::now_ns();
+
+	while (!m.empty())
+	{
+		bench::sink += m.begin()->first;
+		m.erase(m.begin());
+	}
+	return ((bench::now_ns() - start) / n);
+}
+
+template <class Map>
+static double	run_extremes(Map const & m)
+{
+	static const long	QUERIES = 1000000;
+	double				start = bench::now_ns();
+
+	for (long i = 0; i < QUERIES; i++)
+		bench::sink += m.begin()->first + m.rbegin()->first;
+	return ((bench::now_ns() - start) / QUERIES);
+}
+
+int	main(int ac, char **av)
+{
+	long	max = bench::max_size_arg(ac, av, 1000000);
+
+	std::printf("%-10s %-16s %12s %12s\n", "size", "op", "ft ns/op", "std ns/op");
+	for (long n = 1000; n <= max; n *= 10)
+	{
+		ft::map<int, int>	ftm;
+		std::map<int, int>	stdm;
+
+		fill(ftm, n);
+		fill(stdm, n);
+		std::printf("%-10ld %-16s %12.1f %12.1f\n", n, "begin+rbegin", run_extremes(ftm), run_extremes(stdm));
+		std::printf("%-10ld %-16s %12.1f %12.1f\n", n, "pop-min", run_pop(ftm), run_pop(stdm));
+	}
+	return (0);
+}
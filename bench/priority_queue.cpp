@@ -0,0 +1,128 @@
+#include "bench.hpp"
+#include "../multimap.hpp"
+#include "../queue.hpp"
+#include "../indexed_heap.hpp"
+#include <queue>
+#include <vector>
+#include <functional>
+
+/* Coda di timer con n scadenze in attesa, come in un timer wheel.
+   - hold: si toglie la scadenza più vicina e se ne inserisce una nuova più avanti nel tempo;
+     ft::multimap (begin + erase, insert) contro priority_queue binaria, 4-aria e std.
+   - reschedule: si anticipa la scadenza di un timer qualsiasi; con la multimap è erase(iteratore
+     salvato) + insert, con ft::indexed_heap è decrease_key sulla handle restituita da push. */
+
+typedef ft::multimap<long, long>	TimerMap;
+
+static long	delay(long n)
+{
+	return (static_cast<long>(bench::next_rand() % (4 * n)) + 1);
+}
+
+static double	hold_map(long n, long ops)
+{
+	TimerMap	timers;
+	long		now = 0;
+
+	for (long i = 0; i < n; i++)
+		timers.insert(TimerMap::value_type(delay(n), i));
+
+	double	start = bench::now_ns();
+
+	for (long i = 0; i < ops; i++)
+	{
+		TimerMap::iterator	first = timers.begin();
+		long				task = first->second;
+
+		now = first->first;
+		timers.erase(first);
+		timers.insert(TimerMap::value_type(now + delay(n), task));
+	}
+	bench::sink += now;
+	return ((bench::now_ns() - start) / ops);
+}
+
+template <class Queue>
+static double	hold_queue(long n, long ops)
+{
+	Queue	timers;
+	long	now = 0;
+
+	for (long i = 0; i < n; i++)
+		timers.push(delay(n));
+
+	double	start = bench::now_ns();
+
+	for (long i = 0; i < ops; i++)
+	{
+		now = timers.top();
+		timers.pop();
+		timers.push(now + delay(n));
+	}
+	bench::sink += now;
+	return ((bench::now_ns() - start) / ops);
+}
+
+static double	reschedule_map(long n, long ops)
+{
+	TimerMap						timers;
+	std::vector<TimerMap::iterator>	handles(n);
+
+	for (long i = 0; i < n; i++)
+		handles[i] = timers.insert(TimerMap::value_type(4 * n + delay(n), i));
+
+	double	start = bench::now_ns();
+
+	for (long i = 0; i < ops; i++)
+	{
+		long	task = static_cast<long>(bench::next_rand() % n);
+		long	when = handles[task]->first - static_cast<long>(bench::next_rand() % 4) - 1;
+
+		timers.erase(handles[task]);
+		handles[task] = timers.insert(TimerMap::value_type(when, task));
+	}
+	bench::sink += timers.begin()->first;
+	return ((bench::now_ns() - start) / ops);
+}
+
+template <std::size_t Arity>
+static double	reschedule_heap(long n, long ops)
+{
+	typedef ft::indexed_heap<long, std::greater<long>, Arity>	Heap;
+
+	Heap									timers;
+	std::vector<typename Heap::handle_type>	handles(n);
+
+	for (long i = 0; i < n; i++)
+		handles[i] = timers.push(4 * n + delay(n));
+
+	double	start = bench::now_ns();
+
+	for (long i = 0; i < ops; i++)
+	{
+		long	task = static_cast<long>(bench::next_rand() % n);
+		long	when = timers.value(handles[task]) - static_cast<long>(bench::next_rand() % 4) - 1;
+
+		timers.decrease_key(handles[task], when);
+	}
+	bench::sink += timers.top();
+	return ((bench::now_ns() - start) / ops);
+}
+
+int	main(int ac, char **av)
+{
+	long	max = bench::max_size_arg(ac, av, 1000000);
+	long	ops = 1000000;
+
+	std::printf("%-10s %-12s %14s %14s %14s %14s\n", "size", "op", "ft multimap", "ft heap d=2", "ft heap d=4", "std pq");
+	for (long n = 1000; n <= max; n *= 10)
+	{
+		std::printf("%-10ld %-12s %14.1f %14.1f %14.1f %14.1f\n", n, "hold", hold_map(n, ops),
+			hold_queue<ft::priority_queue<long, ft::vector<long>, std::greater<long> > >(n, ops),
+			hold_queue<ft::priority_queue<long, ft::vector<long>, std::greater<long>, 4> >(n, ops),
+			hold_queue<std::priority_queue<long, std::vector<long>, std::greater<long> > >(n, ops));
+		std::printf("%-10ld %-12s %14.1f %14.1f %14.1f %14s\n", n, "reschedule", reschedule_map(n, ops),
+			reschedule_heap<2>(n, ops), reschedule_heap<4>(n, ops), "-");
+	}
+	return (0);
+}
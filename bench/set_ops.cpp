@@ -0,0 +1,112 @@
+#include "bench.hpp"
+#include "../set.hpp"
+#include <set>
+#include <algorithm>
+#include <iterator>
+
+/* Operazioni tra un set grande (n chiavi) e uno piccolo (m chiavi), come un motore di permessi che
+   interseca gli ID concessi a un utente con quelli di una risorsa. Per ogni m si confrontano:
+   - ft bulk: intersect() del set piccolo con quello grande, subtract() e merge() sul set grande
+     (vedi RBTree::intersectWith), O(m log(n/m + 1)); intersect() distrugge le chiavi scartate, quindi
+     conviene chiamarla sul set più piccolo;
+   - ft loop: la stessa operazione elemento per elemento, O(m log n) per intersezione e unione,
+     con una find sul set grande e un insert nel risultato;
+   - std: std::set_intersection e std::set_union su std::set, che scorrono entrambi i set: O(n + m).
+   Le copie dei set di partenza sono fuori dalle misure. */
+
+typedef ft::set<long>	FtSet;
+typedef std::set<long>	StdSet;
+
+static long	random_key(long n)
+{
+	return (static_cast<long>(bench::next_rand() % (4 * n)));
+}
+
+template <class Set>
+static void	fill(Set & s, long n, long range)
+{
+	while (static_cast<long>(s.size()) < n)
+		s.insert(random_key(range));
+}
+
+static void	run(long n, long m)
+{
+	FtSet	bigFt;
+	FtSet	smallFt;
+	StdSet	bigStd;
+	StdSet	smallStd;
+	double	start;
+
+	fill(bigFt, n, n);
+	fill(smallFt, m, n);
+	bigStd.insert(bigFt.begin(), bigFt.end());
+	smallStd.insert(smallFt.begin(), smallFt.end());
+	/* Una passata non misurata porta in cache i livelli alti del set grande, altrimenti la prima
+	   variante misurata paga da sola i miss che le altre trovano già risolti. */
+	for (FtSet::iterator it = smallFt.begin(); it != smallFt.end(); ++it)
+		bench::sink += (bigFt.find(*it) != bigFt.end());
+	{
+		FtSet	small(smallFt);
+
+		start = bench::now_ns();
+		small.intersect(bigFt);
+		std::printf("%10ld %10ld %-8s %-10s %12.3f %10zu\n", n, m, "ft bulk", "intersect", (bench::now_ns() - start) / 1e6, small.size());
+	}
+	{
+		FtSet	result;
+
+		start = bench::now_ns();
+		for (FtSet::iterator it = smallFt.begin(); it != smallFt.end(); ++it)
+			if (bigFt.find(*it) != bigFt.end())
+				result.insert(result.end(), *it);
+		std::printf("%10ld %10ld %-8s %-10s %12.3f %10zu\n", n, m, "ft loop", "intersect", (bench::now_ns() - start) / 1e6, result.size());
+	}
+	{
+		StdSet	result;
+
+		start = bench::now_ns();
+		std::set_intersection(bigStd.begin(), bigStd.end(), smallStd.begin(), smallStd.end(), std::inserter(result, result.end()));
+		std::printf("%10ld %10ld %-8s %-10s %12.3f %10zu\n", n, m, "std", "intersect", (bench::now_ns() - start) / 1e6, result.size());
+	}
+	{
+		FtSet	big(bigFt);
+
+		start = bench::now_ns();
+		big.subtract(smallFt);
+		std::printf("%10ld %10ld %-8s %-10s %12.3f %10zu\n", n, m, "ft bulk", "subtract", (bench::now_ns() - start) / 1e6, big.size());
+	}
+	{
+		FtSet	big(bigFt);
+		FtSet	small(smallFt);
+
+		start = bench::now_ns();
+		big.merge(small);
+		std::printf("%10ld %10ld %-8s %-10s %12.3f %10zu\n", n, m, "ft bulk", "merge", (bench::now_ns() - start) / 1e6, big.size());
+	}
+	{
+		FtSet	big(bigFt);
+
+		start = bench::now_ns();
+		for (FtSet::iterator it = smallFt.begin(); it != smallFt.end(); ++it)
+			big.insert(*it);
+		std::printf("%10ld %10ld %-8s %-10s %12.3f %10zu\n", n, m, "ft loop", "union", (bench::now_ns() - start) / 1e6, big.size());
+	}
+	{
+		StdSet	result;
+
+		start = bench::now_ns();
+		std::set_union(bigStd.begin(), bigStd.end(), smallStd.begin(), smallStd.end(), std::inserter(result, result.end()));
+		std::printf("%10ld %10ld %-8s %-10s %12.3f %10zu\n", n, m, "std", "union", (bench::now_ns() - start) / 1e6, result.size());
+	}
+}
+
+int	main(int ac, char **av)
+{
+	long	n = bench::max_size_arg(ac, av, 1000000);
+
+	std::printf("%10s %10s %-8s %-10s %12s %10s\n", "n", "m", "impl", "op", "ms", "size");
+	for (long m = 10; m < n; m *= 100)
+		run(n, m);
+	run(n, n);
+	return (0);
+}
@@ -0,0 +1,105 @@
+#include "bench.hpp"
+#include "../vector.hpp"
+#include <vector>
+#include <algorithm>
+
+/* Confronto tra repliche: due vettori identici tranne l'ultimo elemento, confrontati con ==, <
+   e cercati con find/count. Colonne: GB/s letti con il percorso vettoriale (ft),
+   con il ciclo generico elemento per elemento (ft::algorithm_dispatch<false>, com'era prima)
+   e con gli algoritmi di std. */
+
+static const int	REPEAT = 5;
+
+template <class T>
+static double	gbps(double ns, long n, int ranges)
+{
+	return (static_cast<double>(n) * sizeof(T) * ranges * REPEAT / ns);
+}
+
+template <class T>
+static void	run(char const * type, long n)
+{
+	ft::vector<T>		a(n, T(1));
+	ft::vector<T>		b(n, T(1));
+	std::vector<T>		sa(n, T(1));
+	std::vector<T>		sb(n, T(1));
+	double				start;
+	double				fast[4];
+	double				slow[4];
+	double				std[4];
+
+	b[n - 1] = T(2);
+	sb[n - 1] = T(2);
+
+	start = bench::now_ns();
+	for (int r = 0; r < REPEAT; r++)
+		bench::sink += (a == b);
+	fast[0] = gbps<T>(bench::now_ns() - start, n, 2);
+	start = bench::now_ns();
+	for (int r = 0; r < REPEAT; r++)
+		bench::sink += ft::algorithm_dispatch<false>::equal(a.begin(), a.end(), b.begin());
+	slow[0] = gbps<T>(bench::now_ns() - start, n, 2);
+	start = bench::now_ns();
+	for (int r = 0; r < REPEAT; r++)
+		bench::sink += (sa == sb);
+	std[0] = gbps<T>(bench::now_ns() - start, n, 2);
+
+	start = bench::now_ns();
+	for (int r = 0; r < REPEAT; r++)
+		bench::sink += (a < b);
+	fast[1] = gbps<T>(bench::now_ns() - start, n, 2);
+	start = bench::now_ns();
+	for (int r = 0; r < REPEAT; r++)
+		bench::sink += ft::algorithm_dispatch<false>::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+	slow[1] = gbps<T>(bench::now_ns() - start, n, 2);
+	start = bench::now_ns();
+	for (int r = 0; r < REPEAT; r++)
+		bench::sink += (sa < sb);
+	std[1] = gbps<T>(bench::now_ns() - start, n, 2);
+
+	start = bench::now_ns();
+	for (int r = 0; r < REPEAT; r++)
+		bench::sink += ft::find(b.begin(), b.end(), T(2)) - b.begin();
+	fast[2] = gbps<T>(bench::now_ns() - start, n, 1);
+	start = bench::now_ns();
+	for (int r = 0; r < REPEAT; r++)
+		bench::sink += ft::algorithm_dispatch<false>::find(b.begin(), b.end(), T(2)) - b.begin();
+	slow[2] = gbps<T>(bench::now_ns() - start, n, 1);
+	start = bench::now_ns();
+	for (int r = 0; r < REPEAT; r++)
+		bench::sink += std::find(sb.begin(), sb.end(), T(2)) - sb.begin();
+	std[2] = gbps<T>(bench::now_ns() - start, n, 1);
+
+	start = bench::now_ns();
+	for (int r = 0; r < REPEAT; r++)
+		bench::sink += ft::count(b.begin(), b.end(), T(1));
+	fast[3] = gbps<T>(bench::now_ns() - start, n, 1);
+	start = bench::now_ns();
+	for (int r = 0; r < REPEAT; r++)
+		bench::sink += ft::algorithm_dispatch<false>::count(b.begin(), b.end(), T(1));
+	slow[3] = gbps<T>(bench::now_ns() - start, n, 1);
+	start = bench::now_ns();
+	for (int r = 0; r < REPEAT; r++)
+		bench::sink += std::count(sb.begin(), sb.end(), T(1));
+	std[3] = gbps<T>(bench::now_ns() - start, n, 1);
+
+	char const *	ops[4] = { "==", "<", "find", "count" };
+
+	for (int i = 0; i < 4; i++)
+		std::printf("%-10ld %-8s %-6s %10.2f %10.2f %10.2f\n", n, type, ops[i], fast[i], slow[i], std[i]);
+}
+
+int	main(int ac, char **av)
+{
+	long	max = bench::max_size_arg(ac, av, 16000000);
+
+	std::printf("%-10s %-8s %-6s %10s %10s %10s\n", "size", "type", "op", "ft GB/s", "loop GB/s", "std GB/s");
+	for (long n = 1000; n <= max; n *= 4)
+	{
+		run<unsigned char>("uint8", n);
+		run<int>("int32", n);
+		run<long long>("int64", n);
+		run<double>("double", n);
+	}
+	return (0);
+}
@@ -0,0 +1,66 @@
+#include "bench.hpp"
+#include "alloc_count.hpp"
+#include "../vector.hpp"
+#include "../small_vector.hpp"
+#include <vector>
+
+/* Parser di richieste simulato: ogni richiesta produce da 1 a 12 token (quasi sempre meno di 8),
+   raccolti in un vettore creato e distrutto per ogni richiesta.
+   operator new è sostituito per contare le allocazioni: small_vector<Token, 8>
+   deve allocare solo per le richieste che superano gli 8 token. */
+
+struct Token
+{
+	int	kind;
+	int	begin;
+	int	length;
+};
+
+template <class Vec>
+static void	run(char const * name, std::vector<int> const & counts)
+{
+	unsigned long	before = g_allocations;
+	long			tokens = 0;
+	double			start = bench::now_ns();
+
+	for (size_t r = 0; r < counts.size(); r++)
+	{
+		Vec		parsed;
+		Token	tok;
+
+		for (int i = 0; i < counts[r]; i++)
+		{
+			tok.kind = i & 3;
+			tok.begin = i * 8;
+			tok.length = 8;
+			parsed.push_back(tok);
+		}
+		for (size_t i = 0; i < parsed.size(); i++)
+			tokens += parsed[i].length;
+	}
+
+	double	ns = (bench::now_ns() - start) / counts.size();
+
+	bench::sink += tokens;
+	std::printf("%-10lu %-16s %12.1f %14.3f\n", static_cast<unsigned long>(counts.size()), name, ns,
+		static_cast<double>(g_allocations - before) / counts.size());
+}
+
+int	main(int ac, char **av)
+{
+	long	max = bench::max_size_arg(ac, av, 10000000);
+
+	std::printf("%-10s %-16s %12s %14s\n", "requests", "container", "ns/request", "allocs/request");
+	for (long n = 100000; n <= max; n *= 10)
+	{
+		std::vector<int>	counts(n);
+
+		// 95% delle richieste con 1-7 token, le altre con 8-12
+		for (long i = 0; i < n; i++)
+			counts[i] = bench::next_rand() % 100 < 95 ? 1 + bench::next_rand() % 7 : 8 + bench::next_rand() % 5;
+		run<ft::vector<Token> >("ft::vector", counts);
+		run<ft::small_vector<Token, 8> >("ft::small_vector", counts);
+		run<std::vector<Token> >("std::vector", counts);
+	}
+	return (0);
+}
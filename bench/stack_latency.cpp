@@ -0,0 +1,91 @@
+#include "bench.hpp"
+#include "../vector.hpp"
+#include "../deque.hpp"
+#include "../stack.hpp"
+#include "../queue.hpp"
+#include <vector>
+#include <deque>
+#include <stack>
+#include <queue>
+#include <algorithm>
+
+/* Latenza del singolo push per ft::stack sopra ft::vector e sopra ft::deque (e gli std
+   corrispondenti): n push di long cronometrati uno per uno, senza reserve(). La media è simile,
+   ma con un vector il push che fa crescere la capacità copia tutto il contenuto e il caso
+   peggiore cresce con n; con un deque ogni push alloca al più un blocco da 4 KiB.
+   L'ultima riga di ogni dimensione è una coda che scorre (push + pop) sopra ft::deque e std::deque. */
+
+static double	percentile(std::vector<double> & lat, double q)
+{
+	size_t	k = static_cast<size_t>(q * (lat.size() - 1));
+
+	std::nth_element(lat.begin(), lat.begin() + k, lat.end());
+	return (lat[k]);
+}
+
+static void	report(long n, char const * name, std::vector<double> & lat, double total)
+{
+	double	worst = *std::max_element(lat.begin(), lat.end());
+	double	p999 = percentile(lat, 0.999);
+	double	p50 = percentile(lat, 0.5);
+
+	std::printf("%-10ld %-14s %10.2f %10.0f %10.0f %12.0f\n", n, name, total / n, p50, p999, worst);
+}
+
+template <class Stack>
+static void	measure_stack(long n, char const * name)
+{
+	std::vector<double>	lat(n);
+	Stack				s;
+	double				total = 0;
+
+	for (long i = 0; i < n; i++)
+	{
+		double	start = bench::now_ns();
+
+		s.push(i);
+		lat[i] = bench::now_ns() - start;
+		total += lat[i];
+	}
+	bench::sink += s.size();
+	report(n, name, lat, total);
+}
+
+template <class Queue>
+static void	measure_queue(long n, char const * name)
+{
+	std::vector<double>	lat(n);
+	Queue				q;
+	double				total = 0;
+
+	for (long i = 0; i < 1024; i++)
+		q.push(i);
+	for (long i = 0; i < n; i++)
+	{
+		double	start = bench::now_ns();
+
+		q.push(i);
+		q.pop();
+		lat[i] = bench::now_ns() - start;
+		total += lat[i];
+	}
+	bench::sink += q.front();
+	report(n, name, lat, total);
+}
+
+int	main(int ac, char **av)
+{
+	long	max = bench::max_size_arg(ac, av, 10000000);
+
+	std::printf("%-10s %-14s %10s %10s %10s %12s\n", "size", "container", "mean ns", "p50 ns", "p99.9 ns", "worst ns");
+	for (long n = 10000; n <= max; n *= 10)
+	{
+		measure_stack<ft::stack<long> >(n, "ft_vector");
+		measure_stack<ft::stack<long, ft::deque<long> > >(n, "ft_deque");
+		measure_stack<std::stack<long, std::vector<long> > >(n, "std_vector");
+		measure_stack<std::stack<long> >(n, "std_deque");
+		measure_queue<ft::queue<long> >(n, "ft_queue");
+		measure_queue<std::queue<long> >(n, "std_queue");
+	}
+	return (0);
+}
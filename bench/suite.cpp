@@ -0,0 +1,750 @@
+#include "bench.hpp"
+#include "alloc_count.hpp"
+#include "../vector.hpp"
+#include "../map.hpp"
+#include "../set.hpp"
+#include "../multimap.hpp"
+#include "../multiset.hpp"
+#include "../stack.hpp"
+#include "../deque.hpp"
+#include "../queue.hpp"
+#include <vector>
+#include <map>
+#include <set>
+#include <stack>
+#include <deque>
+#include <queue>
+#include <string>
+#include <cstring>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* Suite di regressione: ogni operazione di vector, map, set, multimap, multiset, stack, deque, queue e priority_queue, ft:: contro std::,
+   per dimensioni da 10^2 a max (10^7 di default) e tre tipi di elemento/chiave:
+   int, std::string (24 caratteri, quindi allocata) e una struct da 64 byte.
+   Per ogni riga: ns/op, allocazioni/op (operator new è sostituito, vedi alloc_count.hpp)
+   e picco di memoria residente in KiB.
+   Ogni combinazione (container, implementazione, tipo, dimensione) gira in un processo figlio:
+   il picco di memoria è quello del figlio fino alla fine di quell'operazione (costruzione
+   compresa) e non è sporcato dalle misure precedenti. Se il figlio viene ucciso (memoria esaurita)
+   la combinazione viene segnalata su stderr e la suite prosegue.
+   Uso: ./bench/suite [max] [csv|json]  (make bench scrive bench/results.csv) */
+
+struct Blob64
+{
+	long	key;
+	char	pad[56];
+
+	Blob64() : key(0) { std::memset(pad, 0, sizeof(pad)); }
+	explicit Blob64(long k) : key(k) { std::memset(pad, static_cast<int>(k & 0x7f), sizeof(pad)); }
+	bool	operator<(Blob64 const & rhs) const { return (key < rhs.key); }
+	bool	operator==(Blob64 const & rhs) const { return (key == rhs.key); }
+	bool	operator!=(Blob64 const & rhs) const { return (key != rhs.key); }
+};
+
+/* Chiavi distinte: i * costante dispari è una biiezione sui 32 bit, quindi i valori non si ripetono
+   e non arrivano in ordine. */
+static unsigned long	scramble(unsigned long i)
+{
+	return ((i * 2654435761UL) & 0xffffffffUL);
+}
+
+template <class T>
+struct make;
+
+template <>
+struct make<int>
+{
+	static char const *	name() { return ("int"); }
+	static int	value(unsigned long i) { return (static_cast<int>(scramble(i))); }
+};
+
+template <>
+struct make<std::string>
+{
+	static char const *	name() { return ("string"); }
+	static std::string	value(unsigned long i)
+	{
+		char	buf[32];
+
+		std::snprintf(buf, sizeof(buf), "key-%020lu", scramble(i));
+		return (std::string(buf));
+	}
+};
+
+template <>
+struct make<Blob64>
+{
+	static char const *	name() { return ("blob64"); }
+	static Blob64	value(unsigned long i) { return (Blob64(static_cast<long>(scramble(i)))); }
+};
+
+static unsigned long	touch(int v)					{ return (static_cast<unsigned long>(v)); }
+static unsigned long	touch(std::string const & v)	{ return (v.size()); }
+static unsigned long	touch(Blob64 const & v)			{ return (static_cast<unsigned long>(v.key)); }
+
+struct FtImpl
+{
+	static char const *	name() { return ("ft"); }
+	template <class T> struct vector { typedef ft::vector<T> type; };
+	template <class K> struct map { typedef ft::map<K, int> type; };
+	template <class K> struct set { typedef ft::set<K> type; };
+	template <class K> struct multimap { typedef ft::multimap<K, int> type; };
+	template <class K> struct multiset { typedef ft::multiset<K> type; };
+	template <class T> struct stack { typedef ft::stack<T> type; };
+	template <class T> struct deque { typedef ft::deque<T> type; };
+	template <class T> struct queue { typedef ft::queue<T> type; };
+	template <class T> struct priority_queue { typedef ft::priority_queue<T> type; };
+};
+
+struct StdImpl
+{
+	static char const *	name() { return ("std"); }
+	template <class T> struct vector { typedef std::vector<T> type; };
+	template <class K> struct map { typedef std::map<K, int> type; };
+	template <class K> struct set { typedef std::set<K> type; };
+	template <class K> struct multimap { typedef std::multimap<K, int> type; };
+	template <class K> struct multiset { typedef std::multiset<K> type; };
+	template <class T> struct stack { typedef std::stack<T> type; };
+	template <class T> struct deque { typedef std::deque<T> type; };
+	template <class T> struct queue { typedef std::queue<T> type; };
+	template <class T> struct priority_queue { typedef std::priority_queue<T> type; };
+};
+
+/* Cronometro e contatore di allocazioni per una singola operazione; 'done' scrive la riga. */
+class Probe
+{
+	public:
+		Probe(FILE* out, char const * container, char const * type, long size, char const * impl)
+			: _out(out), _container(container), _type(type), _size(size), _impl(impl), _start(0), _allocs(0) {}
+
+		void	start()
+		{
+			_allocs = g_allocations;
+			_start = bench::now_ns();
+		}
+
+		void	done(char const * op, long ops)
+		{
+			double			ns = bench::now_ns() - _start;
+			unsigned long	allocs = g_allocations - _allocs;
+			struct rusage	usage;
+
+			getrusage(RUSAGE_SELF, &usage);
+			if (ops < 1)
+				ops = 1;
+			std::fprintf(_out, "%s,%s,%s,%ld,%s,%ld,%.2f,%.3f,%ld\n", _container, op, _type, _size, _impl, ops,
+				ns / ops, static_cast<double>(allocs) / ops, static_cast<long>(usage.ru_maxrss));
+		}
+
+	private:
+		FILE*			_out;
+		char const *	_container;
+		char const *	_type;
+		long			_size;
+		char const *	_impl;
+		double			_start;
+		unsigned long	_allocs;
+};
+
+/* Operazioni puntuali (ricerche, accessi): al massimo 100000 per misura.
+   Operazioni lineari (inserimento in mezzo a un vector): abbastanza da spostare ~10^8 elementi. */
+static long	point_ops(long n)	{ return (n < 100000 ? n : 100000); }
+static long	linear_ops(long n)	{ long ops = 100000000 / n; return (ops < 1 ? 1 : (ops > 1000 ? 1000 : ops)); }
+
+template <class Impl, class T>
+static void	bench_vector(Probe & p, long n)
+{
+	typedef typename Impl::template vector<T>::type	Vec;
+
+	std::vector<T>			values(n);
+	std::vector<long>		positions(point_ops(n));
+	long					lin = linear_ops(n);
+	unsigned long			acc = 0;
+
+	for (long i = 0; i < n; i++)
+		values[i] = make<T>::value(i);
+	for (size_t i = 0; i < positions.size(); i++)
+		positions[i] = static_cast<long>(bench::next_rand() % n);
+
+	Vec	v;
+
+	p.start();
+	for (long i = 0; i < n; i++)
+		v.push_back(values[i]);
+	p.done("push_back", n);
+
+	p.start();
+	for (size_t i = 0; i < positions.size(); i++)
+		acc += touch(v[positions[i]]);
+	p.done("index", positions.size());
+
+	p.start();
+	for (typename Vec::iterator it = v.begin(); it != v.end(); ++it)
+		acc += touch(*it);
+	p.done("iterate", n);
+
+	p.start();
+	for (long i = 0; i < lin; i++)
+		v.insert(v.begin() + v.size() / 2, values[i % n]);
+	p.done("insert_mid", lin);
+
+	p.start();
+	for (long i = 0; i < lin; i++)
+		v.erase(v.begin() + v.size() / 2);
+	p.done("erase_mid", lin);
+
+	{
+		p.start();
+		Vec	copy(v);
+		p.done("copy", n);
+		acc += copy.size();
+	}
+
+	p.start();
+	while (!v.empty())
+		v.pop_back();
+	p.done("pop_back", n);
+
+	bench::sink += acc;
+}
+
+template <class Impl, class K>
+static void	bench_map(Probe & p, long n)
+{
+	typedef typename Impl::template map<K>::type	Map;
+
+	std::vector<K>		keys(n);
+	std::vector<K>		queries(point_ops(n));
+	unsigned long		acc = 0;
+
+	for (long i = 0; i < n; i++)
+		keys[i] = make<K>::value(i);
+	for (size_t i = 0; i < queries.size(); i++)
+		queries[i] = keys[bench::next_rand() % n];
+
+	Map	m;
+
+	p.start();
+	for (long i = 0; i < n; i++)
+		m.insert(typename Map::value_type(keys[i], static_cast<int>(i)));
+	p.done("insert", n);
+
+	p.start();
+	for (size_t i = 0; i < queries.size(); i++)
+		acc += m.find(queries[i])->second;
+	p.done("find", queries.size());
+
+	p.start();
+	for (size_t i = 0; i < queries.size(); i++)
+		acc += m[queries[i]];
+	p.done("subscript", queries.size());
+
+	p.start();
+	for (size_t i = 0; i < queries.size(); i++)
+		acc += m.lower_bound(queries[i])->second;
+	p.done("lower_bound", queries.size());
+
+	p.start();
+	for (typename Map::iterator it = m.begin(); it != m.end(); ++it)
+		acc += it->second;
+	p.done("iterate", n);
+
+	{
+		p.start();
+		Map	copy(m);
+		p.done("copy", n);
+		acc += copy.size();
+	}
+
+	p.start();
+	for (long i = 0; i < n; i++)
+		acc += m.erase(keys[i]);
+	p.done("erase", n);
+
+	bench::sink += acc;
+}
+
+template <class Impl, class K>
+static void	bench_set(Probe & p, long n)
+{
+	typedef typename Impl::template set<K>::type	Set;
+
+	std::vector<K>		keys(n);
+	std::vector<K>		queries(point_ops(n));
+	unsigned long		acc = 0;
+
+	for (long i = 0; i < n; i++)
+		keys[i] = make<K>::value(i);
+	for (size_t i = 0; i < queries.size(); i++)
+		queries[i] = keys[bench::next_rand() % n];
+
+	Set	s;
+
+	p.start();
+	for (long i = 0; i < n; i++)
+		s.insert(keys[i]);
+	p.done("insert", n);
+
+	p.start();
+	for (size_t i = 0; i < queries.size(); i++)
+		acc += touch(*s.find(queries[i]));
+	p.done("find", queries.size());
+
+	p.start();
+	for (size_t i = 0; i < queries.size(); i++)
+		acc += touch(*s.lower_bound(queries[i]));
+	p.done("lower_bound", queries.size());
+
+	p.start();
+	for (typename Set::iterator it = s.begin(); it != s.end(); ++it)
+		acc += touch(*it);
+	p.done("iterate", n);
+
+	{
+		p.start();
+		Set	copy(s);
+		p.done("copy", n);
+		acc += copy.size();
+	}
+
+	p.start();
+	for (long i = 0; i < n; i++)
+		acc += s.erase(keys[i]);
+	p.done("erase", n);
+
+	bench::sink += acc;
+}
+
+/* Chiavi ripetute: n elementi su n / MULTI_COPIES chiavi distinte, inserite a giro in modo che
+   gli equivalenti non arrivino mai consecutivi. */
+static const long	MULTI_COPIES = 4;
+
+/* Scorrono il risultato di equal_range (ft::pair o std::pair). */
+template <class Range>
+static unsigned long	sum_mapped(Range const & range)
+{
+	unsigned long	acc = 0;
+
+	for (typename Range::first_type it = range.first; it != range.second; ++it)
+		acc += it->second;
+	return (acc);
+}
+
+template <class Range>
+static unsigned long	sum_keys(Range const & range)
+{
+	unsigned long	acc = 0;
+
+	for (typename Range::first_type it = range.first; it != range.second; ++it)
+		acc += touch(*it);
+	return (acc);
+}
+
+template <class Impl, class K>
+static void	bench_multimap(Probe & p, long n)
+{
+	typedef typename Impl::template multimap<K>::type	Map;
+
+	long				distinct = (n + MULTI_COPIES - 1) / MULTI_COPIES;
+	std::vector<K>		keys(distinct);
+	std::vector<K>		queries(point_ops(n));
+	unsigned long		acc = 0;
+
+	for (long i = 0; i < distinct; i++)
+		keys[i] = make<K>::value(i);
+	for (size_t i = 0; i < queries.size(); i++)
+		queries[i] = keys[bench::next_rand() % distinct];
+
+	Map	m;
+
+	p.start();
+	for (long i = 0; i < n; i++)
+		m.insert(typename Map::value_type(keys[i % distinct], static_cast<int>(i)));
+	p.done("insert", n);
+
+	p.start();
+	for (size_t i = 0; i < queries.size(); i++)
+		acc += m.find(queries[i])->second;
+	p.done("find", queries.size());
+
+	p.start();
+	for (size_t i = 0; i < queries.size(); i++)
+		acc += m.count(queries[i]);
+	p.done("count", queries.size());
+
+	p.start();
+	for (size_t i = 0; i < queries.size(); i++)
+		acc += sum_mapped(m.equal_range(queries[i]));
+	p.done("equal_range", queries.size());
+
+	p.start();
+	for (typename Map::iterator it = m.begin(); it != m.end(); ++it)
+		acc += it->second;
+	p.done("iterate", n);
+
+	{
+		p.start();
+		Map	copy(m);
+		p.done("copy", n);
+		acc += copy.size();
+	}
+
+	p.start();
+	for (long i = 0; i < distinct; i++)
+		acc += m.erase(keys[i]);
+	p.done("erase", distinct);
+
+	bench::sink += acc;
+}
+
+template <class Impl, class K>
+static void	bench_multiset(Probe & p, long n)
+{
+	typedef typename Impl::template multiset<K>::type	Set;
+
+	long				distinct = (n + MULTI_COPIES - 1) / MULTI_COPIES;
+	std::vector<K>		keys(distinct);
+	std::vector<K>		queries(point_ops(n));
+	unsigned long		acc = 0;
+
+	for (long i = 0; i < distinct; i++)
+		keys[i] = make<K>::value(i);
+	for (size_t i = 0; i < queries.size(); i++)
+		queries[i] = keys[bench::next_rand() % distinct];
+
+	Set	s;
+
+	p.start();
+	for (long i = 0; i < n; i++)
+		s.insert(keys[i % distinct]);
+	p.done("insert", n);
+
+	p.start();
+	for (size_t i = 0; i < queries.size(); i++)
+		acc += touch(*s.find(queries[i]));
+	p.done("find", queries.size());
+
+	p.start();
+	for (size_t i = 0; i < queries.size(); i++)
+		acc += s.count(queries[i]);
+	p.done("count", queries.size());
+
+	p.start();
+	for (size_t i = 0; i < queries.size(); i++)
+		acc += sum_keys(s.equal_range(queries[i]));
+	p.done("equal_range", queries.size());
+
+	p.start();
+	for (typename Set::iterator it = s.begin(); it != s.end(); ++it)
+		acc += touch(*it);
+	p.done("iterate", n);
+
+	{
+		p.start();
+		Set	copy(s);
+		p.done("copy", n);
+		acc += copy.size();
+	}
+
+	p.start();
+	for (long i = 0; i < distinct; i++)
+		acc += s.erase(keys[i]);
+	p.done("erase", distinct);
+
+	bench::sink += acc;
+}
+
+template <class Impl, class T>
+static void	bench_stack(Probe & p, long n)
+{
+	typedef typename Impl::template stack<T>::type	Stack;
+
+	std::vector<T>		values(n);
+	unsigned long		acc = 0;
+
+	for (long i = 0; i < n; i++)
+		values[i] = make<T>::value(i);
+
+	Stack	s;
+
+	p.start();
+	for (long i = 0; i < n; i++)
+		s.push(values[i]);
+	p.done("push", n);
+
+	{
+		p.start();
+		Stack	copy(s);
+		p.done("copy", n);
+		acc += copy.size();
+	}
+
+	p.start();
+	while (!s.empty())
+	{
+		acc += touch(s.top());
+		s.pop();
+	}
+	p.done("top_pop", n);
+
+	bench::sink += acc;
+}
+
+template <class Impl, class T>
+static void	bench_deque(Probe & p, long n)
+{
+	typedef typename Impl::template deque<T>::type	Deque;
+
+	std::vector<T>			values(n);
+	std::vector<long>		positions(point_ops(n));
+	long					lin = linear_ops(n);
+	unsigned long			acc = 0;
+
+	for (long i = 0; i < n; i++)
+		values[i] = make<T>::value(i);
+	for (size_t i = 0; i < positions.size(); i++)
+		positions[i] = static_cast<long>(bench::next_rand() % n);
+
+	Deque	d;
+
+	p.start();
+	for (long i = 0; i < n; i++)
+		d.push_back(values[i]);
+	p.done("push_back", n);
+
+	p.start();
+	for (long i = 0; i < n; i++)
+		d.push_front(values[i]);
+	p.done("push_front", n);
+
+	p.start();
+	for (size_t i = 0; i < positions.size(); i++)
+		acc += touch(d[positions[i]]);
+	p.done("index", positions.size());
+
+	p.start();
+	for (typename Deque::iterator it = d.begin(); it != d.end(); ++it)
+		acc += touch(*it);
+	p.done("iterate", 2 * n);
+
+	p.start();
+	for (long i = 0; i < lin; i++)
+		d.insert(d.begin() + d.size() / 2, values[i % n]);
+	p.done("insert_mid", lin);
+
+	p.start();
+	for (long i = 0; i < lin; i++)
+		d.erase(d.begin() + d.size() / 2);
+	p.done("erase_mid", lin);
+
+	{
+		p.start();
+		Deque	copy(d);
+		p.done("copy", 2 * n);
+		acc += copy.size();
+	}
+
+	p.start();
+	for (long i = 0; i < n; i++)
+		d.pop_front();
+	p.done("pop_front", n);
+
+	p.start();
+	while (!d.empty())
+		d.pop_back();
+	p.done("pop_back", n);
+
+	bench::sink += acc;
+}
+
+/* Coda che scorre: a regime ogni push è seguito da un pop, con n elementi sempre in coda. */
+template <class Impl, class T>
+static void	bench_queue(Probe & p, long n)
+{
+	typedef typename Impl::template queue<T>::type	Queue;
+
+	std::vector<T>		values(n);
+	unsigned long		acc = 0;
+
+	for (long i = 0; i < n; i++)
+		values[i] = make<T>::value(i);
+
+	Queue	q;
+
+	p.start();
+	for (long i = 0; i < n; i++)
+		q.push(values[i]);
+	p.done("push", n);
+
+	p.start();
+	for (long i = 0; i < n; i++)
+	{
+		acc += touch(q.front());
+		q.pop();
+		q.push(values[i]);
+	}
+	p.done("rolling", n);
+
+	p.start();
+	while (!q.empty())
+	{
+		acc += touch(q.front());
+		q.pop();
+	}
+	p.done("front_pop", n);
+
+	bench::sink += acc;
+}
+
+/* Valori in ordine casuale: ogni push risale in media di pochi livelli, ogni pop scende fino in fondo. */
+template <class Impl, class T>
+static void	bench_priority_queue(Probe & p, long n)
+{
+	typedef typename Impl::template priority_queue<T>::type	Queue;
+
+	std::vector<T>		values(n);
+	unsigned long		acc = 0;
+
+	for (long i = 0; i < n; i++)
+		values[i] = make<T>::value(static_cast<long>(bench::next_rand() % n));
+
+	Queue	q;
+
+	p.start();
+	for (long i = 0; i < n; i++)
+		q.push(values[i]);
+	p.done("push", n);
+
+	{
+		p.start();
+		Queue	built(values.begin(), values.end());
+		p.done("build", n);
+		acc += built.size();
+	}
+
+	{
+		p.start();
+		Queue	copy(q);
+		p.done("copy", n);
+		acc += copy.size();
+	}
+
+	p.start();
+	while (!q.empty())
+	{
+		acc += touch(q.top());
+		q.pop();
+	}
+	p.done("top_pop", n);
+
+	bench::sink += acc;
+}
+
+template <class Impl, class T>
+static void	run_container(FILE* out, char const * container, long n)
+{
+	Probe	p(out, container, make<T>::name(), n, Impl::name());
+
+	if (!std::strcmp(container, "vector"))
+		bench_vector<Impl, T>(p, n);
+	else if (!std::strcmp(container, "map"))
+		bench_map<Impl, T>(p, n);
+	else if (!std::strcmp(container, "set"))
+		bench_set<Impl, T>(p, n);
+	else if (!std::strcmp(container, "multimap"))
+		bench_multimap<Impl, T>(p, n);
+	else if (!std::strcmp(container, "multiset"))
+		bench_multiset<Impl, T>(p, n);
+	else if (!std::strcmp(container, "deque"))
+		bench_deque<Impl, T>(p, n);
+	else if (!std::strcmp(container, "queue"))
+		bench_queue<Impl, T>(p, n);
+	else if (!std::strcmp(container, "priority_queue"))
+		bench_priority_queue<Impl, T>(p, n);
+	else
+		bench_stack<Impl, T>(p, n);
+}
+
+/* Esegue una combinazione in un figlio e inoltra le sue righe, in CSV o come oggetti JSON. */
+template <class Impl, class T>
+static void	run_isolated(char const * container, long n, bool json, bool & first)
+{
+	int		fds[2];
+	pid_t	pid;
+	int		status = 0;
+	char	line[512];
+
+	std::fflush(stdout);
+	if (pipe(fds) != 0)
+		return ;
+	pid = fork();
+	if (pid == 0)
+	{
+		FILE*	out = fdopen(fds[1], "w");
+
+		close(fds[0]);
+		run_container<Impl, T>(out, container, n);
+		std::fclose(out);
+		_exit(0);
+	}
+	close(fds[1]);
+
+	FILE*	in = fdopen(fds[0], "r");
+
+	while (std::fgets(line, sizeof(line), in))
+	{
+		char	field[9][64];
+
+		if (!json)
+		{
+			std::fputs(line, stdout);
+			continue ;
+		}
+		if (std::sscanf(line, "%63[^,],%63[^,],%63[^,],%63[^,],%63[^,],%63[^,],%63[^,],%63[^,],%63[^\n]",
+				field[0], field[1], field[2], field[3], field[4], field[5], field[6], field[7], field[8]) != 9)
+			continue ;
+		std::printf("%s\n  {\"container\": \"%s\", \"op\": \"%s\", \"type\": \"%s\", \"size\": %s, \"impl\": \"%s\", "
+			"\"ops\": %s, \"ns_per_op\": %s, \"allocs_per_op\": %s, \"peak_rss_kb\": %s}",
+			first ? "" : ",", field[0], field[1], field[2], field[3], field[4], field[5], field[6], field[7], field[8]);
+		first = false;
+	}
+	std::fclose(in);
+	waitpid(pid, &status, 0);
+	if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+		std::fprintf(stderr, "suite: %s %s %s %ld did not complete (status %d)\n",
+			container, Impl::name(), make<T>::name(), n, status);
+}
+
+template <class T>
+static void	run_type(char const * container, long n, bool json, bool & first)
+{
+	run_isolated<FtImpl, T>(container, n, json, first);
+	run_isolated<StdImpl, T>(container, n, json, first);
+}
+
+int	main(int ac, char **av)
+{
+	long			max = bench::max_size_arg(ac, av, 10000000);
+	bool			json = (ac > 2 && !std::strcmp(av[2], "json"));
+	bool			first = true;
+	char const *	containers[9] = { "vector", "map", "set", "multimap", "multiset", "stack", "deque", "queue", "priority_queue" };
+
+	if (json)
+		std::printf("[");
+	else
+		std::printf("container,op,type,size,impl,ops,ns_per_op,allocs_per_op,peak_rss_kb\n");
+	for (int c = 0; c < 9; c++)
+	{
+		for (long n = 100; n <= max; n *= 10)
+		{
+			run_type<int>(containers[c], n, json, first);
+			run_type<std::string>(containers[c], n, json, first);
+			run_type<Blob64>(containers[c], n, json, first);
+		}
+	}
+	if (json)
+		std::printf("\n]\n");
+	return (0);
+}
@@ -0,0 +1,95 @@
+#include "bench.hpp"
+#include "../map.hpp"
+#include <map>
+#include <string>
+#include <functional>
+#if __cplusplus >= 201703L
+# include <string_view>
+#endif
+
+/* Map di nomi di header HTTP interrogata con fette di un buffer (puntatore + lunghezza), come fa
+   un parser: senza comparatore trasparente ogni ricerca deve costruire un std::string (e allocarlo,
+   se il nome supera i 15 caratteri del buffer interno); con std::less<> la string_view viene
+   confrontata direttamente con le chiavi. */
+
+#if __cplusplus >= 201703L
+
+static char const *	g_names[] = {
+	"host", "accept", "accept-encoding", "accept-language", "authorization", "cache-control",
+	"connection", "content-encoding", "content-length", "content-type", "cookie", "date", "etag",
+	"if-modified-since", "if-none-match", "last-modified", "location", "origin", "pragma", "range",
+	"referer", "server", "set-cookie", "strict-transport-security", "transfer-encoding",
+	"upgrade-insecure-requests", "user-agent", "vary", "via", "x-content-type-options",
+	"x-forwarded-for", "x-forwarded-proto", "x-frame-options", "x-request-id", "x-real-ip",
+	"access-control-allow-origin", "access-control-request-headers", "content-security-policy",
+	"sec-fetch-mode", "sec-websocket-key"
+};
+
+static const long	NAMES = sizeof(g_names) / sizeof(g_names[0]);
+
+template <class Map, class Probe>
+static double	probe(Map const & m, std::string const & buffer, long const * offsets, long const * lengths, long queries)
+{
+	double	start = bench::now_ns();
+
+	for (long q = 0; q < queries; q++)
+	{
+		typename Map::const_iterator	it = m.find(Probe(buffer.data() + offsets[q], lengths[q]));
+
+		if (it != m.end())
+			bench::sink += it->second;
+	}
+	return ((bench::now_ns() - start) / queries);
+}
+
+int	main(int ac, char **av)
+{
+	long											queries = bench::max_size_arg(ac, av, 1000000);
+	std::string										buffer;
+	long*											offsets = new long[queries];
+	long*											lengths = new long[queries];
+	ft::map<std::string, int>						ftPlain;
+	ft::map<std::string, int, std::less<> >			ftTransparent;
+	std::map<std::string, int>						stdPlain;
+	std::map<std::string, int, std::less<> >		stdTransparent;
+
+	for (long i = 0; i < NAMES; i++)
+	{
+		ftPlain[g_names[i]] = i;
+		ftTransparent[g_names[i]] = i;
+		stdPlain[g_names[i]] = i;
+		stdTransparent[g_names[i]] = i;
+	}
+	/* Un messaggio finto: i nomi cercati stanno uno dopo l'altro nello stesso buffer, un ottavo
+	   sono nomi sconosciuti (troncati di un carattere). */
+	for (long q = 0; q < queries; q++)
+	{
+		char const *	name = g_names[bench::next_rand() % NAMES];
+		long			len = static_cast<long>(std::char_traits<char>::length(name));
+
+		if (bench::next_rand() % 8 == 0)
+			len--;
+		offsets[q] = static_cast<long>(buffer.size());
+		lengths[q] = len;
+		buffer.append(name, len);
+		buffer.append(": v\r\n");
+	}
+	std::printf("%-8s %-24s %10s\n", "impl", "probe", "ns/find");
+	std::printf("%-8s %-24s %10.1f\n", "ft", "std::string (copy)", probe<ft::map<std::string, int>, std::string>(ftPlain, buffer, offsets, lengths, queries));
+	std::printf("%-8s %-24s %10.1f\n", "ft", "string_view, less<>", probe<ft::map<std::string, int, std::less<> >, std::string_view>(ftTransparent, buffer, offsets, lengths, queries));
+	std::printf("%-8s %-24s %10.1f\n", "std", "std::string (copy)", probe<std::map<std::string, int>, std::string>(stdPlain, buffer, offsets, lengths, queries));
+	std::printf("%-8s %-24s %10.1f\n", "std", "string_view, less<>", probe<std::map<std::string, int, std::less<> >, std::string_view>(stdTransparent, buffer, offsets, lengths, queries));
+	delete[] offsets;
+	delete[] lengths;
+	return (0);
+}
+
+#else
+
+int	main()
+{
+	std::printf("transparent_lookup: serve C++17 (std::string_view e std::less<>)\n");
+	return (0);
+}
+
+#endif
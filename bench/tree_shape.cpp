@@ -0,0 +1,82 @@
+#include "bench.hpp"
+#include "../map.hpp"
+#include <cmath>
+
+/* Forma di una map dopo molto churn: a ogni round si eseguono n rimozioni e n inserimenti
+   e si registrano altezza, altezza nera, profondità media (vedi RBTree::stats) e il costo di una find.
+   Due carichi:
+   - random: si rimuove una chiave presente a caso e se ne inserisce una nuova a caso;
+   - sliding: si rimuove sempre la chiave più vecchia e si inserisce una chiave crescente, come una
+     finestra scorrevole di timestamp (tutto il churn colpisce gli stessi due bordi dell'albero).
+   Se l'albero degenerasse, altezza e profondità media crescerebbero di round in round;
+   per un albero rosso-nero l'altezza resta sotto 2 * log2(n + 1). Ogni round chiude con verify(). */
+
+static const long	ROUNDS = 8;
+static const long	QUERIES = 100000;
+
+/* Chiavi presenti scelte a caso prima di misurare, così il tempo è solo quello delle find. */
+static double	find_ns(ft::map<long, int> const & m)
+{
+	static long	keys[QUERIES];
+	double		start;
+
+	for (long q = 0; q < QUERIES; q++)
+		keys[q] = m.select(bench::next_rand() % m.size())->first;
+	start = bench::now_ns();
+	for (long q = 0; q < QUERIES; q++)
+		bench::sink += m.find(keys[q])->second;
+	return ((bench::now_ns() - start) / QUERIES);
+}
+
+static void	report(char const * load, long round, ft::map<long, int> const & m)
+{
+	ft::tree_stats	s = m.stats();
+	char const *	error = m.verify();
+
+	std::printf("%-8s %6ld %10zu %8zu %8zu %10.2f %10.1f   %s\n", load, round, s.size, s.height, s.black_height,
+		s.average_depth, find_ns(m), error ? error : "ok");
+}
+
+int	main(int ac, char **av)
+{
+	long	n = bench::max_size_arg(ac, av, 1000000);
+
+	std::printf("n = %ld, log2(n + 1) = %.1f, limite rosso-nero 2 * log2(n + 1) = %.1f\n\n",
+		n, std::log2(n + 1.0), 2 * std::log2(n + 1.0));
+	std::printf("%-8s %6s %10s %8s %8s %10s %10s   %s\n", "load", "round", "size", "height", "black_h", "avg_depth", "find ns", "verify");
+	{
+		ft::map<long, int>	m;
+
+		while (static_cast<long>(m.size()) < n)
+			m[static_cast<long>(bench::next_rand() >> 1)] = 0;
+		report("random", 0, m);
+		for (long round = 1; round <= ROUNDS; round++)
+		{
+			for (long i = 0; i < n; i++)
+			{
+				m.erase(m.select(bench::next_rand() % m.size()));
+				while (!m.insert(ft::make_pair(static_cast<long>(bench::next_rand() >> 1), 0)).second)
+					;
+			}
+			report("random", round, m);
+		}
+	}
+	{
+		ft::map<long, int>	m;
+		long				next = 0;
+
+		while (next < n)
+			m[next++] = 0;
+		report("sliding", 0, m);
+		for (long round = 1; round <= ROUNDS; round++)
+		{
+			for (long i = 0; i < n; i++)
+			{
+				m.erase(m.begin());
+				m.insert(m.end(), ft::make_pair(next++, 0));
+			}
+			report("sliding", round, m);
+		}
+	}
+	return (0);
+}
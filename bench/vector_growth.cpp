@@ -0,0 +1,67 @@
+#include "bench.hpp"
+#include "../vector.hpp"
+#include <vector>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* Picco di memoria residente contro throughput per le politiche di crescita di ft::vector:
+   n push_back di long senza reserve(). Ogni misura gira in un processo figlio,
+   così ru_maxrss riflette solo quella misura. La colonna slack è capacity/size - 1,
+   cioè la memoria allocata e non usata alla fine. */
+
+static long	peak_rss_kb()
+{
+	struct rusage	usage;
+
+	getrusage(RUSAGE_SELF, &usage);
+	return (usage.ru_maxrss);
+}
+
+template <class Vec>
+static void	measure(long n, char const * name)
+{
+	long	baseline = peak_rss_kb();
+	Vec		v;
+	double	start = bench::now_ns();
+
+	for (long i = 0; i < n; i++)
+		v.push_back(i);
+
+	double	ns = (bench::now_ns() - start) / n;
+
+	bench::sink += v.size();
+	std::printf("%-10ld %-14s %10.2f %12.1f %8.1f%%\n", n, name, ns,
+		(peak_rss_kb() - baseline) / 1024.0, (static_cast<double>(v.capacity()) / v.size() - 1) * 100);
+}
+
+template <class Vec>
+static void	run(long n, char const * name)
+{
+	pid_t	pid;
+
+	std::fflush(stdout);
+	pid = fork();
+	if (pid == 0)
+	{
+		measure<Vec>(n, name);
+		std::fflush(stdout);
+		_exit(0);
+	}
+	waitpid(pid, NULL, 0);
+}
+
+int	main(int ac, char **av)
+{
+	long	max = bench::max_size_arg(ac, av, 50000000);
+
+	std::printf("%-10s %-14s %10s %12s %9s\n", "size", "policy", "ns/op", "peak MiB", "slack");
+	for (long n = 1000000; n <= max; n = n * 3 + n / 3)
+	{
+		run<ft::vector<long, std::allocator<long>, ft::growth_double> >(n, "double");
+		run<ft::vector<long, std::allocator<long>, ft::growth_three_halves> >(n, "three_halves");
+		run<ft::vector<long, std::allocator<long>, ft::growth_paged<> > >(n, "paged");
+		run<std::vector<long> >(n, "std");
+	}
+	return (0);
+}
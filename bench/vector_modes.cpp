@@ -0,0 +1,109 @@
+#include "bench.hpp"
+#include "../vector.hpp"
+#include <string>
+
+/* ft::vector<std::string> compilato in C++98 (solo copie) e in C++11 (spostamenti ed emplace):
+   il Makefile costruisce questo file due volte, bench/vector_modes98 e bench/vector_modes11.
+   Le stringhe sono lunghe 48 caratteri, oltre la small string optimization, quindi ogni copia alloca. */
+
+#if __cplusplus >= 201103L
+static char const *	MODE = "c++11";
+#else
+static char const *	MODE = "c++98";
+#endif
+
+static std::string	make(long i)
+{
+	return (std::string(48, static_cast<char>('a' + i % 26)));
+}
+
+static double	run_push_back(long n)
+{
+	ft::vector<std::string>	v;
+	double					start = bench::now_ns();
+
+	for (long i = 0; i < n; i++)
+		v.push_back(make(i));
+	bench::sink += v.size();
+	return ((bench::now_ns() - start) / n);
+}
+
+static double	run_emplace_back(long n)
+{
+	ft::vector<std::string>	v;
+	double					start = bench::now_ns();
+
+	for (long i = 0; i < n; i++)
+	{
+#if __cplusplus >= 201103L
+		v.emplace_back(48, static_cast<char>('a' + i % 26));
+#else
+		v.push_back(make(i));
+#endif
+	}
+	bench::sink += v.size();
+	return ((bench::now_ns() - start) / n);
+}
+
+static double	run_insert_front(long n)
+{
+	ft::vector<std::string>	v;
+	double					start = bench::now_ns();
+
+	for (long i = 0; i < n; i++)
+		v.insert(v.begin(), make(i));
+	bench::sink += v.size();
+	return ((bench::now_ns() - start) / n);
+}
+
+static double	run_erase_front(long n)
+{
+	ft::vector<std::string>	v;
+
+	for (long i = 0; i < n; i++)
+		v.push_back(make(i));
+
+	double	start = bench::now_ns();
+
+	while (!v.empty())
+		v.erase(v.begin());
+	return ((bench::now_ns() - start) / n);
+}
+
+static double	run_copy_return(long n)
+{
+	ft::vector<std::string>	v;
+	ft::vector<std::string>	out;
+
+	for (long i = 0; i < n; i++)
+		v.push_back(make(i));
+
+	double	start = bench::now_ns();
+
+	for (int round = 0; round < 10; round++)
+	{
+		ft::vector<std::string>	tmp(v);
+
+		out = tmp;
+	}
+	bench::sink += out.size();
+	return ((bench::now_ns() - start) / (10 * n));
+}
+
+int	main(int ac, char **av)
+{
+	long	max = bench::max_size_arg(ac, av, 1000000);
+
+	std::printf("%-10s %-6s %-16s %12s\n", "size", "mode", "op", "ns/op");
+	for (long n = 1000; n <= max; n *= 10)
+	{
+		long	frontN = n < 20000 ? n : 20000;
+
+		std::printf("%-10ld %-6s %-16s %12.1f\n", n, MODE, "push_back(tmp)", run_push_back(n));
+		std::printf("%-10ld %-6s %-16s %12.1f\n", n, MODE, "emplace_back", run_emplace_back(n));
+		std::printf("%-10ld %-6s %-16s %12.1f\n", n, MODE, "copy+assign", run_copy_return(n));
+		std::printf("%-10ld %-6s %-16s %12.1f\n", frontN, MODE, "insert(begin)", run_insert_front(frontN));
+		std::printf("%-10ld %-6s %-16s %12.1f\n", frontN, MODE, "erase(begin)", run_erase_front(frontN));
+	}
+	return (0);
+}
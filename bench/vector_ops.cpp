@@ -0,0 +1,104 @@
+#include "bench.hpp"
+#include "../vector.hpp"
+#include <vector>
+#include <string>
+
+/* push_back, insert(begin()) ed erase(begin()) su tre tipi di elemento:
+   int e una struct POD (spostati con memcpy/memmove) e std::string
+   (copiata elemento per elemento). Le due operazioni in testa spostano
+   tutta la coda ad ogni chiamata, quindi usano n più piccoli. */
+
+struct Pod
+{
+	int		id;
+	double	weight;
+	char	tag[16];
+};
+
+template <class T>
+static T	make(long i);
+
+template <>
+int	make<int>(long i) { return (static_cast<int>(i)); }
+
+template <>
+Pod	make<Pod>(long i)
+{
+	Pod	p;
+
+	p.id = static_cast<int>(i);
+	p.weight = i * 0.5;
+	for (int k = 0; k < 16; k++)
+		p.tag[k] = static_cast<char>('a' + (i + k) % 26);
+	return (p);
+}
+
+template <>
+std::string	make<std::string>(long i) { return (std::string(24, static_cast<char>('a' + i % 26))); }
+
+template <class Vec>
+static double	run_push_back(long n)
+{
+	Vec		v;
+	double	start = bench::now_ns();
+
+	for (long i = 0; i < n; i++)
+		v.push_back(make<typename Vec::value_type>(i));
+	bench::sink += v.size();
+	return ((bench::now_ns() - start) / n);
+}
+
+template <class Vec>
+static double	run_insert_front(long n)
+{
+	Vec		v;
+	double	start = bench::now_ns();
+
+	for (long i = 0; i < n; i++)
+		v.insert(v.begin(), make<typename Vec::value_type>(i));
+	bench::sink += v.size();
+	return ((bench::now_ns() - start) / n);
+}
+
+template <class Vec>
+static double	run_erase_front(long n)
+{
+	Vec		v;
+
+	for (long i = 0; i < n; i++)
+		v.push_back(make<typename Vec::value_type>(i));
+
+	double	start = bench::now_ns();
+
+	while (!v.empty())
+		v.erase(v.begin());
+	bench::sink += v.size();
+	return ((bench::now_ns() - start) / n);
+}
+
+template <class T>
+static void	run(char const * type, long n, long frontN)
+{
+	std::printf("%-10ld %-8s %-14s %12.1f %12.1f\n", n, type, "push_back",
+		run_push_back<ft::vector<T> >(n), run_push_back<std::vector<T> >(n));
+	std::printf("%-10ld %-8s %-14s %12.1f %12.1f\n", frontN, type, "insert(begin)",
+		run_insert_front<ft::vector<T> >(frontN), run_insert_front<std::vector<T> >(frontN));
+	std::printf("%-10ld %-8s %-14s %12.1f %12.1f\n", frontN, type, "erase(begin)",
+		run_erase_front<ft::vector<T> >(frontN), run_erase_front<std::vector<T> >(frontN));
+}
+
+int	main(int ac, char **av)
+{
+	long	max = bench::max_size_arg(ac, av, 1000000);
+
+	std::printf("%-10s %-8s %-14s %12s %12s\n", "size", "type", "op", "ft ns/op", "std ns/op");
+	for (long n = 1000; n <= max; n *= 10)
+	{
+		long	frontN = n < 20000 ? n : 20000;
+
+		run<int>("int", n, frontN);
+		run<Pod>("pod", n, frontN);
+		run<std::string>("string", n, frontN);
+	}
+	return (0);
+}
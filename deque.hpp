@@ -0,0 +1,1014 @@
+#pragma once
+
+#include <memory>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+#include "iterator.hpp"
+#include "utility.hpp"
+#include "memory_stats.hpp"
+
+namespace ft
+{
+	/* Coda a doppia entrata a blocchi.
+	   Gli elementi stanno in blocchi di dimensione fissa (vedi deque_block_size), raggiunti da una mappa:
+	   un array di puntatori ai blocchi in cui quelli in uso occupano caselle contigue, con caselle libere
+	   ai due lati. Inserire o togliere in testa e in coda costa O(1): al più si alloca o si libera un blocco.
+	   Quando le caselle libere da un lato finiscono la mappa viene ricentrata o riallocata più grande, ma si
+	   spostano solo i puntatori ai blocchi: gli elementi non vengono mai rilocati, quindi push e pop alle
+	   estremità non invalidano puntatori e riferimenti agli altri elementi e non hanno mai il costo di
+	   una copia dell'intero contenuto (come vector::reserve).
+	   L'ultimo blocco liberato resta da parte (_spare) per il successivo: una coda che scorre, con push_back
+	   e pop_front, o una pila che oscilla attorno al bordo di un blocco non chiamano l'allocatore.
+	   Un deque appena costruito non alloca niente: mappa e primo blocco arrivano al primo inserimento. */
+	template <class T, class Allocator = std::allocator<T> >
+	class deque : public alloc_stats_hook
+	{
+		public:
+
+		typedef	T												value_type;
+		typedef	Allocator										allocator_type;
+		typedef	std::size_t										size_type;
+		typedef	std::ptrdiff_t									difference_type;
+		typedef	value_type&										reference;
+		typedef	const value_type&								const_reference;
+		typedef	typename allocator_type::pointer				pointer;
+		typedef	typename allocator_type::const_pointer			const_pointer;
+		typedef	ft::DequeIterator<value_type>					iterator;
+		typedef	ft::DequeIterator<const value_type>				const_iterator;
+		typedef	ft::reverse_iterator<iterator>					reverse_iterator;
+		typedef	ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+
+		// * COSTRUTTORI * //
+
+		explicit deque(const allocator_type& alloc = allocator_type()) :
+		_alloc(alloc),
+		_mapAlloc(alloc),
+		_map(NULL),
+		_mapSize(0),
+		_spare(NULL)
+		{};
+
+		// Costruttore con 'count' copie di 'value'
+		explicit deque(size_type count, const value_type& value = value_type(), const allocator_type& alloc = allocator_type()) :
+		_alloc(alloc),
+		_mapAlloc(alloc),
+		_map(NULL),
+		_mapSize(0),
+		_spare(NULL)
+		{
+			try
+			{
+				this->insert(this->end(), count, value);
+			}
+			catch (...)
+			{
+				releaseAll();
+				throw ;
+			}
+		};
+
+		// Costruttore con range da 'first' a 'last'
+		template <class InputIterator>
+		deque(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+				typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = 0) :
+		_alloc(alloc),
+		_mapAlloc(alloc),
+		_map(NULL),
+		_mapSize(0),
+		_spare(NULL)
+		{
+			try
+			{
+				this->insert(this->end(), first, last);
+			}
+			catch (...)
+			{
+				releaseAll();
+				throw ;
+			}
+		};
+
+		// Copy Constructor
+		deque(const deque& other) :
+		alloc_stats_hook(),
+		_alloc(other._alloc),
+		_mapAlloc(other._mapAlloc),
+		_map(NULL),
+		_mapSize(0),
+		_spare(NULL)
+		{
+			try
+			{
+				this->insert(this->end(), other.begin(), other.end());
+			}
+			catch (...)
+			{
+				releaseAll();
+				throw ;
+			}
+		};
+
+		// Copy Assign operator: gli elementi esistenti vengono riassegnati, vedi assign()
+		deque&	operator=(const deque& other)
+		{
+			if (this != &other)
+				this->assign(other.begin(), other.end());
+			return (*this);
+		};
+
+#if __cplusplus >= 201103L
+		// Move Constructor: prende mappa e blocchi di other, che resta vuoto.
+		deque(deque&& other) noexcept :
+		_alloc(std::move(other._alloc)),
+		_mapAlloc(std::move(other._mapAlloc)),
+		_map(NULL),
+		_mapSize(0),
+		_spare(NULL)
+		{
+			this->swapStorage(other);
+		}
+
+		deque&	operator=(deque&& other) noexcept
+		{
+			if (this == &other)
+				return (*this);
+			releaseAll();
+			_alloc = std::move(other._alloc);
+			_mapAlloc = std::move(other._mapAlloc);
+			this->swapStorage(other);
+			return (*this);
+		}
+#endif
+
+		~deque()
+		{
+			releaseAll();
+		}
+
+		// * MEMBER FUNCTION *//
+
+		// ITERATORI
+
+		iterator				begin()			{ return (_start); };
+		const_iterator			begin() const	{ return (_start); };
+		iterator				end()			{ return (_finish); };
+		const_iterator			end() const		{ return (_finish); };
+		reverse_iterator		rbegin()		{ return (reverse_iterator(this->end())); };
+		const_reverse_iterator	rbegin() const	{ return (const_reverse_iterator(this->end())); };
+		reverse_iterator		rend()			{ return (reverse_iterator(this->begin())); };
+		const_reverse_iterator	rend() const	{ return (const_reverse_iterator(this->begin())); };
+
+		// CAPACITY
+
+		size_type	size() const		{ return (_finish - _start); };
+		size_type	max_size() const	{ return (allocator_type().max_size()); };
+		bool		empty() const		{ return (_finish.cur == _start.cur); };
+
+		void	resize(size_type n, value_type val = value_type())
+		{
+			size_type	len = this->size();
+
+			if (n > this->max_size())
+				throw std::length_error("ft::deque::resize()");
+			if (n > len)
+				this->insert(this->end(), n - len, val);
+			else if (n < len)
+				this->erase(this->begin() + n, this->end());
+		}
+
+		// ELEMENT ACCESS
+
+		/* Senza passare da un iteratore: posizione nel primo blocco più n, divisa per la dimensione del blocco. */
+		reference		operator[](size_type n)			{ return (elementAt(n)); };
+		const_reference	operator[](size_type n) const	{ return (elementAt(n)); };
+
+		reference		at(size_type n)
+		{
+			if (n >= this->size())
+				throw std::out_of_range("ft::deque::at()");
+			return (elementAt(n));
+		};
+
+		const_reference	at(size_type n) const
+		{
+			if (n >= this->size())
+				throw std::out_of_range("ft::deque::at()");
+			return (elementAt(n));
+		};
+
+		reference		front()			{ return (*_start.cur); };
+		const_reference	front() const	{ return (*_start.cur); };
+		reference		back()			{ return (*lastElement()); };
+		const_reference	back() const	{ return (*lastElement()); };
+
+		// MODIFIERS
+
+		/* Riassegna gli elementi già presenti e poi aggiunge o toglie in coda quelli che mancano o avanzano. */
+		template <class InputIterator>
+		void	assign(InputIterator first, InputIterator last,
+				typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = 0)
+		{
+			iterator	cur = this->begin();
+
+			for (; first != last && cur != this->end(); ++first, ++cur)
+				*cur = *first;
+			if (first == last)
+				this->erase(cur, this->end());
+			else
+				this->insert(this->end(), first, last);
+		}
+
+		void	assign(size_type n, const value_type& val)
+		{
+			iterator	cur = this->begin();
+			value_type	copy(val);
+
+			for (; n && cur != this->end(); --n, ++cur)
+				*cur = copy;
+			if (!n)
+				this->erase(cur, this->end());
+			else
+				this->insert(this->end(), n, copy);
+		}
+
+		/* Il valore viene costruito direttamente nel blocco: se serve un blocco nuovo si spostano al più
+		   i puntatori della mappa, quindi 'val' resta valido anche se è un elemento del deque. */
+		void	push_back(const value_type& val)
+		{
+			pointer	place = reserveBackSlot();
+
+			try
+			{
+				_alloc.construct(place, val);
+			}
+			catch (...)
+			{
+				releaseBackSlot();
+				throw ;
+			}
+			commitBack();
+		}
+
+		void	push_front(const value_type& val)
+		{
+			pointer	place = reserveFrontSlot();
+
+			try
+			{
+				_alloc.construct(place, val);
+			}
+			catch (...)
+			{
+				releaseFrontSlot();
+				throw ;
+			}
+			commitFront();
+		}
+
+#if __cplusplus >= 201103L
+		void	push_back(value_type&& val)		{ this->emplace_back(std::move(val)); }
+		void	push_front(value_type&& val)	{ this->emplace_front(std::move(val)); }
+
+		template <class... Args>
+		void	emplace_back(Args&&... args)
+		{
+			pointer	place = reserveBackSlot();
+
+			try
+			{
+				::new (static_cast<void*>(place)) value_type(std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				releaseBackSlot();
+				throw ;
+			}
+			commitBack();
+		}
+
+		template <class... Args>
+		void	emplace_front(Args&&... args)
+		{
+			pointer	place = reserveFrontSlot();
+
+			try
+			{
+				::new (static_cast<void*>(place)) value_type(std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				releaseFrontSlot();
+				throw ;
+			}
+			commitFront();
+		}
+#endif
+
+		/* Se l'ultimo elemento era il primo del suo blocco il blocco si libera. */
+		void	pop_back()
+		{
+			if (_finish.cur == _finish.first)
+			{
+				freeNodes(_finish.node, _finish.node + 1);
+				_finish.setNode(_finish.node - 1);
+				_finish.cur = _finish.last;
+			}
+			--_finish.cur;
+			_alloc.destroy(_finish.cur);
+		}
+
+		void	pop_front()
+		{
+			_alloc.destroy(_start.cur);
+			if (++_start.cur == _start.last)
+			{
+				freeNodes(_start.node, _start.node + 1);
+				_start.setNode(_start.node + 1);
+				_start.cur = _start.first;
+			}
+		}
+
+		/* Gli elementi si spostano dal lato più vicino a 'position', vedi insertCount. */
+		iterator	insert(iterator position, const value_type& val)
+		{
+			size_type	index = position - this->begin();
+			value_type	copy(val);
+
+			if (index == this->size())
+				this->push_back(copy);
+			else if (index == 0)
+				this->push_front(copy);
+			else
+				insertCount(index, 1, FillIterator(copy));
+			return (this->begin() + index);
+		}
+
+		void	insert(iterator position, size_type n, const value_type& val)
+		{
+			value_type	copy(val);
+
+			insertCount(position - this->begin(), n, FillIterator(copy));
+		}
+
+		template <class InputIterator>
+		void	insert(iterator position, InputIterator first, InputIterator last,
+						typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = 0)
+		{
+			bool is_valid = ft::is_ft_iterator_tagged<typename ft::iterator_traits<InputIterator>::iterator_category>::value;
+			if (!is_valid)
+				throw ft::InvalidIteratorException<typename ft::is_ft_iterator_tagged<typename ft::iterator_traits<InputIterator>::iterator_category>::type>();
+
+			size_type	index = position - this->begin();
+
+			insertCount(index, ft::distance(first, last), first);
+		}
+
+		iterator	erase(iterator position)
+		{
+			return (this->erase(position, position + 1));
+		}
+
+		/* Si sposta la parte più corta tra quella prima e quella dopo il buco; i blocchi rimasti vuoti
+		   all'estremità vengono liberati. */
+		iterator	erase(iterator first, iterator last)
+		{
+			size_type	count = last - first;
+			size_type	index = first - this->begin();
+
+			if (!count)
+				return (first);
+			if (index < (this->size() - count) / 2)
+			{
+				iterator	newStart = _start + count;
+
+				moveBackward(_start, first, last);
+				destroyRange(_start, newStart);
+				freeNodes(_start.node, newStart.node);
+				_start = newStart;
+			}
+			else
+			{
+				iterator	newFinish = _finish - count;
+
+				moveForward(last, _finish, first);
+				destroyRange(newFinish, _finish);
+				freeNodes(newFinish.node + 1, _finish.node + 1);
+				_finish = newFinish;
+			}
+			return (this->begin() + index);
+		}
+
+		/* Scambia mappe e blocchi: nessun elemento viene toccato. */
+		void	swap(deque& x)
+		{
+			allocator_type	tmpAlloc = x._alloc;
+			map_allocator	tmpMapAlloc = x._mapAlloc;
+
+			if (this == &x)
+				return ;
+			x._alloc = _alloc;
+			x._mapAlloc = _mapAlloc;
+			_alloc = tmpAlloc;
+			_mapAlloc = tmpMapAlloc;
+			swapStorage(x);
+		}
+
+		/* Distrugge gli elementi e libera tutti i blocchi tranne quello iniziale; la mappa resta. */
+		void	clear()
+		{
+			if (!_map)
+				return ;
+			destroyRange(_start, _finish);
+			freeNodes(_start.node + 1, _finish.node + 1);
+			_finish = _start;
+		}
+
+		allocator_type	get_allocator() const { return (_alloc); };
+
+		/* Overhead: l'oggetto e la mappa; slack: le posizioni libere dei blocchi allocati e il blocco di scorta. */
+		memory_footprint	memory_usage() const
+		{
+			std::size_t	blocks = _map ? (_finish.node - _start.node + 1) : 0;
+			std::size_t	slack = blocks * BLOCK - this->size();
+
+			if (_spare)
+				slack += BLOCK;
+			return (memory_footprint(this->size() * sizeof(value_type), sizeof(*this) + _mapSize * sizeof(pointer),
+				slack * sizeof(value_type)));
+		};
+
+
+		private:
+
+		typedef typename allocator_type::template rebind<pointer>::other	map_allocator;
+		typedef pointer*													map_pointer;
+		typedef typename iterator::mapPointer								node_pointer;
+
+		static const size_type	BLOCK = deque_block_size<value_type>::value;	// elementi per blocco
+		static const size_type	MIN_MAP = 8;									// caselle della prima mappa
+
+		/* Sorgente per insertCount che restituisce sempre lo stesso valore, per insert(position, n, val). */
+		struct FillIterator
+		{
+			const value_type*	val;
+
+			explicit FillIterator(const value_type& v) : val(&v) {};
+
+			const value_type&	operator*() const { return (*val); };
+			FillIterator&		operator++() { return (*this); };
+		};
+
+		allocator_type	_alloc;		// allocatore degli elementi (e dei blocchi)
+		map_allocator	_mapAlloc;	// allocatore della mappa
+		map_pointer		_map;		// array dei puntatori ai blocchi; le caselle senza blocco valgono NULL
+		size_type		_mapSize;	// caselle della mappa
+		iterator		_start;		// primo elemento
+		iterator		_finish;	// fine: mai sull'ultima posizione di un blocco, il suo blocco esiste sempre
+		pointer			_spare;		// ultimo blocco liberato, riusato dalla prossima allocazione
+
+		static map_pointer	slot(node_pointer node) { return (const_cast<map_pointer>(node)); }
+
+		reference	elementAt(size_type n) const
+		{
+			size_type	offset = n + (_start.cur - _start.first);
+
+			return (_start.node[offset / BLOCK][offset % BLOCK]);
+		}
+
+		pointer	lastElement() const
+		{
+			if (_finish.cur == _finish.first)
+				return (*(_finish.node - 1) + BLOCK - 1);
+			return (_finish.cur - 1);
+		}
+
+		pointer	allocateBlock()
+		{
+			pointer	block = _spare;
+
+			if (block)
+			{
+				_spare = NULL;
+				return (block);
+			}
+			this->recordAllocate(BLOCK * sizeof(value_type));
+			return (_alloc.allocate(BLOCK));
+		}
+
+		void	deallocateBlock(pointer block)
+		{
+			if (!_spare)
+			{
+				_spare = block;
+				return ;
+			}
+			this->recordDeallocate(BLOCK * sizeof(value_type));
+			_alloc.deallocate(block, BLOCK);
+		}
+
+		map_pointer	allocateMap(size_type n)
+		{
+			map_pointer	map;
+
+			this->recordAllocate(n * sizeof(pointer));
+			map = _mapAlloc.allocate(n);
+			for (size_type i = 0; i < n; ++i)
+				map[i] = NULL;
+			return (map);
+		}
+
+		void	deallocateMap(map_pointer map, size_type n)
+		{
+			this->recordDeallocate(n * sizeof(pointer));
+			_mapAlloc.deallocate(map, n);
+		}
+
+		/* Alloca i blocchi per le caselle [first, last) della mappa, liberando quelli già presi se un'allocazione fallisce. */
+		void	allocateNodes(map_pointer first, map_pointer last)
+		{
+			map_pointer	cur = first;
+
+			try
+			{
+				for (; cur != last; ++cur)
+					*cur = allocateBlock();
+			}
+			catch (...)
+			{
+				freeNodes(first, cur);
+				throw ;
+			}
+		}
+
+		void	freeNodes(node_pointer first, node_pointer last)
+		{
+			for (map_pointer cur = slot(first); cur < last; ++cur)
+			{
+				deallocateBlock(*cur);
+				*cur = NULL;
+			}
+		}
+
+		/* Prima mappa con un solo blocco al centro; il deque parte dall'inizio del blocco. */
+		void	initMap()
+		{
+			map_pointer	node;
+
+			_map = allocateMap(MIN_MAP);
+			_mapSize = MIN_MAP;
+			node = _map + (MIN_MAP - 1) / 2;
+			try
+			{
+				*node = allocateBlock();
+			}
+			catch (...)
+			{
+				deallocateMap(_map, _mapSize);
+				_map = NULL;
+				_mapSize = 0;
+				throw ;
+			}
+			_start = iterator(*node, node);
+			_finish = _start;
+		}
+
+		/* Libera tutto: elementi, blocchi, blocco di scorta e mappa. */
+		void	releaseAll()
+		{
+			if (_map)
+			{
+				clear();
+				freeNodes(_start.node, _start.node + 1);
+				deallocateMap(_map, _mapSize);
+				_map = NULL;
+				_mapSize = 0;
+				_start = iterator();
+				_finish = iterator();
+			}
+			if (_spare)
+			{
+				this->recordDeallocate(BLOCK * sizeof(value_type));
+				_alloc.deallocate(_spare, BLOCK);
+				_spare = NULL;
+			}
+		}
+
+		void	swapStorage(deque& x)
+		{
+			map_pointer	tmpMap = x._map;
+			size_type	tmpMapSize = x._mapSize;
+			iterator	tmpStart = x._start;
+			iterator	tmpFinish = x._finish;
+			pointer		tmpSpare = x._spare;
+
+			x._map = _map;
+			x._mapSize = _mapSize;
+			x._start = _start;
+			x._finish = _finish;
+			x._spare = _spare;
+			_map = tmpMap;
+			_mapSize = tmpMapSize;
+			_start = tmpStart;
+			_finish = tmpFinish;
+			_spare = tmpSpare;
+		}
+
+		/* Garantisce 'nodes' caselle libere dopo (o prima) dei blocchi in uso. Se la mappa è almeno il doppio
+		   dei blocchi che deve contenere i puntatori vengono ricentrati, altrimenti si alloca una mappa più
+		   grande. In entrambi i casi si copiano solo i puntatori ai blocchi. */
+		void	reserveMapBack(size_type nodes)
+		{
+			if (nodes + 1 > _mapSize - (_finish.node - _map))
+				reallocateMap(nodes, false);
+		}
+
+		void	reserveMapFront(size_type nodes)
+		{
+			if (nodes > static_cast<size_type>(_start.node - _map))
+				reallocateMap(nodes, true);
+		}
+
+		void	reallocateMap(size_type nodes, bool atFront)
+		{
+			size_type	oldNodes = _finish.node - _start.node + 1;
+			size_type	newNodes = oldNodes + nodes;
+			map_pointer	newStart;
+
+			if (_mapSize > 2 * newNodes)
+			{
+				newStart = _map + (_mapSize - newNodes) / 2 + (atFront ? nodes : 0);
+				std::memmove(static_cast<void*>(newStart), static_cast<const void*>(_start.node), oldNodes * sizeof(pointer));
+				for (map_pointer cur = _map; cur != newStart; ++cur)
+					*cur = NULL;
+				for (map_pointer cur = newStart + oldNodes; cur != _map + _mapSize; ++cur)
+					*cur = NULL;
+			}
+			else
+			{
+				size_type	newMapSize = _mapSize + (_mapSize > nodes ? _mapSize : nodes) + 2;
+				map_pointer	newMap = allocateMap(newMapSize);
+
+				newStart = newMap + (newMapSize - newNodes) / 2 + (atFront ? nodes : 0);
+				std::memcpy(static_cast<void*>(newStart), static_cast<const void*>(_start.node), oldNodes * sizeof(pointer));
+				deallocateMap(_map, _mapSize);
+				_map = newMap;
+				_mapSize = newMapSize;
+			}
+			_start.setNode(newStart);
+			_finish.setNode(newStart + oldNodes - 1);
+		}
+
+		/* Posizione in cui push_back costruisce il nuovo elemento. Se è l'ultima del blocco di _finish serve
+		   già il blocco successivo, perché _finish non resti mai sull'ultima posizione. */
+		pointer	reserveBackSlot()
+		{
+			if (!_map)
+				initMap();
+			if (_finish.cur == _finish.last - 1)
+			{
+				reserveMapBack(1);
+				*slot(_finish.node + 1) = allocateBlock();
+			}
+			return (_finish.cur);
+		}
+
+		void	releaseBackSlot()
+		{
+			if (_finish.cur == _finish.last - 1)
+				freeNodes(_finish.node + 1, _finish.node + 2);
+		}
+
+		void	commitBack()
+		{
+			if (_finish.cur == _finish.last - 1)
+			{
+				_finish.setNode(_finish.node + 1);
+				_finish.cur = _finish.first;
+			}
+			else
+				++_finish.cur;
+		}
+
+		pointer	reserveFrontSlot()
+		{
+			if (!_map)
+				initMap();
+			if (_start.cur == _start.first)
+			{
+				reserveMapFront(1);
+				*slot(_start.node - 1) = allocateBlock();
+				return (*(_start.node - 1) + BLOCK - 1);
+			}
+			return (_start.cur - 1);
+		}
+
+		void	releaseFrontSlot()
+		{
+			if (_start.cur == _start.first)
+				freeNodes(_start.node - 1, _start.node);
+		}
+
+		void	commitFront()
+		{
+			if (_start.cur == _start.first)
+			{
+				_start.setNode(_start.node - 1);
+				_start.cur = _start.last;
+			}
+			--_start.cur;
+		}
+
+		/* Alloca i blocchi per n nuove posizioni prima di _start (dopo _finish) e restituisce il futuro _start
+		   (_finish). Gli elementi non sono costruiti e _start (_finish) non cambia. */
+		iterator	reserveElementsFront(size_type n)
+		{
+			size_type	vacancies;
+
+			if (!_map)
+				initMap();
+			vacancies = _start.cur - _start.first;
+			if (n > vacancies)
+			{
+				size_type	nodes = (n - vacancies + BLOCK - 1) / BLOCK;
+
+				reserveMapFront(nodes);
+				allocateNodes(slot(_start.node) - nodes, slot(_start.node));
+			}
+			return (_start - n);
+		}
+
+		iterator	reserveElementsBack(size_type n)
+		{
+			size_type	vacancies;
+
+			if (!_map)
+				initMap();
+			vacancies = _finish.last - _finish.cur - 1;
+			if (n > vacancies)
+			{
+				size_type	nodes = (n - vacancies + BLOCK - 1) / BLOCK;
+
+				reserveMapBack(nodes);
+				allocateNodes(slot(_finish.node) + 1, slot(_finish.node) + 1 + nodes);
+			}
+			return (_finish + n);
+		}
+
+		void	destroyRange(iterator first, iterator last)
+		{
+			if (ft::is_trivially_copyable<value_type>::value)
+				return ;
+			for (; first != last; ++first)
+				_alloc.destroy(first.cur);
+		}
+
+		/* Costruisce in memoria non inizializzata 'count' copie dei valori di 'src' a partire da 'dst' e
+		   restituisce la fine. Se una copia lancia un'eccezione quelle già costruite vengono distrutte. */
+		template <class Source>
+		iterator	constructCopies(Source & src, size_type count, iterator dst)
+		{
+			iterator	cur = dst;
+
+			try
+			{
+				for (; count; --count, ++cur, ++src)
+					_alloc.construct(cur.cur, *src);
+			}
+			catch (...)
+			{
+				destroyRange(dst, cur);
+				throw ;
+			}
+			return (cur);
+		}
+
+		/* Come constructCopies, ma sposta gli elementi di [first, last) se lo spostamento è noexcept, altrimenti li copia. */
+		iterator	constructMoved(iterator first, iterator last, iterator dst)
+		{
+			iterator	cur = dst;
+
+			try
+			{
+				for (; first != last; ++first, ++cur)
+					_alloc.construct(cur.cur, FT_MOVE_IF_NOEXCEPT(*first));
+			}
+			catch (...)
+			{
+				destroyRange(dst, cur);
+				throw ;
+			}
+			return (cur);
+		}
+
+		/* Spostano [first, last) in avanti (verso dst < first) o indietro (verso dstLast > last) un tratto
+		   contiguo alla volta: in ogni tratto sorgente e destinazione stanno ciascuna in un solo blocco,
+		   quindi il ciclo interno lavora su puntatori (un memmove per i tipi banalmente copiabili). */
+		static void	moveForward(iterator first, iterator last, iterator dst)
+		{
+			difference_type	left = last - first;
+
+			while (left > 0)
+			{
+				difference_type	n = std::min(left, std::min<difference_type>(first.last - first.cur, dst.last - dst.cur));
+
+				moveChunk(first.cur, first.cur + n, dst.cur);
+				first += n;
+				dst += n;
+				left -= n;
+			}
+		}
+
+		static void	moveBackward(iterator first, iterator last, iterator dstLast)
+		{
+			difference_type	left = last - first;
+
+			while (left > 0)
+			{
+				pointer			src = last.cur;
+				pointer			dst = dstLast.cur;
+				difference_type	srcRoom = last.cur - last.first;
+				difference_type	dstRoom = dstLast.cur - dstLast.first;
+
+				// all'inizio di un blocco il tratto da spostare è la fine del blocco precedente
+				if (!srcRoom)
+				{
+					src = *(last.node - 1) + BLOCK;
+					srcRoom = BLOCK;
+				}
+				if (!dstRoom)
+				{
+					dst = *(dstLast.node - 1) + BLOCK;
+					dstRoom = BLOCK;
+				}
+
+				difference_type	n = std::min(left, std::min(srcRoom, dstRoom));
+
+				moveChunkBackward(src - n, src, dst);
+				last -= n;
+				dstLast -= n;
+				left -= n;
+			}
+		}
+
+		static void	moveChunk(pointer first, pointer last, pointer dst)
+		{
+			if (ft::is_trivially_copyable<value_type>::value)
+				std::memmove(static_cast<void*>(dst), static_cast<const void*>(first), (last - first) * sizeof(value_type));
+			else
+				for (; first != last; ++first, ++dst)
+					*dst = FT_MOVE(*first);
+		}
+
+		static void	moveChunkBackward(pointer first, pointer last, pointer dstLast)
+		{
+			if (ft::is_trivially_copyable<value_type>::value)
+				std::memmove(static_cast<void*>(dstLast - (last - first)), static_cast<const void*>(first), (last - first) * sizeof(value_type));
+			else
+				while (last != first)
+					*--dstLast = FT_MOVE(*--last);
+		}
+
+		/* Inserisce in posizione 'index' i 'count' valori letti in ordine da 'src', spostando la parte più
+		   corta tra quella prima e quella dopo 'index', come la libreria standard: le posizioni nuove
+		   a un'estremità vengono costruite (con gli elementi spostati o con i primi/ultimi valori nuovi),
+		   le altre assegnate. Se una costruzione fallisce il deque resta com'era. */
+		template <class Source>
+		void	insertCount(size_type index, size_type count, Source src)
+		{
+			size_type	len = this->size();
+
+			if (!count)
+				return ;
+			if (index < len / 2)
+				insertFront(index, count, src);
+			else
+				insertBack(index, len - index, count, src);
+		}
+
+		template <class Source>
+		void	insertFront(size_type index, size_type count, Source src)
+		{
+			iterator	newStart = reserveElementsFront(count);
+			iterator	oldStart = _start;
+			iterator	cur = newStart;
+			size_type	headNew = index < count ? count - index : 0;
+
+			try
+			{
+				if (!headNew)
+					cur = constructMoved(oldStart, oldStart + count, cur);
+				else
+				{
+					cur = constructMoved(oldStart, oldStart + index, cur);
+					cur = constructCopies(src, headNew, cur);
+				}
+			}
+			catch (...)
+			{
+				destroyRange(newStart, cur);
+				freeNodes(newStart.node, _start.node);
+				throw ;
+			}
+			_start = newStart;
+			if (!headNew)
+				moveForward(oldStart + count, oldStart + index, oldStart);
+			assignValues(src, count - headNew, oldStart + (index + headNew - count));
+		}
+
+		template <class Source>
+		void	insertBack(size_type index, size_type tail, size_type count, Source src)
+		{
+			iterator	newFinish = reserveElementsBack(count);
+			iterator	oldFinish = _finish;
+			iterator	pos = _start + index;
+			iterator	cur = oldFinish;
+			Source		mid = src;
+
+			for (size_type i = 0; i < count && i < tail; ++i)
+				++mid;
+			try
+			{
+				if (tail < count)
+				{
+					cur = constructCopies(mid, count - tail, cur);
+					cur = constructMoved(pos, oldFinish, cur);
+				}
+				else
+					cur = constructMoved(oldFinish - count, oldFinish, cur);
+			}
+			catch (...)
+			{
+				destroyRange(oldFinish, cur);
+				freeNodes(_finish.node + 1, newFinish.node + 1);
+				throw ;
+			}
+			_finish = newFinish;
+			if (tail > count)
+				moveBackward(pos, oldFinish - count, oldFinish);
+			assignValues(src, tail < count ? tail : count, pos);
+		}
+
+		/* Assegna 'count' valori di 'src' alle posizioni già costruite da 'dst' in poi. */
+		template <class Source>
+		static void	assignValues(Source & src, size_type count, iterator dst)
+		{
+			for (; count; --count, ++dst, ++src)
+				*dst = *src;
+		}
+	};
+
+	template <class T, class Alloc>
+	const typename deque<T, Alloc>::size_type	deque<T, Alloc>::BLOCK;
+
+	template <class T, class Alloc>
+	const typename deque<T, Alloc>::size_type	deque<T, Alloc>::MIN_MAP;
+
+	// * OVERLOADS * //
+
+	template <class T, class Alloc>
+	bool operator==(const ft::deque<T, Alloc> &lhs, const ft::deque<T, Alloc> &rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class T, class Alloc>
+	bool operator!=(const ft::deque<T, Alloc> &lhs, const ft::deque<T, Alloc> &rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class T, class Alloc>
+	bool operator<(const ft::deque<T, Alloc> &lhs, const ft::deque<T, Alloc> &rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class T, class Alloc>
+	bool operator<=(const ft::deque<T, Alloc> &lhs, const ft::deque<T, Alloc> &rhs)
+	{
+		return (!(lhs > rhs));
+	}
+
+	template <class T, class Alloc>
+	bool operator>(const ft::deque<T, Alloc> &lhs, const ft::deque<T, Alloc> &rhs)
+	{
+		return (!(lhs == rhs || lhs < rhs));
+	}
+
+	template <class T, class Alloc>
+	bool operator>=(const ft::deque<T, Alloc> &lhs, const ft::deque<T, Alloc> &rhs)
+	{
+		return (!(lhs < rhs));
+	}
+}
+namespace std
+{
+	template <class T, class Alloc>
+	void	swap(ft::deque<T, Alloc>& x, ft::deque<T, Alloc>& y)
+	{
+		x.swap(y);
+	}
+}
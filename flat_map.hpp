@@ -0,0 +1,259 @@
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+#include "utility.hpp"
+#include "vector.hpp"
+#include "flat_tree.hpp"
+
+namespace ft
+{
+	/* Map su vettore ordinato (vedi FlatTree): stessa interfaccia di ft::map, ricerca binaria
+	   su memoria contigua, pensata per dati letti molto più spesso di quanto vengano modificati.
+	   A differenza di ft::map:
+	   - value_type è ft::pair<Key, T> (chiave non const), perché gli elementi vengono spostati per
+	     assegnamento quando si inserisce o si rimuove; modificare la chiave tramite un iteratore rompe l'ordine;
+	   - inserimenti e rimozioni invalidano tutti gli iteratori dal punto modificato in poi
+	     (e tutti, se il vettore rialloca);
+	   - insert(first, last) ordina e fonde una sola volta, reserve() evita le riallocazioni. */
+	template <class Key, class T, class Compare = std::less<Key>, class Allocator = std::allocator<ft::pair<Key, T> > >
+	class flat_map : public FlatTree<ft::pair<Key, T>, select_first<ft::pair<Key, T> >, Compare, Allocator>
+	{
+		public:
+
+			typedef Key																key_type;
+			typedef T																mapped_type;
+			typedef ft::pair<Key, T>												value_type;
+			typedef FlatTree<value_type, select_first<value_type>, Compare, Allocator>	tree_type;
+			typedef typename tree_type::container_type								container_type;
+			typedef Compare															key_compare;
+			typedef Allocator														allocator_type;
+			typedef typename allocator_type::reference								reference;
+			typedef typename allocator_type::const_reference						const_reference;
+			typedef typename allocator_type::pointer								pointer;
+			typedef typename allocator_type::const_pointer							const_pointer;
+			typedef typename container_type::size_type								size_type;
+			typedef typename container_type::difference_type						difference_type;
+			typedef typename container_type::iterator								iterator;
+			typedef typename container_type::const_iterator						const_iterator;
+			typedef typename container_type::reverse_iterator						reverse_iterator;
+			typedef typename container_type::const_reverse_iterator				const_reverse_iterator;
+
+
+			// * COSTRUTTORI * //
+
+			flat_map() {};
+
+			explicit flat_map(const Compare& comp, const Allocator& alloc = Allocator()) : tree_type(comp, alloc) {};
+
+			template <class InputIt>
+			flat_map(InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator())
+				: tree_type(comp, alloc)
+			{
+				this->insert(first, last);
+			};
+
+			flat_map(const flat_map& other) : tree_type(other) {};
+
+			flat_map&	operator=(flat_map const & other)
+			{
+				tree_type::operator=(other);
+				return (*this);
+			};
+
+			~flat_map() {};
+
+
+			// * ITERATORI * //
+
+			iterator				begin()			{ return (this->_data.begin()); };
+			const_iterator			begin() const	{ return (this->_data.begin()); };
+			iterator				end()			{ return (this->_data.end()); };
+			const_iterator			end() const		{ return (this->_data.end()); };
+			reverse_iterator		rbegin()		{ return (this->_data.rbegin()); };
+			const_reverse_iterator	rbegin() const	{ return (this->_data.rbegin()); };
+			reverse_iterator		rend()			{ return (this->_data.rend()); };
+			const_reverse_iterator	rend() const	{ return (this->_data.rend()); };
+
+
+			// * MEMBER FUNCTION *//
+
+			/* La stessa ricerca binaria dà l'elemento o il punto in cui inserirlo. */
+			T&	operator[](const Key& key)
+			{
+				size_type	i = this->lowerIndex(key);
+
+				if (i == this->size() || this->_c(key, this->_data[i].first))
+					this->_data.insert(this->_data.begin() + i, value_type(key, mapped_type()));
+				return (this->_data[i].second);
+			};
+
+			T&	at(const Key& key)
+			{
+				size_type	i = this->findIndex(key);
+
+				if (i == this->size())
+					throw std::out_of_range("ft::flat_map::at");
+				return (this->_data[i].second);
+			};
+
+			const mapped_type&	at(const Key& key) const
+			{
+				size_type	i = this->findIndex(key);
+
+				if (i == this->size())
+					throw std::out_of_range("ft::flat_map::at");
+				return (this->_data[i].second);
+			};
+
+			/* Ricerca binaria e, se la chiave manca, un solo spostamento della coda (vedi FlatTree::insertUnique). */
+			ft::pair<iterator, bool>	insert(value_type const & value)
+			{
+				ft::pair<size_type, bool>	ret = this->insertUnique(value);
+
+				return (ft::make_pair(begin() + ret.first, ret.second));
+			};
+
+			/* Accoda, ordina e fonde una sola volta, vedi FlatTree::insertRange. */
+			template <class InputIt>
+			void	insert(InputIt first, InputIt last)
+			{
+				this->insertRange(first, last);
+			};
+
+			/* Se la chiave va subito prima di 'position' la ricerca binaria viene saltata, vedi FlatTree::insertHint. */
+			iterator	insert(iterator position, const value_type& val)
+			{
+				return (begin() + this->insertHint(static_cast<size_type>(position - begin()), val));
+			};
+
+			void	erase(iterator pos)
+			{
+				this->eraseIndex(static_cast<size_type>(pos - begin()));
+			};
+
+			void	erase(iterator first, iterator last)
+			{
+				this->eraseIndex(static_cast<size_type>(first - begin()), static_cast<size_type>(last - begin()));
+			};
+
+			size_type	erase(const Key& key)
+			{
+				size_type	i = this->findIndex(key);
+
+				if (i == this->size())
+					return (0);
+				this->eraseIndex(i);
+				return (1);
+			};
+
+			void	swap(flat_map& other)
+			{
+				tree_type::swap(other);
+			};
+
+			//------------------------------------------------------//
+
+			class value_compare : public std::binary_function<value_type, value_type, bool>
+			{
+				friend class flat_map;
+
+				protected:
+					Compare comp;
+					value_compare(Compare c) : comp(c) {}
+				public:
+					bool operator()(const value_type& x, const value_type& y) const
+					{
+						return comp(x.first, y.first);
+					}
+			};
+
+			value_compare	value_comp() const
+			{
+				return (value_compare(this->key_comp()));
+			};
+
+			//------------------------------------------------------//
+
+			iterator	find(const Key& key)
+			{
+				return (begin() + this->findIndex(key));
+			};
+
+			const_iterator	find(const Key& key) const
+			{
+				return (begin() + this->findIndex(key));
+			};
+
+			size_type	count(const Key& key) const
+			{
+				return (this->findIndex(key) != this->size());
+			};
+
+			iterator		lower_bound(const Key& key)			{ return (begin() + this->lowerIndex(key)); };
+			const_iterator	lower_bound(const Key& key) const	{ return (begin() + this->lowerIndex(key)); };
+			iterator		upper_bound(const Key& key)			{ return (begin() + this->upperIndex(key)); };
+			const_iterator	upper_bound(const Key& key) const	{ return (begin() + this->upperIndex(key)); };
+
+			ft::pair<iterator, iterator>	equal_range(const Key& key)
+			{
+				return (ft::make_pair(lower_bound(key), upper_bound(key)));
+			};
+
+			ft::pair<const_iterator, const_iterator>	equal_range(const Key& key) const
+			{
+				return (ft::make_pair(lower_bound(key), upper_bound(key)));
+			};
+
+			/* Statistiche d'ordine, come ft::map::select/rank: qui sono un indice e una ricerca binaria. */
+			iterator		select(size_type k)			{ return (begin() + k); };
+			const_iterator	select(size_type k) const	{ return (begin() + k); };
+
+			size_type	rank(const Key& key) const
+			{
+				return (this->lowerIndex(key));
+			};
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator==( const ft::flat_map<Key, T, Compare, Alloc>& lhs, const ft::flat_map<Key, T, Compare, Alloc>& rhs )
+	{
+		return ((lhs.size() == rhs.size()) && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator!=( const ft::flat_map<Key, T, Compare, Alloc>& lhs, const ft::flat_map<Key, T, Compare, Alloc>& rhs )
+	{
+		return (!(lhs == rhs));
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<( const ft::flat_map<Key, T, Compare, Alloc>& lhs, const ft::flat_map<Key, T, Compare, Alloc>& rhs )
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<=( const ft::flat_map<Key, T, Compare, Alloc>& lhs, const ft::flat_map<Key, T, Compare, Alloc>& rhs )
+	{
+		return (!(rhs < lhs));
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>( const ft::flat_map<Key, T, Compare, Alloc>& lhs, const ft::flat_map<Key, T, Compare, Alloc>& rhs )
+	{
+		return (rhs < lhs);
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>=( const ft::flat_map<Key, T, Compare, Alloc>& lhs, const ft::flat_map<Key, T, Compare, Alloc>& rhs )
+	{
+		return (!(lhs < rhs));
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	void	swap(ft::flat_map<Key, T, Compare, Alloc>& lhs, ft::flat_map<Key, T, Compare, Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+	};
+}
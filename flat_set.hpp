@@ -0,0 +1,199 @@
+#pragma once
+
+#include <algorithm>
+#include "utility.hpp"
+#include "vector.hpp"
+#include "flat_tree.hpp"
+
+namespace ft
+{
+	/* Set su vettore ordinato (vedi FlatTree), con la stessa interfaccia di ft::set.
+	   Come in ft::set gli iteratori sono tutti costanti; inserimenti e rimozioni invalidano
+	   gli iteratori dal punto modificato in poi (tutti, se il vettore rialloca). */
+	template <class Key, class Compare = std::less<Key>, class Allocator = std::allocator<Key> >
+	class flat_set : public FlatTree<Key, identity<Key>, Compare, Allocator>
+	{
+		public:
+
+			typedef Key																key_type;
+			typedef Key																value_type;
+			typedef FlatTree<Key, identity<Key>, Compare, Allocator>				tree_type;
+			typedef typename tree_type::container_type								container_type;
+			typedef Compare															key_compare;
+			typedef Compare															value_compare;
+			typedef Allocator														allocator_type;
+			typedef typename allocator_type::reference								reference;
+			typedef typename allocator_type::const_reference						const_reference;
+			typedef typename allocator_type::pointer								pointer;
+			typedef typename allocator_type::const_pointer							const_pointer;
+			typedef typename container_type::size_type								size_type;
+			typedef typename container_type::difference_type						difference_type;
+			typedef typename container_type::const_iterator						iterator;
+			typedef typename container_type::const_iterator						const_iterator;
+			typedef typename container_type::const_reverse_iterator				reverse_iterator;
+			typedef typename container_type::const_reverse_iterator				const_reverse_iterator;
+
+
+			// * COSTRUTTORI * //
+
+			flat_set() {};
+
+			explicit flat_set(const Compare& comp, const Allocator& alloc = Allocator()) : tree_type(comp, alloc) {};
+
+			template <class InputIt>
+			flat_set(InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator())
+				: tree_type(comp, alloc)
+			{
+				this->insert(first, last);
+			};
+
+			flat_set(const flat_set& other) : tree_type(other) {};
+
+			flat_set&	operator=(flat_set const & other)
+			{
+				tree_type::operator=(other);
+				return (*this);
+			};
+
+			~flat_set() {};
+
+
+			// * ITERATORI * //
+
+			iterator			begin() const	{ return (this->_data.begin()); };
+			iterator			end() const		{ return (this->_data.end()); };
+			reverse_iterator	rbegin() const	{ return (this->_data.rbegin()); };
+			reverse_iterator	rend() const	{ return (this->_data.rend()); };
+
+
+			// * MEMBER FUNCTION *//
+
+			/* Ricerca binaria e, se la chiave manca, un solo spostamento della coda (vedi FlatTree::insertUnique). */
+			ft::pair<iterator, bool>	insert(Key const & value)
+			{
+				ft::pair<size_type, bool>	ret = this->insertUnique(value);
+
+				return (ft::make_pair(begin() + ret.first, ret.second));
+			};
+
+			/* Accoda, ordina e fonde una sola volta, vedi FlatTree::insertRange. */
+			template <class InputIt>
+			void	insert(InputIt first, InputIt last)
+			{
+				this->insertRange(first, last);
+			};
+
+			/* Se la chiave va subito prima di 'pos' la ricerca binaria viene saltata, vedi FlatTree::insertHint. */
+			iterator	insert(iterator pos, const Key & val)
+			{
+				return (begin() + this->insertHint(static_cast<size_type>(pos - begin()), val));
+			};
+
+			/* Restituisce l'iteratore all'elemento che ha preso il posto di quello rimosso. */
+			iterator	erase(iterator pos)
+			{
+				size_type	i = static_cast<size_type>(pos - begin());
+
+				this->eraseIndex(i);
+				return (begin() + i);
+			};
+
+			iterator	erase(iterator first, iterator last)
+			{
+				size_type	i = static_cast<size_type>(first - begin());
+
+				this->eraseIndex(i, static_cast<size_type>(last - begin()));
+				return (begin() + i);
+			};
+
+			size_type	erase(const Key& key)
+			{
+				size_type	i = this->findIndex(key);
+
+				if (i == this->size())
+					return (0);
+				this->eraseIndex(i);
+				return (1);
+			};
+
+			void	swap(flat_set& other)
+			{
+				tree_type::swap(other);
+			};
+
+			//------------------------------------------------------//
+
+			value_compare	value_comp() const
+			{
+				return (this->key_comp());
+			};
+
+			iterator	find(Key const & val) const
+			{
+				return (begin() + this->findIndex(val));
+			};
+
+			size_type	count(Key const & val) const
+			{
+				return (this->findIndex(val) != this->size());
+			};
+
+			iterator	lower_bound(Key const & val) const	{ return (begin() + this->lowerIndex(val)); };
+			iterator	upper_bound(Key const & val) const	{ return (begin() + this->upperIndex(val)); };
+
+			ft::pair<iterator, iterator>	equal_range(Key const & val) const
+			{
+				return (ft::make_pair(lower_bound(val), upper_bound(val)));
+			};
+
+			/* Statistiche d'ordine, come ft::set::select/rank: qui sono un indice e una ricerca binaria. */
+			iterator	select(size_type k) const	{ return (begin() + k); };
+
+			size_type	rank(Key const & val) const
+			{
+				return (this->lowerIndex(val));
+			};
+	};
+
+	template< class Key, class Compare, class Alloc >
+	bool operator==( const ft::flat_set<Key, Compare, Alloc>& lhs, const ft::flat_set<Key, Compare, Alloc>& rhs )
+	{
+		return ((lhs.size() == rhs.size()) && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	};
+
+	template< class Key, class Compare, class Alloc >
+	bool operator!=( const ft::flat_set<Key, Compare, Alloc>& lhs, const ft::flat_set<Key, Compare, Alloc>& rhs )
+	{
+		return (!(lhs == rhs));
+	};
+
+	template< class Key, class Compare, class Alloc >
+	bool operator<( const ft::flat_set<Key, Compare, Alloc>& lhs, const ft::flat_set<Key, Compare, Alloc>& rhs )
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	};
+
+	template< class Key, class Compare, class Alloc >
+	bool operator<=( const ft::flat_set<Key, Compare, Alloc>& lhs, const ft::flat_set<Key, Compare, Alloc>& rhs )
+	{
+		return (!(rhs < lhs));
+	};
+
+	template< class Key, class Compare, class Alloc >
+	bool operator>( const ft::flat_set<Key, Compare, Alloc>& lhs, const ft::flat_set<Key, Compare, Alloc>& rhs )
+	{
+		return (rhs < lhs);
+	};
+
+	template< class Key, class Compare, class Alloc >
+	bool operator>=( const ft::flat_set<Key, Compare, Alloc>& lhs, const ft::flat_set<Key, Compare, Alloc>& rhs )
+	{
+		return (!(lhs < rhs));
+	};
+
+	template< class Key, class Compare, class Alloc >
+	void	swap(ft::flat_set<Key, Compare, Alloc>& lhs, ft::flat_set<Key, Compare, Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+	};
+}
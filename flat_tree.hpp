@@ -0,0 +1,272 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <functional>
+#include "utility.hpp"
+#include "vector.hpp"
+#include "rb_tree.hpp"
+
+namespace ft
+{
+	/* Base comune di flat_map e flat_set: gli elementi stanno in un ft::vector ordinato per chiave,
+	   senza duplicati. Rispetto a RBTree la ricerca è una ricerca binaria su memoria contigua
+	   (nessun puntatore da seguire, nessun nodo da allocare), ma inserimento e rimozione singoli
+	   spostano tutti gli elementi che seguono: costano O(n).
+	   KeyOfValue è lo stesso estrattore usato da RBTree (select_first / identity).
+	   Tutte le primitive lavorano per indice, le classi derivate li trasformano nei propri iteratori. */
+	template <class Value, class KeyOfValue, class Compare = std::less<typename KeyOfValue::key_type>, class Allocator = std::allocator<Value> >
+	class FlatTree
+	{
+		public:
+
+			typedef Value											value_type;
+			typedef typename KeyOfValue::key_type					node_key_type;
+			typedef Compare											key_compare;
+			typedef Allocator										allocator_type;
+			typedef ft::vector<Value, Allocator>					container_type;
+			typedef typename container_type::size_type				size_type;
+			typedef typename container_type::difference_type		difference_type;
+
+			FlatTree() : _c(), _data() {};
+
+			FlatTree(Compare const & comp, Allocator const & alloc) : _c(comp), _data(alloc) {};
+
+			FlatTree(FlatTree const & other) : _c(other._c), _data(other._data) {};
+
+			FlatTree&	operator=(FlatTree const & other)
+			{
+				if (this != &other)
+				{
+					_c = other._c;
+					_data = other._data;
+				}
+				return (*this);
+			};
+
+			~FlatTree() {};
+
+			bool			empty() const		{ return (_data.empty()); };
+			size_type		size() const		{ return (_data.size()); };
+			size_type		max_size() const	{ return (_data.max_size()); };
+			size_type		capacity() const	{ return (_data.capacity()); };
+			key_compare		key_comp() const	{ return (_c); };
+			allocator_type	get_allocator() const { return (_data.get_allocator()); };
+
+			/* Quella del vector sottostante, più il comparatore come overhead. */
+			memory_footprint	memory_usage() const
+			{
+				memory_footprint	usage = _data.memory_usage();
+
+				usage.overhead += sizeof(*this) - sizeof(_data);
+				return (usage);
+			};
+
+#ifdef FT_INSTRUMENT
+			void			set_alloc_stats(alloc_stats* stats)	{ _data.set_alloc_stats(stats); };
+			alloc_stats*	get_alloc_stats() const				{ return (_data.get_alloc_stats()); };
+#endif
+
+			/* Riserva spazio per 'n' elementi: gli inserimenti successivi fino a quella dimensione
+			   non riallocano e non invalidano gli iteratori (ma li spostano comunque di posizione). */
+			void	reserve(size_type n)	{ _data.reserve(n); };
+
+			void	clear()					{ _data.clear(); };
+
+			void	swap(FlatTree & other)
+			{
+				Compare	tmp = _c;
+
+				_c = other._c;
+				other._c = tmp;
+				_data.swap(other._data);
+			};
+
+		protected:
+
+			/* Confronta due elementi tramite le loro chiavi: è il criterio con cui viene ordinato il vettore. */
+			struct ValueCompare
+			{
+				Compare	comp;
+
+				ValueCompare(Compare const & c) : comp(c) {};
+				bool	operator()(Value const & a, Value const & b) const
+				{
+					return (comp(KeyOfValue()(a), KeyOfValue()(b)));
+				};
+			};
+
+			/* Ricerca binaria senza uscita anticipata: il numero di confronti dipende solo da size(),
+			   il che rende i salti prevedibili; la chiave viene confrontata con l'elemento a metà
+			   della finestra residua, che si dimezza a ogni passo. */
+			size_type	lowerIndex(node_key_type const & key) const
+			{
+				Value const *	base = _data.data();
+				size_type		len = _data.size();
+				size_type		first = 0;
+
+				while (len > 0)
+				{
+					size_type	half = len / 2;
+
+					if (_c(KeyOfValue()(base[first + half]), key))
+					{
+						first += half + 1;
+						len -= half + 1;
+					}
+					else
+						len = half;
+				}
+				return (first);
+			};
+
+			size_type	upperIndex(node_key_type const & key) const
+			{
+				Value const *	base = _data.data();
+				size_type		len = _data.size();
+				size_type		first = 0;
+
+				while (len > 0)
+				{
+					size_type	half = len / 2;
+
+					if (!_c(key, KeyOfValue()(base[first + half])))
+					{
+						first += half + 1;
+						len -= half + 1;
+					}
+					else
+						len = half;
+				}
+				return (first);
+			};
+
+			/* Restituisce size() se la chiave non è presente. */
+			size_type	findIndex(node_key_type const & key) const
+			{
+				size_type	i = lowerIndex(key);
+
+				if (i == _data.size() || _c(key, KeyOfValue()(_data[i])))
+					return (_data.size());
+				return (i);
+			};
+
+			/* Una sola ricerca binaria trova sia l'elemento già presente sia il punto di inserimento. */
+			ft::pair<size_type, bool>	insertUnique(Value const & val)
+			{
+				node_key_type const &	key = KeyOfValue()(val);
+				size_type				i = lowerIndex(key);
+
+				if (i != _data.size() && !_c(key, KeyOfValue()(_data[i])))
+					return (ft::make_pair(i, false));
+				_data.insert(_data.begin() + i, val);
+				return (ft::make_pair(i, true));
+			};
+
+			/* Se 'val' va esattamente prima di 'hint' la ricerca binaria viene saltata:
+			   con chiavi crescenti ed end() come suggerimento l'inserimento diventa un push_back. */
+			size_type	insertHint(size_type hint, Value const & val)
+			{
+				node_key_type const &	key = KeyOfValue()(val);
+
+				if ((hint == _data.size() || _c(key, KeyOfValue()(_data[hint])))
+					&& (hint == 0 || _c(KeyOfValue()(_data[hint - 1]), key)))
+				{
+					_data.insert(_data.begin() + hint, val);
+					return (hint);
+				}
+				return (insertUnique(val).first);
+			};
+
+			/* Inserimento in blocco: i nuovi elementi vengono accodati, ordinati tra loro
+			   (stable_sort, così tra chiavi uguali vince la prima incontrata) e fusi una sola volta
+			   con la parte già ordinata; infine i duplicati vengono compattati tenendo il primo,
+			   cioè l'elemento che era già presente. Costa O(n + m log m) invece di m inserimenti da O(n).
+			   Se il range arriva già ordinato e tutto dopo l'ultimo elemento, ordinamento e fusione vengono saltati. */
+			template <class InputIt>
+			void	insertRange(InputIt first, InputIt last)
+			{
+				typedef typename ft::iterator_traits<InputIt>::iterator_category	category;
+
+				size_type	old = _data.size();
+
+				// se una copia (o la lettura dal range) lancia, gli elementi già accodati vengono tolti:
+				// il vettore torna quello di prima, ancora ordinato
+				try
+				{
+					if (is_forward_iterator_tagged<category>::value)
+						_data.reserve(old + static_cast<size_type>(ft::distance(first, last)));
+					for (; first != last; ++first)
+						_data.push_back(*first);
+				}
+				catch (...)
+				{
+					_data.erase(_data.begin() + old, _data.end());
+					throw ;
+				}
+				if (_data.size() == old)
+					return ;
+
+				ValueCompare	comp(_c);
+				Value *			base = _data.data();
+				Value *			mid = base + old;
+				Value *			end = base + _data.size();
+
+				Value *			from = (old == 0) ? base : mid - 1;
+
+				if (!isSorted(mid, end, comp))
+					std::stable_sort(mid, end, comp);
+				if (old != 0 && comp(*mid, *(mid - 1)))
+				{
+					std::inplace_merge(base, mid, end, comp);
+					from = base;
+				}
+				uniqueTail(from, comp);
+			};
+
+			void	eraseIndex(size_type i)
+			{
+				_data.erase(_data.begin() + i);
+			};
+
+			void	eraseIndex(size_type first, size_type last)
+			{
+				_data.erase(_data.begin() + first, _data.begin() + last);
+			};
+
+			Compare			_c;
+			container_type	_data;
+
+		private:
+
+			/* Vero se nessun elemento è strettamente minore del precedente (i duplicati sono ammessi). */
+			static bool	isSorted(Value const * first, Value const * last, ValueCompare const & comp)
+			{
+				if (first == last)
+					return (true);
+				for (Value const * next = first + 1; next != last; first = next++)
+					if (comp(*next, *first))
+						return (false);
+				return (true);
+			};
+
+			/* Compatta le chiavi uguali (adiacenti dopo l'ordinamento) a partire da 'from', tenendo la prima.
+			   Prima di 'from' il vettore è già privo di duplicati. */
+			void	uniqueTail(Value * from, ValueCompare const & comp)
+			{
+				Value *	end = _data.data() + _data.size();
+				Value *	out = from;
+
+				for (Value * in = from + 1; in < end; ++in)
+				{
+					if (comp(*out, *in))
+					{
+						if (++out != in)
+							*out = FT_MOVE(*in);
+					}
+				}
+				if (out + 1 < end)
+					_data.erase(_data.begin() + (out + 1 - _data.data()), _data.end());
+			};
+	};
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ft
+{
+	/*
+		Politiche di crescita per ft::vector (terzo parametro template).
+		next_capacity() riceve il numero di elementi attuale, la capacità minima necessaria
+		e la dimensione in byte di un elemento, e restituisce la nuova capacità, mai inferiore
+		a quella necessaria. Il vettore la usa per ogni crescita implicita (push_back, insert,
+		resize); reserve() e assign() allocano invece esattamente quanto richiesto.
+	*/
+
+	/* Raddoppio, come la libreria standard: la nuova capacità è size + max(size, n). */
+	struct growth_double
+	{
+		static std::size_t	next_capacity(std::size_t size, std::size_t required, std::size_t)
+		{
+			return (required > size * 2 ? required : size * 2);
+		}
+	};
+
+	/* Fattore 1.5: al momento della riallocazione spreca al massimo un terzo del buffer e,
+	   dopo qualche crescita, la somma dei blocchi già liberati supera la nuova richiesta,
+	   così l'allocatore può riutilizzarli invece di chiedere memoria nuova. */
+	struct growth_three_halves
+	{
+		static std::size_t	next_capacity(std::size_t size, std::size_t required, std::size_t)
+		{
+			std::size_t	grown = size + size / 2;
+
+			return (required > grown ? required : grown);
+		}
+	};
+
+	/* Per buffer enormi: finché il buffer è sotto Threshold byte raddoppia, oltre cresce di
+	   un ottavo e arrotonda la dimensione a un multiplo di PageSize byte. Lo spreco massimo
+	   scende dal 50% a circa il 12%, al prezzo di qualche riallocazione in più. */
+	template <std::size_t Threshold = 1024 * 1024, std::size_t PageSize = 4096>
+	struct growth_paged
+	{
+		static std::size_t	next_capacity(std::size_t size, std::size_t required, std::size_t elem_size)
+		{
+			std::size_t	grown;
+			std::size_t	bytes;
+
+			if (size * elem_size < Threshold)
+				return (required > size * 2 ? required : size * 2);
+			grown = size + size / 8;
+			if (grown < required)
+				grown = required;
+			bytes = (grown * elem_size + PageSize - 1) / PageSize * PageSize;
+			return (bytes / elem_size);
+		}
+	};
+}
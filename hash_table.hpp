@@ -0,0 +1,654 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <cstring>
+#include <functional>
+#include "utility.hpp"
+#include "iterator.hpp"
+#include "memory_stats.hpp"
+
+namespace ft
+{
+	/* Funzioni hash di default per unordered_map e unordered_set (std::hash esiste solo da C++11).
+	   Per interi e puntatori è l'identità: la tabella rimescola comunque il valore (vedi HashTable::home),
+	   quindi chiavi consecutive non finiscono in slot consecutivi. */
+	template <class T>
+	struct hash;
+
+	template <class T>
+	struct hash_integral
+	{
+		std::size_t	operator()(T val) const { return (static_cast<std::size_t>(val)); }
+	};
+
+	template <> struct hash<bool> : public hash_integral<bool> {};
+	template <> struct hash<char> : public hash_integral<char> {};
+	template <> struct hash<signed char> : public hash_integral<signed char> {};
+	template <> struct hash<unsigned char> : public hash_integral<unsigned char> {};
+	template <> struct hash<wchar_t> : public hash_integral<wchar_t> {};
+	template <> struct hash<short int> : public hash_integral<short int> {};
+	template <> struct hash<unsigned short int> : public hash_integral<unsigned short int> {};
+	template <> struct hash<int> : public hash_integral<int> {};
+	template <> struct hash<unsigned int> : public hash_integral<unsigned int> {};
+	template <> struct hash<long int> : public hash_integral<long int> {};
+	template <> struct hash<unsigned long int> : public hash_integral<unsigned long int> {};
+	template <> struct hash<long long int> : public hash_integral<long long int> {};
+	template <> struct hash<unsigned long long int> : public hash_integral<unsigned long long int> {};
+
+	template <class T>
+	struct hash<T*>
+	{
+		std::size_t	operator()(T* ptr) const { return (reinterpret_cast<std::size_t>(ptr)); }
+	};
+
+	/* FNV-1a sui byte della stringa */
+	template <>
+	struct hash<std::string>
+	{
+		std::size_t	operator()(std::string const & str) const
+		{
+			unsigned long long	h = 14695981039346656037ULL;
+
+			for (std::string::size_type i = 0; i < str.size(); i++)
+			{
+				h ^= static_cast<unsigned char>(str[i]);
+				h *= 1099511628211ULL;
+			}
+			return (static_cast<std::size_t>(h));
+		};
+	};
+
+	/* Base comune di unordered_map e unordered_set: tabella hash a indirizzamento aperto con
+	   sondaggio lineare e politica Robin Hood.
+	   - Gli elementi stanno in un unico array contiguo di slot ('_slots'); accanto c'è un array di byte
+	     ('_dist') con la distanza di ogni elemento dal proprio slot di partenza, più uno (0 = slot vuoto).
+	   - Robin Hood: dentro un gruppo di slot occupati gli elementi restano ordinati per slot di partenza,
+	     quindi una ricerca si ferma appena incontra un elemento più vicino a casa di quanto lo sarebbe
+	     la chiave cercata, e una chiave assente costa quanto una presente.
+	   - Nessun giro circolare: dopo i '_buckets' slot di partenza ce ne sono '_limit' di riserva (al più
+	     MAX_PROBE all'allocazione), dove finiscono le sequenze che sforano. Se una sequenza arriva in fondo
+	     alla riserva, la riserva raddoppia (vedi growReserve): gli slot di partenza non cambiano e nessun
+	     hash viene ricalcolato. Raddoppiare la tabella non servirebbe: chiavi con lo stesso hash restano
+	     nello stesso gruppo qualunque sia il numero di slot.
+	   - Una distanza da SATURATED in su non sta nel byte: lì vale SATURATED e quella vera si ricava
+	     dallo slot di partenza della chiave (vedi distAt). Succede solo con molte chiavi sullo stesso slot,
+	     cioè con una funzione hash povera: la tabella rallenta, come std::unordered_map, ma funziona.
+	   - La rimozione sposta indietro di uno gli elementi successivi del gruppo (backward shift),
+	     senza lasciare lapidi: le ricerche non rallentano dopo molte rimozioni.
+	   Inserimenti e rimozioni invalidano gli iteratori (gli elementi si spostano), una crescita li invalida tutti.
+	   Se il costruttore usato per spostare un elemento non rilocabile lancia un'eccezione durante uno
+	   di questi spostamenti, la tabella viene svuotata prima di rilanciarla (garanzia base). */
+	template <class Value, class KeyOfValue, class Hash, class KeyEqual, class Allocator>
+	class HashTable : public alloc_stats_hook
+	{
+		public:
+
+			typedef Value												value_type;
+			typedef typename KeyOfValue::key_type						node_key_type;
+			typedef Hash												hasher;
+			typedef KeyEqual											key_equal;
+			typedef Allocator											allocator_type;
+			typedef typename Allocator::pointer							pointer;
+			typedef typename Allocator::template rebind<unsigned char>::other	byte_allocator_type;
+			typedef std::size_t											size_type;
+			typedef std::ptrdiff_t										difference_type;
+			typedef HashIterator<Value>									iterator;
+			typedef HashIteratorConst<Value>							const_iterator;
+
+			static const size_type		MIN_BUCKETS = 8;
+			static const unsigned int	MAX_PROBE = 255;
+			static const unsigned char	SATURATED = 255;
+
+			HashTable()
+			{
+				init(Hash(), KeyEqual(), Allocator());
+			};
+
+			HashTable(size_type buckets, Hash const & hash, KeyEqual const & eq, Allocator const & alloc)
+			{
+				init(hash, eq, alloc);
+				if (buckets)
+					allocateBuckets(roundBuckets(buckets), reserveFor(roundBuckets(buckets)));
+			};
+
+			/* Copia strutturale, vedi copyFrom. */
+			HashTable(HashTable const & other) : alloc_stats_hook()
+			{
+				init(other._hash, other._eq, other._alloc);
+				copyFrom(other);
+			};
+
+			/* La copia viene costruita a parte (garanzia forte) registrando le allocazioni sul sink di *this. */
+			HashTable&	operator=(HashTable const & other)
+			{
+				if (this != &other)
+				{
+					HashTable	tmp(0, other._hash, other._eq, other._alloc);
+
+					tmp.shareStats(*this);
+					tmp.copyFrom(other);
+					swap(tmp);
+				}
+				return (*this);
+			};
+
+			~HashTable()
+			{
+				clear();
+				deallocateBuckets();
+			};
+
+			iterator		begin()
+			{
+				if (_size == 0)
+					return (end());
+				return (iterator(_slots + firstUsed(), _dist + firstUsed()));
+			};
+
+			const_iterator	begin() const
+			{
+				if (_size == 0)
+					return (end());
+				return (const_iterator(_slots + firstUsed(), _dist + firstUsed()));
+			};
+
+			iterator		end()			{ return (iterator(_slots + (_buckets + _limit), _dist + (_buckets + _limit))); };
+			const_iterator	end() const		{ return (const_iterator(_slots + (_buckets + _limit), _dist + (_buckets + _limit))); };
+
+			bool			empty() const			{ return (_size == 0); };
+			size_type		size() const			{ return (_size); };
+			size_type		max_size() const		{ return (_alloc.max_size()); };
+			hasher			hash_function() const	{ return (_hash); };
+			key_equal		key_eq() const			{ return (_eq); };
+			allocator_type	get_allocator() const	{ return (_alloc); };
+
+			/* L'overhead è l'array dei byte di distanza, lo slack sono gli slot vuoti (di partenza e di riserva). */
+			memory_footprint	memory_usage() const
+			{
+				size_type	slots = _buckets ? _buckets + _limit : 0;
+
+				return (memory_footprint(_size * sizeof(Value),
+					sizeof(*this) + (_buckets ? slots + 1 : 0),
+					(slots - _size) * sizeof(Value)));
+			};
+
+			/* Numero di slot di partenza (sempre una potenza di 2); gli slot di riserva non sono contati. */
+			size_type		bucket_count() const	{ return (_buckets); };
+
+			float			load_factor() const
+			{
+				return (_buckets ? static_cast<float>(_size) / _buckets : 0.0f);
+			};
+
+			float			max_load_factor() const	{ return (_mlf); };
+
+			/* Oltre 0.95 le sequenze di sondaggio si allungano troppo: il valore viene limitato. */
+			void			max_load_factor(float ml)
+			{
+				if (!(ml > 0.1f))
+					ml = 0.1f;
+				if (ml > 0.95f)
+					ml = 0.95f;
+				_mlf = ml;
+				_growAt = static_cast<size_type>(_buckets * _mlf);
+				if (_size > _growAt)
+					rebuild(bucketsFor(_size));
+			};
+
+			/* Porta la tabella ad almeno 'count' slot di partenza (e a quanti ne servono per size()). */
+			void			rehash(size_type count)
+			{
+				size_type	buckets = roundBuckets(count);
+
+				if (_size && buckets < bucketsFor(_size))
+					buckets = bucketsFor(_size);
+				if (buckets != _buckets)
+					rebuild(buckets);
+			};
+
+			/* Dopo reserve(n) i primi n elementi entrano senza ricostruire la tabella: bucket_count() non cambia
+			   e nessun hash viene ricalcolato. Con molte chiavi sullo stesso slot può crescere la riserva
+			   (vedi growReserve), che rialloca gli slot ma lascia ogni elemento al suo indice. */
+			void			reserve(size_type n)
+			{
+				if (n > _growAt)
+					rebuild(bucketsFor(n));
+			};
+
+			void			clear()
+			{
+				if (_buckets == 0)
+					return ;
+				if (!ft::is_trivially_copyable<Value>::value)
+				{
+					for (size_type i = 0; i < _buckets + _limit; i++)
+						if (_dist[i])
+							_alloc.destroy(_slots + i);
+				}
+				std::memset(_dist, 0, _buckets + _limit);
+				_size = 0;
+			};
+
+			void			swap(HashTable & other)
+			{
+				swapValue(_hash, other._hash);
+				swapValue(_eq, other._eq);
+				swapValue(_alloc, other._alloc);
+				swapValue(_slots, other._slots);
+				swapValue(_dist, other._dist);
+				swapValue(_size, other._size);
+				swapValue(_buckets, other._buckets);
+				swapValue(_limit, other._limit);
+				swapValue(_shift, other._shift);
+				swapValue(_mlf, other._mlf);
+				swapValue(_growAt, other._growAt);
+			};
+
+		protected:
+
+			/* Indice dello slot che contiene la chiave, oppure npos(). */
+			size_type	findIndex(node_key_type const & key) const
+			{
+				if (_size == 0)
+					return (npos());
+
+				size_type	i = home(key);
+				size_type	d = 1;
+				size_type	di;
+
+				while ((di = distAt(i)) >= d)
+				{
+					if (di == d && _eq(KeyOfValue()(_slots[i]), key))
+						return (i);
+					++i;
+					++d;
+				}
+				return (npos());
+			};
+
+			/* Una ricerca; se la chiave manca l'elemento viene costruito nello slot preparato da makeRoom. */
+			ft::pair<size_type, bool>	insertUnique(Value const & val)
+			{
+				size_type	i = findIndex(KeyOfValue()(val));
+
+				if (i != npos())
+					return (ft::make_pair(i, false));
+				return (ft::make_pair(insertNew(val), true));
+			};
+
+			/* Inserisce un elemento che sicuramente non è presente e restituisce il suo slot. */
+			size_type	insertNew(Value const & val)
+			{
+				if (_size + 1 > _growAt)
+					rebuild(bucketsFor(_size + 1));
+
+				size_type	i = makeRoom(KeyOfValue()(val));
+
+				try
+				{
+					_alloc.construct(_slots + i, val);
+				}
+				catch (...)
+				{
+					closeRoom(i);
+					throw ;
+				}
+				++_size;
+				return (i);
+			};
+
+			/* Restituisce lo slot da cui riprende la visita dopo la rimozione: se il backward shift
+			   ha portato lì l'elemento successivo è lo slot stesso, altrimenti il primo occupato dopo. */
+			size_type	eraseIndex(size_type i)
+			{
+				_alloc.destroy(_slots + i);
+				--_size;
+				closeRoom(i);
+				while (_dist[i] == 0)
+					++i;
+				return (i);
+			};
+
+			size_type	npos() const	{ return (_buckets + _limit); };
+
+			Hash			_hash;
+			KeyEqual		_eq;
+			Allocator		_alloc;
+			pointer			_slots;
+			unsigned char*	_dist;
+			size_type		_size;
+			size_type		_buckets;
+			size_type		_limit;
+			unsigned int	_shift;
+			float			_mlf;
+			size_type		_growAt;
+
+		private:
+
+			void	init(Hash const & hash, KeyEqual const & eq, Allocator const & alloc)
+			{
+				_hash = hash;
+				_eq = eq;
+				_alloc = alloc;
+				_slots = NULL;
+				_dist = emptyDist();
+				_size = 0;
+				_buckets = 0;
+				_limit = 0;
+				_shift = 0;
+				_mlf = 0.8f;
+				_growAt = 0;
+			};
+
+			/* Copia strutturale in una tabella appena inizializzata: stessa disposizione degli slot, nessun
+			   elemento viene ricalcolato. Se una copia lancia un'eccezione la tabella torna vuota e senza slot. */
+			void	copyFrom(HashTable const & other)
+			{
+				_mlf = other._mlf;
+				if (other._buckets == 0)
+					return ;
+				allocateBuckets(other._buckets, other._limit);
+				try
+				{
+					for (size_type i = 0; i < _buckets + _limit; i++)
+					{
+						if (other._dist[i])
+						{
+							_alloc.construct(_slots + i, other._slots[i]);
+							_dist[i] = other._dist[i];
+							++_size;
+						}
+					}
+				}
+				catch (...)
+				{
+					clear();
+					deallocateBuckets();
+					throw ;
+				}
+			};
+
+			/* Tabella senza slot: begin() == end() puntano al solo byte terminatore. */
+			static unsigned char*	emptyDist()
+			{
+				static unsigned char	terminator = 1;
+
+				return (&terminator);
+			};
+
+			template <class U>
+			static void	swapValue(U & a, U & b)
+			{
+				U	tmp = a;
+
+				a = b;
+				b = tmp;
+			};
+
+			/* Hashing di Fibonacci: moltiplica per 2^64 / phi e tiene i bit alti,
+			   che dipendono da tutti i bit dell'hash. */
+			size_type	home(node_key_type const & key) const
+			{
+				return (static_cast<size_type>((static_cast<unsigned long long>(_hash(key)) * 11400714819323198485ULL) >> _shift));
+			};
+
+			/* Distanza dello slot occupato 'i' dal suo slot di partenza, più uno. */
+			size_type	distAt(size_type i) const
+			{
+				if (_dist[i] != SATURATED)
+					return (_dist[i]);
+				return (i - home(KeyOfValue()(_slots[i])) + 1);
+			};
+
+			void	setDist(size_type i, size_type d)
+			{
+				_dist[i] = static_cast<unsigned char>(d < SATURATED ? d : SATURATED);
+			};
+
+			size_type	firstUsed() const
+			{
+				size_type	i = 0;
+
+				while (_dist[i] == 0)
+					++i;
+				return (i);
+			};
+
+			static size_type	roundBuckets(size_type count)
+			{
+				size_type	buckets = MIN_BUCKETS;
+
+				while (buckets < count)
+					buckets *= 2;
+				return (buckets);
+			};
+
+			/* Il numero minimo di slot di partenza per contenere 'n' elementi sotto max_load_factor. */
+			size_type	bucketsFor(size_type n) const
+			{
+				size_type	buckets = MIN_BUCKETS;
+
+				while (static_cast<size_type>(buckets * _mlf) < n)
+					buckets *= 2;
+				return (buckets);
+			};
+
+			/* Slot di riserva di una tabella nuova. */
+			static size_type	reserveFor(size_type buckets)
+			{
+				return (buckets < MAX_PROBE ? buckets : MAX_PROBE);
+			};
+
+			void	allocateBuckets(size_type buckets, size_type limit)
+			{
+				byte_allocator_type	bytes(_alloc);
+				unsigned int		bits = 0;
+
+				_limit = limit;
+				_slots = _alloc.allocate(buckets + _limit);
+				try
+				{
+					_dist = bytes.allocate(buckets + _limit + 1);
+				}
+				catch (...)
+				{
+					_alloc.deallocate(_slots, buckets + _limit);
+					_slots = NULL;
+					_limit = 0;
+					throw ;
+				}
+				this->recordAllocate((buckets + _limit) * sizeof(Value));
+				this->recordAllocate(buckets + _limit + 1);
+				std::memset(_dist, 0, buckets + _limit);
+				_dist[buckets + _limit] = 1;
+				_buckets = buckets;
+				while ((static_cast<size_type>(1) << bits) < buckets)
+					++bits;
+				_shift = 64 - bits;
+				_growAt = static_cast<size_type>(_buckets * _mlf);
+			};
+
+			void	deallocateBuckets()
+			{
+				byte_allocator_type	bytes(_alloc);
+
+				if (_buckets == 0)
+					return ;
+				this->recordDeallocate((_buckets + _limit) * sizeof(Value));
+				this->recordDeallocate(_buckets + _limit + 1);
+				_alloc.deallocate(_slots, _buckets + _limit);
+				bytes.deallocate(_dist, _buckets + _limit + 1);
+				_slots = NULL;
+				_dist = emptyDist();
+				_buckets = 0;
+				_limit = 0;
+				_growAt = 0;
+			};
+
+			/* Sposta gli elementi in una nuova tabella da 'buckets' slot di partenza. La nuova tabella è un
+			   HashTable a sé: se durante il trasferimento una sequenza sfora, cresce da sola senza
+			   dover ricominciare. Gli originali vengono distrutti solo alla fine: se la copia di un
+			   elemento lancia un'eccezione la tabella di partenza è intatta. */
+			void	rebuild(size_type buckets)
+			{
+				HashTable	tmp(0, _hash, _eq, _alloc);
+
+				buckets = roundBuckets(buckets);
+				tmp.shareStats(*this);
+				tmp._mlf = _mlf;
+				tmp.allocateBuckets(buckets, reserveFor(buckets));
+				for (size_type i = 0; i < _buckets + _limit; i++)
+					if (_dist[i])
+						tmp.transfer(_slots[i]);
+				clear();
+				swap(tmp);
+			};
+
+			/* Raddoppia gli slot di riserva. Ogni elemento resta al suo indice con la sua distanza: niente
+			   hash da ricalcolare. Come in rebuild, gli originali vengono distrutti solo alla fine. */
+			void	growReserve()
+			{
+				HashTable	tmp(0, _hash, _eq, _alloc);
+
+				tmp.shareStats(*this);
+				tmp._mlf = _mlf;
+				tmp.allocateBuckets(_buckets, _limit * 2);
+				for (size_type i = 0; i < _buckets + _limit; i++)
+				{
+					if (_dist[i])
+					{
+						_alloc.construct(tmp._slots + i, FT_MOVE_IF_NOEXCEPT(_slots[i]));
+						tmp._dist[i] = _dist[i];
+						++tmp._size;
+					}
+				}
+				clear();
+				swap(tmp);
+			};
+
+			/* Come insertNew, ma sposta l'elemento (se il suo costruttore di spostamento è noexcept)
+			   e non controlla il fattore di carico: rebuild ha già dimensionato la tabella. */
+			void	transfer(Value & src)
+			{
+				size_type	i = makeRoom(KeyOfValue()(src));
+
+				try
+				{
+					_alloc.construct(_slots + i, FT_MOVE_IF_NOEXCEPT(src));
+				}
+				catch (...)
+				{
+					closeRoom(i);
+					throw ;
+				}
+				++_size;
+			};
+
+			/* Prepara lo slot per una chiave assente: lo slot giusto è il primo il cui occupante è più vicino
+			   a casa della chiave (o vuoto); gli elementi da lì al primo slot vuoto scorrono avanti di uno.
+			   Se prima della fine della riserva non c'è uno slot vuoto la riserva cresce (vedi growReserve).
+			   Restituisce lo slot con la distanza già scritta ma senza elemento costruito. */
+			size_type	makeRoom(node_key_type const & key)
+			{
+				for (;;)
+				{
+					size_type	i = home(key);
+					size_type	d = 1;
+					size_type	e;
+
+					while (i < _buckets + _limit && distAt(i) >= d)
+					{
+						++i;
+						++d;
+					}
+					for (e = i; e < _buckets + _limit && _dist[e] != 0; ++e) ;
+					if (e < _buckets + _limit)
+					{
+						shiftUp(i, e);
+						setDist(i, d);
+						return (i);
+					}
+					growReserve();
+				}
+			};
+
+			/* Gli elementi in [first, last) passano in [first + 1, last + 1); 'last' è vuoto. */
+			void	shiftUp(size_type first, size_type last)
+			{
+				if (first == last)
+					return ;
+				if (ft::is_relocatable<Value>::value)
+				{
+					std::memmove(static_cast<void*>(_slots + first + 1), static_cast<const void*>(_slots + first), (last - first) * sizeof(Value));
+					std::memmove(_dist + first + 1, _dist + first, last - first);
+					for (size_type j = first + 1; j <= last; j++)
+						if (_dist[j] != SATURATED)
+							++_dist[j];
+					_dist[first] = 0;
+					return ;
+				}
+				try
+				{
+					for (size_type j = last; j > first; j--)
+					{
+						_alloc.construct(_slots + j, FT_MOVE_IF_NOEXCEPT(_slots[j - 1]));
+						_dist[j] = static_cast<unsigned char>(_dist[j - 1] != SATURATED ? _dist[j - 1] + 1 : SATURATED);
+						_alloc.destroy(_slots + j - 1);
+						_dist[j - 1] = 0;
+					}
+				}
+				catch (...)
+				{
+					clear();
+					throw ;
+				}
+			};
+
+			/* L'elemento nello slot 'j' (con il byte di distanza che aveva nello slot dopo) è appena
+			   arretrato di uno: sotto SATURATED basta decrementare, altrimenti la distanza si ricalcola. */
+			void	stepBack(size_type j)
+			{
+				if (_dist[j] != SATURATED)
+					--_dist[j];
+				else
+					setDist(j, j - home(KeyOfValue()(_slots[j])) + 1);
+			};
+
+			/* Backward shift: 'i' è vuoto (elemento già distrutto o mai costruito); gli elementi che seguono
+			   e non sono nel proprio slot di partenza arretrano di uno. Il byte terminatore vale 1 e ferma la scansione. */
+			void	closeRoom(size_type i)
+			{
+				size_type	last = i + 1;
+
+				while (_dist[last] > 1)
+					++last;
+				if (ft::is_relocatable<Value>::value)
+				{
+					std::memmove(static_cast<void*>(_slots + i), static_cast<const void*>(_slots + i + 1), (last - i - 1) * sizeof(Value));
+					std::memmove(_dist + i, _dist + i + 1, last - i - 1);
+					for (size_type j = i; j + 1 < last; j++)
+						stepBack(j);
+					_dist[last - 1] = 0;
+					return ;
+				}
+				_dist[i] = 0;
+				try
+				{
+					for (size_type j = i + 1; j < last; j++)
+					{
+						_alloc.construct(_slots + j - 1, FT_MOVE_IF_NOEXCEPT(_slots[j]));
+						_dist[j - 1] = _dist[j];
+						stepBack(j - 1);
+						_alloc.destroy(_slots + j);
+						_dist[j] = 0;
+					}
+				}
+				catch (...)
+				{
+					clear();
+					throw ;
+				}
+			};
+	};
+}
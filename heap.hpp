@@ -0,0 +1,268 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include "iterator.hpp"
+#include "utility.hpp"
+
+namespace ft
+{
+	/* Scrive un valore nella posizione 'index' del range: è l'unico modo in cui gli algoritmi di
+	   dary_heap muovono gli elementi. Questa versione sposta e basta; ft::indexed_heap ne usa una
+	   che aggiorna anche la posizione di ogni elemento. */
+	struct heap_move_place
+	{
+		template <class RandomIt, class Distance, class T>
+		void	operator()(RandomIt first, Distance index, T & value) const
+		{
+			first[index] = FT_MOVE(value);
+		}
+	};
+
+	/* Heap implicito d-ario su un range ad accesso casuale: i figli di i sono Arity * i + 1 ... Arity * i + Arity
+	   e in cima sta l'elemento massimo secondo Compare (come in <algorithm>). Con Arity = 2 è lo heap binario;
+	   con 4 l'albero è alto la metà e i figli di un nodo sono contigui, spesso nella stessa linea di cache:
+	   push fa meno confronti e pop, che ne fa di più per livello, tocca meno memoria lontana.
+	   Gli elementi si spostano "a buco": il valore da sistemare resta fuori dal range, i nodi attraversati
+	   scorrono di un livello con uno spostamento ciascuno e il valore viene scritto una volta sola alla fine. */
+	template <std::size_t Arity>
+	struct dary_heap
+	{
+		/* [first, last - 1) è uno heap: vi aggiunge *(last - 1). O(log_d n). */
+		template <class RandomIt, class Compare>
+		static void	push_heap(RandomIt first, RandomIt last, Compare comp)
+		{
+			heap_move_place	place;
+
+			pushHeap(first, last, comp, place);
+		}
+
+		/* Scambia la cima con *(last - 1) e ristabilisce lo heap su [first, last - 1). O(d log_d n). */
+		template <class RandomIt, class Compare>
+		static void	pop_heap(RandomIt first, RandomIt last, Compare comp)
+		{
+			heap_move_place	place;
+
+			popHeap(first, last, comp, place);
+		}
+
+		/* Dal basso verso l'alto, un nodo interno alla volta: O(n). */
+		template <class RandomIt, class Compare>
+		static void	make_heap(RandomIt first, RandomIt last, Compare comp)
+		{
+			heap_move_place	place;
+
+			makeHeap(first, last, comp, place);
+		}
+
+		/* Ordina uno heap in ordine crescente secondo Compare: O(n log n). */
+		template <class RandomIt, class Compare>
+		static void	sort_heap(RandomIt first, RandomIt last, Compare comp)
+		{
+			heap_move_place	place;
+
+			for (; last - first > 1; --last)
+				popHeap(first, last, comp, place);
+		}
+
+		/* Fine del prefisso più lungo di [first, last) che è uno heap. */
+		template <class RandomIt, class Compare>
+		static RandomIt	is_heap_until(RandomIt first, RandomIt last, Compare comp)
+		{
+			typedef typename ft::iterator_traits<RandomIt>::difference_type	Distance;
+
+			Distance const	arity = Arity;
+			Distance		len = last - first;
+
+			for (Distance child = 1; child < len; ++child)
+				if (comp(first[(child - 1) / arity], first[child]))
+					return (first + child);
+			return (last);
+		}
+
+		template <class RandomIt, class Compare>
+		static bool	is_heap(RandomIt first, RandomIt last, Compare comp)
+		{
+			return (is_heap_until(first, last, comp) == last);
+		}
+
+		//------------------------------------------------------//
+
+		/* Le versioni seguenti scrivono attraverso 'place' (vedi heap_move_place) e servono ai container
+		   costruiti sugli stessi algoritmi. */
+
+		template <class RandomIt, class Compare, class Place>
+		static void	pushHeap(RandomIt first, RandomIt last, Compare & comp, Place & place)
+		{
+			typedef typename ft::iterator_traits<RandomIt>::difference_type	Distance;
+			typedef typename ft::iterator_traits<RandomIt>::value_type		Value;
+
+			Distance	len = last - first;
+
+			if (len < 2)
+				return ;
+
+			Value	value = FT_MOVE(first[len - 1]);
+
+			siftUp(first, len - 1, Distance(0), value, comp, place);
+		}
+
+		template <class RandomIt, class Compare, class Place>
+		static void	popHeap(RandomIt first, RandomIt last, Compare & comp, Place & place)
+		{
+			typedef typename ft::iterator_traits<RandomIt>::difference_type	Distance;
+			typedef typename ft::iterator_traits<RandomIt>::value_type		Value;
+
+			Distance	len = last - first;
+
+			if (len < 2)
+				return ;
+
+			Value	value = FT_MOVE(first[len - 1]);
+
+			place(first, len - 1, first[0]);
+			siftDown(first, Distance(0), len - 1, value, comp, place);
+		}
+
+		template <class RandomIt, class Compare, class Place>
+		static void	makeHeap(RandomIt first, RandomIt last, Compare & comp, Place & place)
+		{
+			typedef typename ft::iterator_traits<RandomIt>::difference_type	Distance;
+			typedef typename ft::iterator_traits<RandomIt>::value_type		Value;
+
+			Distance const	arity = Arity;
+			Distance		len = last - first;
+
+			if (len < 2)
+				return ;
+			for (Distance parent = (len - 2) / arity; ; --parent)
+			{
+				Value	value = FT_MOVE(first[parent]);
+
+				siftDown(first, parent, len, value, comp, place);
+				if (parent == 0)
+					return ;
+			}
+		}
+
+		/* Porta il buco 'hole' verso la cima finché il padre ha priorità minore di 'value' (senza salire
+		   oltre 'top'), poi vi scrive 'value'. */
+		template <class RandomIt, class Distance, class Value, class Compare, class Place>
+		static void	siftUp(RandomIt first, Distance hole, Distance top, Value & value, Compare & comp, Place & place)
+		{
+			Distance const	arity = Arity;
+
+			while (hole > top)
+			{
+				Distance	parent = (hole - 1) / arity;
+
+				if (!comp(first[parent], value))
+					break ;
+				place(first, hole, first[parent]);
+				hole = parent;
+			}
+			place(first, hole, value);
+		}
+
+		/* Riempie il buco 'hole' con 'value' in uno heap di 'len' elementi. Il buco scende fino a una
+		   foglia seguendo sempre il figlio con priorità maggiore, senza confrontarlo con 'value', e poi
+		   'value' risale con siftUp: chi arriva in fondo a un pop (l'ultimo elemento) di solito torna
+		   quasi alla foglia, e così ogni livello costa d - 1 confronti invece di d. */
+		template <class RandomIt, class Distance, class Value, class Compare, class Place>
+		static void	siftDown(RandomIt first, Distance hole, Distance len, Value & value, Compare & comp, Place & place)
+		{
+			Distance const	arity = Arity;
+			Distance const	top = hole;
+			Distance		child;
+
+			while ((child = arity * hole + 1) < len)
+			{
+				Distance	end = child + arity < len ? child + arity : len;
+				Distance	best = child;
+
+				for (++child; child < end; ++child)
+					if (comp(first[best], first[child]))
+						best = child;
+				place(first, hole, first[best]);
+				hole = best;
+			}
+			siftUp(first, hole, top, value, comp, place);
+		}
+	};
+
+	// * ALGORITMI * //
+
+	/* Come in <algorithm>: heap binari con il massimo in cima, Compare = std::less di default.
+	   Per un'altra arità vedi dary_heap. */
+	template <class RandomIt>
+	void	push_heap(RandomIt first, RandomIt last)
+	{
+		dary_heap<2>::push_heap(first, last, std::less<typename ft::iterator_traits<RandomIt>::value_type>());
+	}
+
+	template <class RandomIt, class Compare>
+	void	push_heap(RandomIt first, RandomIt last, Compare comp)
+	{
+		dary_heap<2>::push_heap(first, last, comp);
+	}
+
+	template <class RandomIt>
+	void	pop_heap(RandomIt first, RandomIt last)
+	{
+		dary_heap<2>::pop_heap(first, last, std::less<typename ft::iterator_traits<RandomIt>::value_type>());
+	}
+
+	template <class RandomIt, class Compare>
+	void	pop_heap(RandomIt first, RandomIt last, Compare comp)
+	{
+		dary_heap<2>::pop_heap(first, last, comp);
+	}
+
+	template <class RandomIt>
+	void	make_heap(RandomIt first, RandomIt last)
+	{
+		dary_heap<2>::make_heap(first, last, std::less<typename ft::iterator_traits<RandomIt>::value_type>());
+	}
+
+	template <class RandomIt, class Compare>
+	void	make_heap(RandomIt first, RandomIt last, Compare comp)
+	{
+		dary_heap<2>::make_heap(first, last, comp);
+	}
+
+	template <class RandomIt>
+	void	sort_heap(RandomIt first, RandomIt last)
+	{
+		dary_heap<2>::sort_heap(first, last, std::less<typename ft::iterator_traits<RandomIt>::value_type>());
+	}
+
+	template <class RandomIt, class Compare>
+	void	sort_heap(RandomIt first, RandomIt last, Compare comp)
+	{
+		dary_heap<2>::sort_heap(first, last, comp);
+	}
+
+	template <class RandomIt>
+	bool	is_heap(RandomIt first, RandomIt last)
+	{
+		return (dary_heap<2>::is_heap(first, last, std::less<typename ft::iterator_traits<RandomIt>::value_type>()));
+	}
+
+	template <class RandomIt, class Compare>
+	bool	is_heap(RandomIt first, RandomIt last, Compare comp)
+	{
+		return (dary_heap<2>::is_heap(first, last, comp));
+	}
+
+	template <class RandomIt>
+	RandomIt	is_heap_until(RandomIt first, RandomIt last)
+	{
+		return (dary_heap<2>::is_heap_until(first, last, std::less<typename ft::iterator_traits<RandomIt>::value_type>()));
+	}
+
+	template <class RandomIt, class Compare>
+	RandomIt	is_heap_until(RandomIt first, RandomIt last, Compare comp)
+	{
+		return (dary_heap<2>::is_heap_until(first, last, comp));
+	}
+}
@@ -0,0 +1,261 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include "vector.hpp"
+#include "heap.hpp"
+#include "memory_stats.hpp"
+
+namespace ft
+{
+	/* Coda di priorità indirizzabile: push restituisce una handle con cui in seguito si può cambiare la
+	   priorità di quell'elemento (decrease_key, update) o toglierlo (erase) in O(log n), senza cercarlo.
+	   È lo heap d-ario di priority_queue (vedi dary_heap) con accanto a ogni valore la sua handle, più una
+	   tabella handle -> posizione nello heap tenuta aggiornata a ogni spostamento (vedi IndexPlace).
+	   Le handle delle voci rimosse vengono riusate dai push successivi, quindi la tabella non cresce
+	   oltre il numero massimo di elementi presenti insieme.
+	   Come priority_queue, in cima sta il massimo secondo Compare: per le scadenze di un timer si usa
+	   std::greater, e decrease_key anticipa una scadenza. */
+	template <class T, class Compare = std::less<T>, std::size_t Arity = 2>
+	class indexed_heap
+	{
+		public:
+			typedef T				value_type;
+			typedef Compare			value_compare;
+			typedef std::size_t		size_type;
+			typedef std::size_t		handle_type;
+			typedef const T&		const_reference;
+
+			static const handle_type	npos = static_cast<handle_type>(-1);
+
+
+			// * COSTRUTTORI * //
+
+			explicit indexed_heap(const Compare& comp = Compare()) : _comp(comp) {}
+
+			indexed_heap(const indexed_heap& other)
+				: _heap(other._heap), _pos(other._pos), _free(other._free), _comp(other._comp) {}
+
+			indexed_heap& operator=(const indexed_heap& other)
+			{
+				if (this == &other)
+					return (*this);
+				_heap = other._heap;
+				_pos = other._pos;
+				_free = other._free;
+				_comp = other._comp;
+				return (*this);
+			}
+
+			~indexed_heap() {};
+
+
+			// * MEMBER FUNCTION * //
+
+			bool		empty() const	{ return (_heap.empty()); };
+			size_type	size() const	{ return (_heap.size()); };
+
+			const_reference	top() const
+			{
+				if (empty())
+					throw std::out_of_range("indexed_heap::top(): empty heap");
+				return (_heap.front().value);
+			};
+
+			handle_type	top_handle() const
+			{
+				if (empty())
+					throw std::out_of_range("indexed_heap::top_handle(): empty heap");
+				return (_heap.front().handle);
+			};
+
+			/* Inserisce 'value' e restituisce la sua handle, valida finché l'elemento resta nello heap. */
+			handle_type	push(const value_type& value)
+			{
+				handle_type	handle = newHandle();
+				IndexPlace	place(_pos);
+
+				_heap.push_back(Entry(value, handle));
+				_pos[handle] = _heap.size() - 1;
+				heap_type::pushHeap(_heap.begin(), _heap.end(), _comp, place);
+				return (handle);
+			};
+
+			void	pop()
+			{
+				if (empty())
+					throw std::out_of_range("indexed_heap::pop(): empty heap");
+				removeAt(0);
+			};
+
+			bool	contains(handle_type handle) const
+			{
+				return (handle < _pos.size() && _pos[handle] != npos);
+			};
+
+			const_reference	value(handle_type handle) const
+			{
+				return (_heap[position(handle, "indexed_heap::value()")].value);
+			};
+
+			/* Dà all'elemento una priorità non minore di quella attuale (con std::greater: una chiave non
+			   maggiore), quindi può solo risalire: O(log_d n) confronti. */
+			void	decrease_key(handle_type handle, const value_type& value)
+			{
+				size_type	pos = position(handle, "indexed_heap::decrease_key()");
+				IndexPlace	place(_pos);
+
+				if (_comp.comp(value, _heap[pos].value))
+					throw std::invalid_argument("indexed_heap::decrease_key(): new key has lower priority");
+
+				Entry	entry(value, handle);
+
+				heap_type::siftUp(_heap.begin(), static_cast<difference_type>(pos), difference_type(0), entry, _comp, place);
+			};
+
+			/* Nuova priorità qualsiasi: l'elemento risale o scende secondo il caso. */
+			void	update(handle_type handle, const value_type& value)
+			{
+				size_type	pos = position(handle, "indexed_heap::update()");
+				Entry		entry(value, handle);
+
+				restore(pos, entry);
+			};
+
+			void	erase(handle_type handle)
+			{
+				removeAt(position(handle, "indexed_heap::erase()"));
+			};
+
+			/* Svuota lo heap; tutte le handle tornano libere. */
+			void	clear()
+			{
+				_heap.clear();
+				_pos.clear();
+				_free.clear();
+			};
+
+			void	swap(indexed_heap& other)
+			{
+				EntryCompare	tmp = _comp;
+
+				_heap.swap(other._heap);
+				_pos.swap(other._pos);
+				_free.swap(other._free);
+				_comp = other._comp;
+				other._comp = tmp;
+			};
+
+			/* Payload: i valori; overhead: l'oggetto, le handle accanto ai valori, la tabella delle posizioni
+			   e quella delle handle libere; slack: la capacità inutilizzata dei tre vector. */
+			memory_footprint	memory_usage() const
+			{
+				memory_footprint	heap = _heap.memory_usage();
+				memory_footprint	pos = _pos.memory_usage();
+				memory_footprint	free = _free.memory_usage();
+				std::size_t			payload = _heap.size() * sizeof(value_type);
+
+				return (memory_footprint(payload,
+					sizeof(*this) - sizeof(_heap) - sizeof(_pos) - sizeof(_free) + heap.payload - payload + heap.overhead
+						+ pos.payload + pos.overhead + free.payload + free.overhead,
+					heap.slack + pos.slack + free.slack));
+			};
+
+		private:
+			typedef std::ptrdiff_t		difference_type;
+			typedef dary_heap<Arity>	heap_type;
+
+			/* Voce dello heap: il valore e la sua handle, così ogni spostamento sa quale posizione aggiornare. */
+			struct Entry
+			{
+				value_type	value;
+				handle_type	handle;
+
+				Entry(const value_type& v, handle_type h) : value(v), handle(h) {};
+			};
+
+			struct EntryCompare
+			{
+				Compare	comp;
+
+				EntryCompare(const Compare& c) : comp(c) {};
+
+				bool	operator()(const Entry& lhs, const Entry& rhs) const
+				{
+					return (comp(lhs.value, rhs.value));
+				};
+			};
+
+			/* Place per dary_heap: sposta la voce e annota la sua nuova posizione. */
+			struct IndexPlace
+			{
+				ft::vector<size_type>&	pos;
+
+				explicit IndexPlace(ft::vector<size_type>& p) : pos(p) {};
+
+				template <class RandomIt>
+				void	operator()(RandomIt first, difference_type index, Entry& entry) const
+				{
+					first[index] = FT_MOVE(entry);
+					pos[first[index].handle] = index;
+				};
+			};
+
+			ft::vector<Entry>		_heap;
+			ft::vector<size_type>	_pos;	// handle -> posizione nello heap, npos se libera
+			ft::vector<handle_type>	_free;	// handle libere, riusate da push
+			EntryCompare			_comp;
+
+			handle_type	newHandle()
+			{
+				handle_type	handle;
+
+				if (_free.empty())
+				{
+					_pos.push_back(npos);
+					return (_pos.size() - 1);
+				}
+				handle = _free.back();
+				_free.pop_back();
+				return (handle);
+			};
+
+			size_type	position(handle_type handle, char const * where) const
+			{
+				if (!contains(handle))
+					throw std::out_of_range(std::string(where) + ": invalid handle");
+				return (_pos[handle]);
+			};
+
+			/* Rimette 'entry' nella posizione 'pos': risale se ha priorità maggiore del padre, altrimenti scende. */
+			void	restore(size_type pos, Entry& entry)
+			{
+				IndexPlace		place(_pos);
+				difference_type	hole = static_cast<difference_type>(pos);
+				difference_type	arity = Arity;
+
+				if (hole > 0 && _comp(_heap[(hole - 1) / arity], entry))
+					heap_type::siftUp(_heap.begin(), hole, difference_type(0), entry, _comp, place);
+				else
+					heap_type::siftDown(_heap.begin(), hole, static_cast<difference_type>(_heap.size()), entry, _comp, place);
+			};
+
+			/* Toglie la voce in posizione 'pos' e ne libera la handle; l'ultima voce prende il suo posto. */
+			void	removeAt(size_type pos)
+			{
+				handle_type	handle = _heap[pos].handle;
+				Entry		last = FT_MOVE(_heap.back());
+
+				_heap.pop_back();
+				_pos[handle] = npos;
+				_free.push_back(handle);
+				if (pos < _heap.size())
+					restore(pos, last);
+			};
+	};
+
+	template <class T, class Compare, std::size_t Arity>
+	const typename indexed_heap<T, Compare, Arity>::handle_type	indexed_heap<T, Compare, Arity>::npos;
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <cstddef>
 #include "utility.hpp"
+#include "node_color.hpp"
 
 namespace ft
 {
@@ -105,15 +106,14 @@ namespace ft
 			typedef typename ft::iterator<ft::random_access_iterator_tag, T>::reference			reference;
 			typedef size_t																		size_type;
 			typedef T*																			iterator_type;
-			random_access_iterator() : _pointed(NULL), _value(value_type()) {};
-			random_access_iterator(pointer p) : _pointed(p), _value(value_type()) {};
-			random_access_iterator(random_access_iterator const &src) : _value(src._value) { this->_pointed = src.pointed(); }
+			random_access_iterator() : _pointed(NULL) {};
+			random_access_iterator(pointer p) : _pointed(p) {};
+			random_access_iterator(random_access_iterator const &src) : _pointed(src.pointed()) {}
 			random_access_iterator&	operator=(random_access_iterator const & rhs)
 			{
 				if (this == &rhs)
 					return (*this);
 				this->_pointed = rhs._pointed;
-				// this->_value = value_type();
 				return (*this);
 			}
 			virtual ~random_access_iterator(){};
@@ -174,7 +174,6 @@ namespace ft
 
 		private:
 			pointer _pointed;
-			T		_value;
 	};
 
 	template <class T>
@@ -260,6 +259,138 @@ namespace ft
 			iterator_type	_base;
 	};
 
+	/* Funzioni di navigazione condivise da RBIterator e RBIteratorConst.
+	   Il nodo sentinella dell'albero (colore SENTINEL, vedi node_color.hpp) fa da foglia per tutti
+	   i nodi e da padre della root: risalendo oltre la root si arriva quindi su end(), e da end()
+	   si ritrova la root tramite sentinel->parent; sentinel->child[0] e sentinel->child[1] sono il minimo e il
+	   massimo dell'albero (il sentinella stesso se è vuoto). Così l'iteratore non deve conoscere nient'altro
+	   che il nodo puntato. Lo spostamento costa O(1) ammortizzato: una visita completa attraversa
+	   ogni arco dell'albero al massimo due volte. */
+	template <class NodeType>
+	struct RBNavigator
+	{
+		static bool		isSentinel(NodeType* node) { return (node->color == SENTINEL); }
+
+		static NodeType*	leftmost(NodeType* node)
+		{
+			while (!isSentinel(node->child[0]))
+				node = node->child[0];
+			return (node);
+		}
+
+		static NodeType*	rightmost(NodeType* node)
+		{
+			while (!isSentinel(node->child[1]))
+				node = node->child[1];
+			return (node);
+		}
+
+		static NodeType*	successor(NodeType* node)
+		{
+			NodeType*	parent;
+
+			if (isSentinel(node))
+				return (node);
+			if (!isSentinel(node->child[1]))
+				return (leftmost(node->child[1]));
+			parent = node->parent;
+			while (!isSentinel(parent) && node == parent->child[1])
+			{
+				node = parent;
+				parent = parent->parent;
+			}
+			return (parent);
+		}
+
+		static NodeType*	predecessor(NodeType* node)
+		{
+			NodeType*	parent;
+
+			if (isSentinel(node))			// --end(): il massimo dell'albero, in cache nel sentinella
+				return (node->child[1]);
+			if (!isSentinel(node->child[0]))
+				return (rightmost(node->child[0]));
+			parent = node->parent;
+			while (!isSentinel(parent) && node == parent->child[0])
+			{
+				node = parent;
+				parent = parent->parent;
+			}
+			return (parent);
+		}
+
+		/* Ogni nodo tiene in 'count' il numero di nodi del proprio sottoalbero (0 per il sentinella).
+		   rank() restituisce la posizione di 'node' nell'ordine delle chiavi (0 per il minimo, size() per end()):
+		   partendo dal sottoalbero sinistro si risale fino alla radice aggiungendo, ogni volta che si arriva
+		   da un figlio destro, il padre e il suo sottoalbero sinistro. O(log n). */
+		static std::size_t	rank(NodeType* node)
+		{
+			std::size_t	ret;
+
+			if (isSentinel(node))
+				return (node->parent->count);
+			ret = node->child[0]->count;
+			while (!isSentinel(node->parent))
+			{
+				if (node == node->parent->child[1])
+					ret += node->parent->child[0]->count + 1;
+				node = node->parent;
+			}
+			return (ret);
+		}
+
+		/* Il nodo in posizione k (da 0) dell'albero che ha 'sentinel' come sentinella, oppure il sentinella
+		   se k è fuori dal range. Si scende dalla radice confrontando k con la dimensione del sottoalbero sinistro. */
+		static NodeType*	select(NodeType* sentinel, std::size_t k)
+		{
+			NodeType*	node = sentinel->parent;
+
+			if (k >= node->count)
+				return (sentinel);
+			while (k != node->child[0]->count)
+			{
+				if (k < node->child[0]->count)
+					node = node->child[0];
+				else
+				{
+					k -= node->child[0]->count + 1;
+					node = node->child[1];
+				}
+			}
+			return (node);
+		}
+
+		/* Sposta 'node' di n posizioni (anche negative). Per pochi passi si usano successor/predecessor,
+		   altrimenti si calcola il rank e si riscende dalla radice: O(log n) qualunque sia n.
+		   Uscire dal range, da una parte o dall'altra, porta su end() con entrambi i percorsi. */
+		static NodeType*	advance(NodeType* node, std::ptrdiff_t n)
+		{
+			NodeType*	sentinel = node;
+			std::size_t	pos;
+
+			if (n > -8 && n < 8)
+			{
+				for (; n > 0; n--)
+					node = successor(node);
+				// successor(end()) è end(); predecessor invece da end() torna sul massimo, quindi chi
+				// arriva sul sentinella prima di --begin() si ferma lì
+				for (; n < 0; n++)
+				{
+					node = predecessor(node);
+					if (isSentinel(node))
+						return (node);
+				}
+				return (node);
+			}
+			while (!isSentinel(sentinel))
+				sentinel = sentinel->parent;
+			pos = rank(node);
+			if (n < 0 && static_cast<std::size_t>(-n) > pos)
+				return (sentinel);
+			return (select(sentinel, pos + n));
+		}
+	};
+
 	template <typename T, class Compare, class NodeType>
 	class RBIterator
 	{
@@ -272,63 +403,19 @@ namespace ft
 			typedef bidirectional_iterator_tag	iterator_category;
 
 			nodePointer	node;
-			nodePointer	sentinel;
-			nodePointer	root;
-			nodePointer	minNode;
-			nodePointer	maxNode;
-			Compare		c;
 
-			RBIterator()
-			{
-				node = NULL;
-				sentinel = NULL;
-				c = Compare();
-			};
+			RBIterator() : node(NULL) {};
+
+			RBIterator(NodeType* start) : node(start) {};
 
-			RBIterator(NodeType* start) :
-				node(start),
-				sentinel(findSentinel()),
-				root(findRoot()),
-				minNode(min(root)),
-				maxNode(max(root)),
-				c(Compare())
-			{};
-
-			RBIterator(NodeType* start, NodeType* endPtr) :
-				node(start),
-				sentinel(endPtr),
-				root(findRoot()),
-				minNode(min(root)),
-				maxNode(max(root)),
-				c(Compare())
-			{};
-
-			RBIterator(RBIterator const & src) :
-				node(src.node),
-				sentinel(src.sentinel),
-				root(src.root),
-				minNode(src.minNode),
-				maxNode(src.maxNode)
-			{};
+			RBIterator(RBIterator const & src) : node(src.node) {};
 
 			template <class T2, class C2, class NodeType2>
-			RBIterator(RBIterator<T2, C2, NodeType2> const & src) :
-				node(src.node),
-				sentinel(src.sentinel),
-				root(src.root),
-				minNode(src.minNode),
-				maxNode(src.maxNode)
-			{};
+			RBIterator(RBIterator<T2, C2, NodeType2> const & src) : node(src.node) {};
 
 			RBIterator&	operator=(RBIterator const & rhs)
 			{
-				if (this == &rhs)
-					return (*this);
 				this->node = rhs.node;
-				this->sentinel = rhs.sentinel;
-				this->root = rhs.root;
-				this->minNode = rhs.minNode;
-				this->maxNode = rhs.maxNode;
 				return (*this);
 			}
 
@@ -336,10 +423,6 @@ namespace ft
 			RBIterator&	operator=(InputIt const & rhs)
 			{
 				this->node = rhs.node;
-				this->sentinel = rhs.sentinel;
-				this->root = rhs.root;
-				this->minNode = rhs.minNode;
-				this->maxNode = rhs.maxNode;
 				return (*this);
 			}
 
@@ -350,20 +433,12 @@ namespace ft
 
 			reference			operator*() const { return (this->node->data); }
 			pointer				operator->() const { return &(this->node->data); }
-			bool				operator==(RBIterator const & rhs) { return ((this->node == rhs.node) ? true : false); }
-
-			bool				operator!=(RBIterator const & rhs)
-			{
-				if ((this->node && !rhs.node) || (!this->node && rhs.node))
-					return (true);
-				else if (!this->node && !rhs.node)
-					return (false);
-				return ((this->node == rhs.node) ? false : true);
-			}
+			bool				operator==(RBIterator const & rhs) const { return (this->node == rhs.node); }
+			bool				operator!=(RBIterator const & rhs) const { return (this->node != rhs.node); }
 
 			RBIterator&	operator++()
 			{
-				this->node = getSuccessor(this->node);
+				this->node = RBNavigator<NodeType>::successor(this->node);
 				return (*this);
 			};
 
@@ -377,7 +452,7 @@ namespace ft
 
 			RBIterator&	operator--()
 			{
-				this->node = getPredecessor(this->node);
+				this->node = RBNavigator<NodeType>::predecessor(this->node);
 				return (*this);
 			};
 
@@ -391,139 +466,12 @@ namespace ft
 
 			RBIterator	operator-(difference_type n) const
 			{
-				RBIterator	ret(*this);
-				for (int i = 0; i < n; i++)
-					ret--;
-				return (ret);
+				return (RBIterator(RBNavigator<NodeType>::advance(this->node, -n)));
 			}
 
 			RBIterator	operator+(difference_type n) const
 			{
-				RBIterator	ret(*this);
-				for (int i = 0; i < n; i++)
-					ret++;
-				return (ret);
-			}
-
-		private:
-			nodePointer	min()
-			{
-				nodePointer*	node = &root;
-
-				if (!(*node) || (*node) == sentinel)
-					return (sentinel);
-
-				while ((*node)->child[0] && (*node)->child[0] != sentinel)
-					node = &(*node)->child[0];
-				return (*node);
-			}
-
-			nodePointer	min(nodePointer& node)
-			{
-				nodePointer*	tmp = &node;
-
-				if (!(*tmp) || !tmp)
-					return (NULL);
-
-				while (*tmp != sentinel && (*tmp)->child[0] != sentinel)
-					tmp = &((*tmp)->child[0]);
-				return (*tmp);
-			}
-
-			nodePointer	max()
-			{
-				nodePointer*	node = &root;
-
-				if (!node || !(*node) || (*node) == sentinel)
-					return (sentinel);
-
-				while ((*node)->child[1] && (*node)->child[1] != sentinel)
-					node = &(*node)->child[1];
-				return (*node);
-			}
-
-			nodePointer	max(nodePointer& node)
-			{
-				nodePointer*	tmp = &node;
-
-				if (!tmp || !(*tmp))
-					return (NULL);
-
-				while (*tmp != sentinel && (*tmp)->child[1] != sentinel)
-					tmp = &((*tmp)->child[1]);
-				return (*tmp);
-			}
-
-			nodePointer	findSentinel()
-			{
-				nodePointer*	tmp = &this->node;
-
-				if (!(*tmp) || !tmp)
-					return (NULL);
-
-				while (tmp && (*tmp)->color != 2)
-					tmp = &((*tmp)->child[0]);
-				return (*tmp);
-			}
-
-			nodePointer	findRoot()
-			{
-				nodePointer*	tmp = &this->node;
-				while (tmp && *tmp && *tmp != sentinel && (*tmp)->parent != sentinel)
-					tmp = &((*tmp)->parent);
-				return (*tmp);
-			}
-
-			nodePointer	getSuccessor(nodePointer & node)
-			{
-				nodePointer*	tmp = &node;
-
-				if (node == sentinel)
-					return (sentinel);
-				if (node == max(sentinel->parent))
-					return (sentinel);
-				if (node->parent == sentinel && node->child[0] == sentinel && node->child[1] == sentinel)
-					return (sentinel);
-				if ((*tmp)->child[1] != sentinel)
-					return (min((*tmp)->child[1]));
-				else
-				{
-					while ((*tmp)->parent != sentinel)
-					{
-						if ((*tmp)->parent->child[0] == *tmp)
-						{
-							tmp = &(*tmp)->parent;
-							break ;
-						}
-						tmp = &(*tmp)->parent;
-					}
-					return (*tmp);
-				}
-			}
-
-			nodePointer	getPredecessor(nodePointer & node)
-			{
-				nodePointer*	tmp = &node;
-
-				if (node == sentinel)
-					return (max(node->parent));
-				if (node == min(sentinel->parent))
-					return (sentinel);
-				if ((*tmp)->child[0] != sentinel)
-					return (max((*tmp)->child[0]));
-				else
-				{
-					while ((*tmp)->parent != sentinel)
-					{
-						if ((*tmp)->parent->child[1] == *tmp)
-						{
-							tmp = &(*tmp)->parent;
-							break ;
-						}
-						tmp = &(*tmp)->parent;
-					}
-					return (*tmp);
-				}
+				return (RBIterator(RBNavigator<NodeType>::advance(this->node, n)));
 			}
 	};
 
@@ -539,66 +487,22 @@ namespace ft
 			typedef bidirectional_iterator_tag	iterator_category;
 
 			nodePointer	node;
-			nodePointer	sentinel;
-			nodePointer	root;
-			nodePointer	minNode;
-			nodePointer	maxNode;
-			Compare		c;
 
-			RBIteratorConst()
-			{
-				node = NULL;
-				sentinel = NULL;
-				c = Compare();
-			};
+			RBIteratorConst() : node(NULL) {};
 
-			RBIteratorConst(NodeType* start) :
-				node(start),
-				sentinel(findSentinel()),
-				root(findRoot()),
-				minNode(min(root)),
-				maxNode(max(root)),
-				c(Compare())
-			{};
-
-			RBIteratorConst(NodeType* start, NodeType* endPtr) :
-				node(start),
-				sentinel(endPtr),
-				root(findRoot()),
-				minNode(min(root)),
-				maxNode(max(root)),
-				c(Compare())
-			{};
-
-			RBIteratorConst(RBIteratorConst const & src) :
-				node(src.node),
-				sentinel(src.sentinel),
-				root(src.root),
-				minNode(src.minNode),
-				maxNode(src.maxNode)
-			{};
+			RBIteratorConst(NodeType* start) : node(start) {};
 
-			template <class InputIt>
-			RBIteratorConst(InputIt const & src)
-			{
-				if (src.node == NULL)
-					return ;
-				node = src.node;
-				sentinel = src.sentinel;
-				root = src.root;
-				minNode = src.minNode;
-				maxNode = src.maxNode;
-			};
+			RBIteratorConst(RBIteratorConst const & src) : node(src.node) {};
+
+			template <class T2, class C2, class NodeType2>
+			RBIteratorConst(RBIterator<T2, C2, NodeType2> const & src) : node(src.node) {};
+
+			template <class T2, class C2, class NodeType2>
+			RBIteratorConst(RBIteratorConst<T2, C2, NodeType2> const & src) : node(src.node) {};
 
 			RBIteratorConst&	operator=(RBIteratorConst const & rhs)
 			{
-				if (this == &rhs)
-					return (*this);
 				this->node = rhs.node;
-				this->sentinel = rhs.sentinel;
-				this->root = rhs.root;
-				this->minNode = rhs.minNode;
-				this->maxNode = rhs.maxNode;
 				return (*this);
 			}
 
@@ -606,10 +510,6 @@ namespace ft
 			RBIteratorConst&	operator=(InputIt const & rhs)
 			{
 				this->node = rhs.node;
-				this->sentinel = rhs.sentinel;
-				this->root = rhs.root;
-				this->minNode = rhs.minNode;
-				this->maxNode = rhs.maxNode;
 				return (*this);
 			}
 
@@ -620,20 +520,12 @@ namespace ft
 
 			reference			operator*() const { return (this->node->data); }
 			pointer				operator->() const { return &(this->node->data); }
-			bool				operator==(RBIteratorConst const & rhs) { return ((this->node == rhs.node) ? true : false); }
-
-			bool				operator!=(RBIteratorConst const & rhs)
-			{
-				if ((this->node && !rhs.node) || (!this->node && rhs.node))
-					return (true);
-				else if (!this->node && !rhs.node)
-					return (false);
-				return ((this->node == rhs.node) ? false : true);
-			}
+			bool				operator==(RBIteratorConst const & rhs) const { return (this->node == rhs.node); }
+			bool				operator!=(RBIteratorConst const & rhs) const { return (this->node != rhs.node); }
 
 			RBIteratorConst&	operator++()
 			{
-				this->node = getSuccessor(this->node);
+				this->node = RBNavigator<NodeType>::successor(this->node);
 				return (*this);
 			};
 
@@ -647,7 +539,7 @@ namespace ft
 
 			RBIteratorConst&	operator--()
 			{
-				this->node = getPredecessor(this->node);
+				this->node = RBNavigator<NodeType>::predecessor(this->node);
 				return (*this);
 			};
 
@@ -661,140 +553,304 @@ namespace ft
 
 			RBIteratorConst	operator-(difference_type n) const
 			{
-				RBIteratorConst	ret(*this);
-				for (int i = 0; i < n; i++)
-					ret--;
-				return (ret);
+				return (RBIteratorConst(RBNavigator<NodeType>::advance(this->node, -n)));
 			}
 
 			RBIteratorConst	operator+(difference_type n) const
 			{
-				RBIteratorConst	ret(*this);
-				for (int i = 0; i < n; i++)
-					ret++;
-				return (ret);
+				return (RBIteratorConst(RBNavigator<NodeType>::advance(this->node, n)));
 			}
+	};
 
-		private:
-			nodePointer	min()
-			{
-				nodePointer*	node = &root;
+	/* Iteratori delle tabelle hash (vedi HashTable): scorrono l'array degli slot insieme a quello
+	   delle distanze di sondaggio, saltando gli slot vuoti (distanza 0). L'array delle distanze
+	   termina con un byte non nullo, così l'avanzamento si ferma su end() senza confronti di bordo. */
+	template <typename T>
+	class HashIterator
+	{
+		public:
+			typedef T							value_type;
+			typedef T*							pointer;
+			typedef T&							reference;
+			typedef std::ptrdiff_t				difference_type;
+			typedef forward_iterator_tag		iterator_category;
 
-				if (!(*node) || (*node) == sentinel)
-					return (sentinel);
+			pointer					slot;
+			unsigned char const *	dist;
 
-				while ((*node)->child[0] && (*node)->child[0] != sentinel)
-					node = &(*node)->child[0];
-				return (*node);
-			}
+			HashIterator() : slot(NULL), dist(NULL) {};
 
-			nodePointer	min(nodePointer& node)
-			{
-				nodePointer*	tmp = &node;
+			HashIterator(pointer s, unsigned char const * d) : slot(s), dist(d) {};
 
-				if (!(*tmp) || !tmp)
-					return (NULL);
+			HashIterator(HashIterator const & src) : slot(src.slot), dist(src.dist) {};
 
-				while (*tmp != sentinel && (*tmp)->child[0] != sentinel)
-					tmp = &((*tmp)->child[0]);
-				return (*tmp);
+			HashIterator&	operator=(HashIterator const & rhs)
+			{
+				this->slot = rhs.slot;
+				this->dist = rhs.dist;
+				return (*this);
 			}
 
-			nodePointer	max()
-			{
-				nodePointer*	node = &root;
+			~HashIterator() {};
 
-				if (!node || !(*node) || (*node) == sentinel)
-					return (sentinel);
+			reference		operator*() const { return (*this->slot); }
+			pointer			operator->() const { return (this->slot); }
+			bool			operator==(HashIterator const & rhs) const { return (this->dist == rhs.dist); }
+			bool			operator!=(HashIterator const & rhs) const { return (this->dist != rhs.dist); }
 
-				while ((*node)->child[1] && (*node)->child[1] != sentinel)
-					node = &(*node)->child[1];
-				return (*node);
-			}
+			HashIterator&	operator++()
+			{
+				do
+				{
+					++this->slot;
+					++this->dist;
+				} while (*this->dist == 0);
+				return (*this);
+			};
 
-			nodePointer	max(nodePointer& node)
+			HashIterator	operator++(int)
 			{
-				nodePointer*	tmp = &node;
+				HashIterator	ret(*this);
+
+				++(*this);
+				return (ret);
+			};
+	};
+
+	template <typename T>
+	class HashIteratorConst
+	{
+		public:
+			typedef T							value_type;
+			typedef const T*					pointer;
+			typedef const T&					reference;
+			typedef std::ptrdiff_t				difference_type;
+			typedef forward_iterator_tag		iterator_category;
+
+			pointer					slot;
+			unsigned char const *	dist;
 
-				if (!tmp || !(*tmp))
-					return (NULL);
+			HashIteratorConst() : slot(NULL), dist(NULL) {};
 
-				while (*tmp != sentinel && (*tmp)->child[1] != sentinel)
-					tmp = &((*tmp)->child[1]);
-				return (*tmp);
+			HashIteratorConst(pointer s, unsigned char const * d) : slot(s), dist(d) {};
+
+			HashIteratorConst(HashIteratorConst const & src) : slot(src.slot), dist(src.dist) {};
+
+			HashIteratorConst(HashIterator<T> const & src) : slot(src.slot), dist(src.dist) {};
+
+			HashIteratorConst&	operator=(HashIteratorConst const & rhs)
+			{
+				this->slot = rhs.slot;
+				this->dist = rhs.dist;
+				return (*this);
 			}
 
-			nodePointer	findSentinel()
+			~HashIteratorConst() {};
+
+			reference			operator*() const { return (*this->slot); }
+			pointer				operator->() const { return (this->slot); }
+
+			/* Funzioni amiche: confrontano anche un HashIterator con un HashIteratorConst */
+			friend bool			operator==(HashIteratorConst const & lhs, HashIteratorConst const & rhs) { return (lhs.dist == rhs.dist); }
+			friend bool			operator!=(HashIteratorConst const & lhs, HashIteratorConst const & rhs) { return (lhs.dist != rhs.dist); }
+
+			HashIteratorConst&	operator++()
+			{
+				do
+				{
+					++this->slot;
+					++this->dist;
+				} while (*this->dist == 0);
+				return (*this);
+			};
+
+			HashIteratorConst	operator++(int)
 			{
-				nodePointer*	tmp = &this->node;
+				HashIteratorConst	ret(*this);
 
-				if (!(*tmp) || !tmp)
-					return (NULL);
+				++(*this);
+				return (ret);
+			};
+	};
 
-				while (tmp && (*tmp)->color != 2)
-					tmp = &((*tmp)->child[0]);
-				return (*tmp);
-			}
+	/* Numero di elementi in un blocco di ft::deque: blocchi da 4 KiB, ma almeno 16 elementi per i tipi grandi. */
+	template <class T>
+	struct deque_block_size
+	{
+		static const std::size_t	value = (sizeof(T) < 256 ? 4096 / sizeof(T) : 16);
+	};
+
+	/* Iteratore segmentato di ft::deque (vedi deque.hpp): oltre all'elemento puntato conosce i limiti del
+	   suo blocco e la sua casella nella mappa dei blocchi, quindi l'avanzamento di uno resta un incremento
+	   di puntatore tranne che al cambio di blocco, e l'accesso casuale è una divisione per la dimensione
+	   del blocco. Con T const è il const_iterator; 'node' ha lo stesso tipo nei due iteratori, così
+	   si possono confrontare e sottrarre tra loro. */
+	template <class T>
+	class DequeIterator
+	{
+		public:
+			typedef T								value_type;
+			typedef T*								pointer;
+			typedef T&								reference;
+			typedef std::ptrdiff_t					difference_type;
+			typedef std::random_access_iterator_tag	iterator_category;
+			typedef typename remove_const<T>::type* const *	mapPointer;
+
+			static const difference_type	BLOCK = deque_block_size<T>::value;
 
-			nodePointer	findRoot()
+			pointer		cur;
+			pointer		first;
+			pointer		last;
+			mapPointer	node;
+
+			DequeIterator() : cur(NULL), first(NULL), last(NULL), node(NULL) {};
+
+			DequeIterator(pointer c, mapPointer n) : cur(c), first(n ? *n : NULL), last(n ? *n + BLOCK : NULL), node(n) {};
+
+			DequeIterator(DequeIterator const & src) : cur(src.cur), first(src.first), last(src.last), node(src.node) {};
+
+			/* iterator -> const_iterator */
+			template <class T2>
+			DequeIterator(DequeIterator<T2> const & src, typename ft::enable_if<ft::is_same<T, const T2>::value, int>::type = 0) :
+				cur(src.cur), first(src.first), last(src.last), node(src.node) {};
+
+			DequeIterator&	operator=(DequeIterator const & rhs)
 			{
-				nodePointer*	tmp = &this->node;
-				while (tmp && *tmp && *tmp != sentinel && (*tmp)->parent != sentinel)
-					tmp = &((*tmp)->parent);
-				return (*tmp);
+				cur = rhs.cur;
+				first = rhs.first;
+				last = rhs.last;
+				node = rhs.node;
+				return (*this);
 			}
 
-			nodePointer	getSuccessor(nodePointer & node)
+			~DequeIterator() {};
+
+			reference		operator*() const { return (*cur); }
+			pointer			operator->() const { return (cur); }
+			reference		operator[](difference_type n) const { return (*(*this + n)); }
+
+			DequeIterator&	operator++()
 			{
-				nodePointer*	tmp = &node;
-
-				if (node == sentinel)
-					return (sentinel);
-				if (node == max(sentinel->parent))
-					return (sentinel);
-				if (node->parent == sentinel && node->child[0] == sentinel && node->child[1] == sentinel)
-					return (sentinel);
-				if ((*tmp)->child[1] != sentinel)
-					return (min((*tmp)->child[1]));
-				else
+				if (++cur == last)
 				{
-					while ((*tmp)->parent != sentinel)
-					{
-						if ((*tmp)->parent->child[0] == *tmp)
-						{
-							tmp = &(*tmp)->parent;
-							break ;
-						}
-						tmp = &(*tmp)->parent;
-					}
-					return (*tmp);
+					setNode(node + 1);
+					cur = first;
 				}
-			}
+				return (*this);
+			};
 
-			nodePointer	getPredecessor(nodePointer & node)
+			DequeIterator	operator++(int)
 			{
-				nodePointer*	tmp = &node;
-
-				if (node == sentinel)
-					return (max(node->parent));
-				if (node == min(sentinel->parent))
-					return (sentinel);
-				if ((*tmp)->child[0] != sentinel)
-					return (max((*tmp)->child[0]));
+				DequeIterator	ret(*this);
+
+				++(*this);
+				return (ret);
+			};
+
+			DequeIterator&	operator--()
+			{
+				if (cur == first)
+				{
+					setNode(node - 1);
+					cur = last;
+				}
+				--cur;
+				return (*this);
+			};
+
+			DequeIterator	operator--(int)
+			{
+				DequeIterator	ret(*this);
+
+				--(*this);
+				return (ret);
+			};
+
+			/* Se la destinazione è nello stesso blocco basta spostare il puntatore, altrimenti si salta
+			   direttamente al blocco giusto. */
+			DequeIterator&	operator+=(difference_type n)
+			{
+				difference_type	offset = n + (cur - first);
+
+				if (offset >= 0 && offset < BLOCK)
+					cur += n;
 				else
 				{
-					while ((*tmp)->parent != sentinel)
-					{
-						if ((*tmp)->parent->child[1] == *tmp)
-						{
-							tmp = &(*tmp)->parent;
-							break ;
-						}
-						tmp = &(*tmp)->parent;
-					}
-					return (*tmp);
+					difference_type	nodeOffset = offset > 0 ? offset / BLOCK : -((-offset - 1) / BLOCK) - 1;
+
+					setNode(node + nodeOffset);
+					cur = first + (offset - nodeOffset * BLOCK);
 				}
+				return (*this);
+			};
+
+			DequeIterator&	operator-=(difference_type n) { return (*this += -n); }
+
+			DequeIterator	operator+(difference_type n) const
+			{
+				DequeIterator	ret(*this);
+
+				return (ret += n);
 			}
+
+			DequeIterator	operator-(difference_type n) const
+			{
+				DequeIterator	ret(*this);
+
+				return (ret -= n);
+			}
+
+			void	setNode(mapPointer n)
+			{
+				node = n;
+				first = *n;
+				last = first + BLOCK;
+			}
+	};
+
+	template <class T>
+	const typename DequeIterator<T>::difference_type	DequeIterator<T>::BLOCK;
+
+	template <class T>
+	DequeIterator<T>	operator+(typename DequeIterator<T>::difference_type n, DequeIterator<T> const & it) { return (it + n); }
+
+	/* Confronti e differenza anche tra iterator e const_iterator. La mappa dei blocchi è un array unico,
+	   quindi le caselle si confrontano come puntatori. */
+	template <class T1, class T2>
+	std::ptrdiff_t	operator-(DequeIterator<T1> const & lhs, DequeIterator<T2> const & rhs)
+	{
+		return ((lhs.node - rhs.node) * DequeIterator<T1>::BLOCK + (lhs.cur - lhs.first) - (rhs.cur - rhs.first));
+	}
+
+	template <class T1, class T2>
+	bool	operator==(DequeIterator<T1> const & lhs, DequeIterator<T2> const & rhs) { return (lhs.cur == rhs.cur); }
+
+	template <class T1, class T2>
+	bool	operator!=(DequeIterator<T1> const & lhs, DequeIterator<T2> const & rhs) { return (lhs.cur != rhs.cur); }
+
+	template <class T1, class T2>
+	bool	operator<(DequeIterator<T1> const & lhs, DequeIterator<T2> const & rhs)
+	{
+		return (lhs.node == rhs.node ? lhs.cur < rhs.cur : lhs.node < rhs.node);
+	}
+
+	template <class T1, class T2>
+	bool	operator>(DequeIterator<T1> const & lhs, DequeIterator<T2> const & rhs) { return (rhs < lhs); }
+
+	template <class T1, class T2>
+	bool	operator<=(DequeIterator<T1> const & lhs, DequeIterator<T2> const & rhs) { return (!(rhs < lhs)); }
+
+	template <class T1, class T2>
+	bool	operator>=(DequeIterator<T1> const & lhs, DequeIterator<T2> const & rhs) { return (!(lhs < rhs)); }
+
+	/* Gli iteratori di ft::vector avvolgono un puntatore: ft::equal, ft::find e gli altri algoritmi
+	   di utility.hpp lavorano direttamente sulla memoria. */
+	template <class T>
+	struct contiguous_address<random_access_iterator<T> >
+	{
+		static const bool							value = true;
+		typedef typename remove_const<T>::type		element_type;
+		static T*	address(random_access_iterator<T> const & it) { return (it.pointed()); }
 	};
 
 	// Overloads
@@ -1047,4 +1103,50 @@ namespace ft
 			ret++;
 		return (ret);
 	}
+
+	/* Sugli iteratori di map e set la distanza è la differenza dei rank dei due nodi: O(log n). */
+	template <typename T, class Compare, class NodeType>
+	typename RBIterator<T, Compare, NodeType>::difference_type
+	distance(RBIterator<T, Compare, NodeType> first, RBIterator<T, Compare, NodeType> last)
+	{
+		return (RBNavigator<NodeType>::rank(last.node) - RBNavigator<NodeType>::rank(first.node));
+	}
+
+	template <typename T, class Compare, class NodeType>
+	typename RBIteratorConst<T, Compare, NodeType>::difference_type
+	distance(RBIteratorConst<T, Compare, NodeType> first, RBIteratorConst<T, Compare, NodeType> last)
+	{
+		return (RBNavigator<NodeType>::rank(last.node) - RBNavigator<NodeType>::rank(first.node));
+	}
+
+	/* Sugli iteratori di ft::deque la distanza si calcola in O(1), vedi DequeIterator. */
+	template <typename T>
+	typename DequeIterator<T>::difference_type
+	distance(DequeIterator<T> first, DequeIterator<T> last)
+	{
+		return (last - first);
+	}
+
+	/* La versione generica incrementa anche 'last': oltre end() di una tabella hash non c'è più niente da leggere. */
+	template <typename T>
+	typename HashIterator<T>::difference_type
+	distance(HashIterator<T> first, HashIterator<T> last)
+	{
+		typename HashIterator<T>::difference_type	ret = 0;
+
+		for (; first != last; ++first)
+			ret++;
+		return (ret);
+	}
+
+	template <typename T>
+	typename HashIteratorConst<T>::difference_type
+	distance(HashIteratorConst<T> first, HashIteratorConst<T> last)
+	{
+		typename HashIteratorConst<T>::difference_type	ret = 0;
+
+		for (; first != last; ++first)
+			ret++;
+		return (ret);
+	}
 }
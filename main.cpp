@@ -2,13 +2,1332 @@
 #include "vector.hpp"
 #include "stack.hpp"
 #include "set.hpp"
+#include "flat_map.hpp"
+#include "flat_set.hpp"
+#include "unordered_map.hpp"
+#include "unordered_set.hpp"
+#include "queue.hpp"
+#include "indexed_heap.hpp"
 #include <fstream>
 #include <sstream>
 #include <vector>
 #include <stack>
 #include <set>
 #include <map>
+#include <queue>
+#include <stdexcept>
+#include <iterator>
+#include <algorithm>
+#include <string>
 
+/* I test che seguono sono template: la stessa funzione gira con il container ft (in testing())
+   e con il suo modello std (in testing_std()), così l'output dei due file deve coincidere. */
+
+static std::string	word(int i)
+{
+	std::ostringstream	ss;
+
+	ss << "w" << (i * 37) % 101;
+	return (ss.str());
+}
+
+template <class Map>
+static void	print_map(std::ofstream & fileout, char const * name, Map const & m)
+{
+	fileout << name << " size : " << m.size() << std::endl;
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+		fileout << "[" << name << "] key = " << it->first << "  value = " << it->second << std::endl;
+}
+
+template <class Set>
+static void	print_set(std::ofstream & fileout, char const * name, Set const & s)
+{
+	fileout << name << " size : " << s.size() << std::endl;
+	for (typename Set::const_iterator it = s.begin(); it != s.end(); ++it)
+		fileout << "[" << name << "] = " << *it << std::endl;
+}
+
+/* Chiave la cui copia lancia se ha il valore 'throw_on' (-1: mai). */
+static int	throw_on = -1;
+
+struct ThrowingKey
+{
+	int	v;
+
+	explicit ThrowingKey(int x) : v(x) {}
+	ThrowingKey(ThrowingKey const & other) : v(other.v)
+	{
+		if (v == throw_on)
+			throw 42;
+	}
+	ThrowingKey &	operator=(ThrowingKey const & other) { v = other.v; return (*this); }
+	bool	operator<(ThrowingKey const & other) const { return (v < other.v); }
+};
+
+template <class Map>
+static void	test_flat_map(std::ofstream & fileout)
+{
+	typedef typename Map::value_type	value_type;
+
+	fileout << "\n\n************** TESTING FLAT_MAP **************\n" << std::endl;
+	Map								m;
+	std::vector<value_type>			values;
+
+	for (int i = 0; i < 40; i++)
+		m.insert(value_type((i * 7) % 40, word(i)));
+	print_map(fileout, "insert", m);
+
+	fileout << "\n\n TESTING RANGE INSERT (duplicati: vince il primo) \n" << std::endl;
+	for (int i = 0; i < 60; i++)
+		values.push_back(value_type((i * 13) % 75 + 20, "range" + word(i)));
+	for (int i = 0; i < 10; i++)
+		values.push_back(value_type(50 + i, "dup" + word(i)));
+	m.insert(values.begin(), values.end());
+	print_map(fileout, "range", m);
+
+	fileout << "\n\n TESTING RANGE INSERT (coda ordinata) \n" << std::endl;
+	values.clear();
+	for (int i = 0; i < 10; i++)
+		values.push_back(value_type(200 + i * 3, word(i)));
+	m.insert(values.begin(), values.end());
+	m.insert(values.begin(), values.end());
+	print_map(fileout, "sorted_tail", m);
+
+	fileout << "\n\n TESTING RANGE CONSTRUCTOR \n" << std::endl;
+	Map	built(values.rbegin(), values.rend());
+	print_map(fileout, "built", built);
+
+	fileout << "\n\n TESTING HINT, OPERATOR[], FIND, BOUNDS \n" << std::endl;
+	m.insert(m.end(), value_type(500, "end hint"));
+	m.insert(m.begin(), value_type(-1, "begin hint"));
+	m.insert(m.begin(), value_type(100, "wrong hint"));
+	m[7] = "changed";
+	m[1000] = "added";
+	fileout << "find(13) : " << m.find(13)->second << std::endl;
+	fileout << "find(999) == end : " << (m.find(999) == m.end()) << std::endl;
+	fileout << "count(20) : " << m.count(20) << "  count(21) : " << m.count(21) << std::endl;
+	fileout << "lower_bound(96) : " << m.lower_bound(96)->first << std::endl;
+	fileout << "upper_bound(96) : " << m.upper_bound(96)->first << std::endl;
+	print_map(fileout, "hint", m);
+
+	fileout << "\n\n TESTING ERASE \n" << std::endl;
+	fileout << "erase(7) : " << m.erase(7) << "  erase(7) : " << m.erase(7) << std::endl;
+	m.erase(m.begin());
+	m.erase(m.find(30), m.find(60));
+	print_map(fileout, "erase", m);
+
+	fileout << "\n\n TESTING COPY, SWAP, COMPARISON \n" << std::endl;
+	Map	copy(m);
+	fileout << "copy == m : " << (copy == m) << std::endl;
+	copy[3] = "different";
+	fileout << "copy == m : " << (copy == m) << "  copy < m : " << (copy < m) << std::endl;
+	copy.swap(built);
+	print_map(fileout, "copy", copy);
+	print_map(fileout, "built", built);
+}
+
+template <class Set>
+static void	test_flat_set(std::ofstream & fileout)
+{
+	fileout << "\n\n************** TESTING FLAT_SET **************\n" << std::endl;
+	Set					s;
+	std::vector<int>	values;
+
+	for (int i = 0; i < 30; i++)
+		s.insert((i * 11) % 30);
+	for (int i = 0; i < 50; i++)
+		values.push_back((i * 17) % 45 + 10);
+	s.insert(values.begin(), values.end());
+	print_set(fileout, "range", s);
+
+	fileout << "\n\n TESTING INPUT ITERATOR RANGE \n" << std::endl;
+	std::istringstream	in("90 3 88 3 91 -4 90 87");
+
+	s.insert(std::istream_iterator<int>(in), std::istream_iterator<int>());
+	print_set(fileout, "input", s);
+
+	fileout << "\n\n TESTING ERASE, FIND, BOUNDS \n" << std::endl;
+	fileout << "erase(3) : " << s.erase(3) << "  erase(1000) : " << s.erase(1000) << std::endl;
+	s.erase(s.find(20), s.find(40));
+	fileout << "count(41) : " << s.count(41) << "  lower_bound(19) : " << *s.lower_bound(19) << std::endl;
+	print_set(fileout, "erase", s);
+
+	Set	strings;
+
+	for (int i = 0; i < 20; i++)
+		strings.insert(i);
+	Set	other(strings);
+	other.swap(s);
+	print_set(fileout, "swap", other);
+}
+
+/* Un range la cui copia lancia a metà: il container resta ordinato e con gli elementi di prima. */
+template <class Set>
+static void	test_flat_throw(std::ofstream & fileout)
+{
+	Set							s;
+	std::vector<ThrowingKey>	values;
+	bool						thrown = false;
+
+	for (int i = 0; i < 20; i += 2)
+		s.insert(ThrowingKey(i));
+	for (int i = 39; i > 0; i -= 3)
+		values.push_back(ThrowingKey(i));
+	throw_on = 21;
+	try
+	{
+		s.insert(values.begin(), values.end());
+	}
+	catch (int)
+	{
+		thrown = true;
+	}
+	throw_on = -1;
+
+	bool	sorted = true;
+	bool	kept = true;
+
+	for (typename Set::const_iterator it = s.begin(), prev = it; it != s.end(); prev = it++)
+		if (it != prev && !(*prev < *it))
+			sorted = false;
+	for (int i = 0; i < 20; i += 2)
+		if (s.count(ThrowingKey(i)) != 1)
+			kept = false;
+	fileout << "\n\n TESTING THROWING RANGE INSERT \n" << std::endl;
+	fileout << "thrown : " << thrown << "  sorted : " << sorted << "  old elements kept : " << kept << std::endl;
+}
+
+/* Le unordered non hanno un ordine di iterazione: si confrontano con std::map/std::set stampando il
+   contenuto ordinato. Le operazioni sulla tabella passano da table_ops, che per il modello std non
+   fa nulla e considera veri i controlli. */
+template <class C>
+struct table_ops
+{
+	typedef typename C::iterator	iterator;
+
+	static void			rehash(C &, std::size_t) {}
+	static void			reserve(C &, std::size_t) {}
+	static void			max_load_factor(C &, float) {}
+	static std::size_t	bucket_count(C const &) { return (0); }
+	static bool			valid(C const &) { return (true); }
+
+	static iterator		erase(C & c, iterator it)
+	{
+		iterator	next = it;
+
+		++next;
+		c.erase(it);
+		return (next);
+	}
+};
+
+template <class C>
+struct hashed_table_ops
+{
+	typedef typename C::iterator	iterator;
+
+	static void			rehash(C & c, std::size_t n) { c.rehash(n); }
+	static void			reserve(C & c, std::size_t n) { c.reserve(n); }
+	static void			max_load_factor(C & c, float ml) { c.max_load_factor(ml); }
+	static std::size_t	bucket_count(C const & c) { return (c.bucket_count()); }
+	static iterator		erase(C & c, iterator it) { return (c.erase(it)); }
+
+	/* Numero di bucket potenza di 2, fattore di carico nel limite e tutti gli elementi raggiungibili. */
+	static bool			valid(C const & c)
+	{
+		std::size_t	n = 0;
+
+		for (typename C::const_iterator it = c.begin(); it != c.end(); ++it)
+			n++;
+		return (n == c.size() && (c.bucket_count() & (c.bucket_count() - 1)) == 0
+			&& c.load_factor() <= c.max_load_factor());
+	}
+};
+
+template <class K, class T, class H, class E, class A>
+struct table_ops<ft::unordered_map<K, T, H, E, A> > : public hashed_table_ops<ft::unordered_map<K, T, H, E, A> > {};
+
+template <class K, class H, class E, class A>
+struct table_ops<ft::unordered_set<K, H, E, A> > : public hashed_table_ops<ft::unordered_set<K, H, E, A> > {};
+
+template <class Map>
+static void	print_unordered_map(std::ofstream & fileout, char const * name, Map const & m)
+{
+	std::vector<std::pair<typename Map::key_type, typename Map::mapped_type> >	sorted;
+
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+		sorted.push_back(std::make_pair(it->first, it->second));
+	std::sort(sorted.begin(), sorted.end());
+	fileout << name << " size : " << m.size() << "  valid : " << table_ops<Map>::valid(m) << std::endl;
+	for (std::size_t i = 0; i < sorted.size(); i++)
+		fileout << "[" << name << "] key = " << sorted[i].first << "  value = " << sorted[i].second << std::endl;
+}
+
+template <class Set>
+static void	print_unordered_set(std::ofstream & fileout, char const * name, Set const & s)
+{
+	std::vector<typename Set::key_type>	sorted;
+
+	for (typename Set::const_iterator it = s.begin(); it != s.end(); ++it)
+		sorted.push_back(*it);
+	std::sort(sorted.begin(), sorted.end());
+	fileout << name << " size : " << s.size() << "  valid : " << table_ops<Set>::valid(s) << std::endl;
+	for (std::size_t i = 0; i < sorted.size(); i++)
+		fileout << "[" << name << "] = " << sorted[i] << std::endl;
+}
+
+template <class Key>
+static Key	make_key(int i)
+{
+	return (Key(i));
+}
+
+template <>
+std::string	make_key<std::string>(int i)
+{
+	return (word(i));
+}
+
+/* Hash con tre soli valori: sequenze di sondaggio lunghe e distanze oltre la saturazione. */
+struct FewHashes
+{
+	std::size_t	operator()(int key) const { return (static_cast<std::size_t>(key % 3)); }
+};
+
+template <class Map, class StringMap>
+static void	test_unordered_map(std::ofstream & fileout)
+{
+	typedef typename Map::value_type	value_type;
+	typedef table_ops<Map>				table;
+
+	fileout << "\n\n************** TESTING UNORDERED_MAP **************\n" << std::endl;
+	Map		m;
+
+	for (int i = 0; i < 300; i++)
+		m.insert(value_type((i * 7) % 300, word(i)));
+	fileout << "insert(5).second : " << m.insert(value_type(5, "dup")).second
+		<< "  insert(300).second : " << m.insert(value_type(300, "new")).second << std::endl;
+	m[17] = "changed";
+	m[1000] = "added";
+	fileout << "find(17) : " << m.find(17)->second << "  find(999) == end : " << (m.find(999) == m.end()) << std::endl;
+	fileout << "count(20) : " << m.count(20) << "  count(-1) : " << m.count(-1) << std::endl;
+	print_unordered_map(fileout, "insert", m);
+
+	fileout << "\n\n TESTING ERASE \n" << std::endl;
+	fileout << "erase(7) : " << m.erase(7) << "  erase(7) : " << m.erase(7) << std::endl;
+	for (int i = 0; i < 300; i += 11)
+		m.erase(i);
+	m.erase(m.find(1000));
+	print_unordered_map(fileout, "erase", m);
+
+	fileout << "\n\n TESTING ERASE WHILE ITERATING \n" << std::endl;
+	std::size_t	visited = 0;
+	std::size_t	before = m.size();
+
+	for (typename Map::iterator it = m.begin(); it != m.end(); visited++)
+	{
+		if (it->first % 3 == 0)
+			it = table::erase(m, it);
+		else
+			++it;
+	}
+	fileout << "visited all : " << (visited == before) << std::endl;
+	print_unordered_map(fileout, "erase_iter", m);
+
+	fileout << "\n\n TESTING REHASH, RESERVE, MAX_LOAD_FACTOR \n" << std::endl;
+	table::rehash(m, 1000);
+	fileout << "rehash : " << table::valid(m) << "  " << (table::bucket_count(m) >= 1000 || !table::bucket_count(m)) << std::endl;
+	table::reserve(m, 2000);
+	std::size_t	buckets = table::bucket_count(m);
+
+	for (int i = 2000; i < 3500; i++)
+		m[i] = word(i);
+	fileout << "reserve keeps buckets : " << (table::bucket_count(m) == buckets) << std::endl;
+	table::max_load_factor(m, 0.25f);
+	fileout << "max_load_factor(0.25) : " << table::valid(m) << std::endl;
+	for (int i = 2000; i < 3500; i += 2)
+		m.erase(i);
+	table::max_load_factor(m, 0.9f);
+	table::rehash(m, 0);
+	print_unordered_map(fileout, "rehash", m);
+
+	fileout << "\n\n TESTING COPY, SWAP, COMPARISON \n" << std::endl;
+	Map	copy(m);
+	Map	other;
+
+	fileout << "copy == m : " << (copy == m) << std::endl;
+	copy[3] = "different";
+	fileout << "copy == m : " << (copy == m) << "  copy != m : " << (copy != m) << std::endl;
+	for (int i = 0; i < 10; i++)
+		other[i * 100] = word(i);
+	copy.swap(other);
+	print_unordered_map(fileout, "copy", copy);
+	swap(m, other);
+	fileout << "m size : " << m.size() << "  other size : " << other.size() << std::endl;
+	other = copy;
+	fileout << "other == copy : " << (other == copy) << std::endl;
+	m.clear();
+	print_unordered_map(fileout, "clear", m);
+
+	fileout << "\n\n TESTING STRING KEYS \n" << std::endl;
+	StringMap	words;
+
+	for (int i = 0; i < 250; i++)
+		words[word(i)] += 1;
+	for (typename StringMap::iterator it = words.begin(); it != words.end(); )
+	{
+		if (it->second % 2)
+			it = table_ops<StringMap>::erase(words, it);
+		else
+			++it;
+	}
+	fileout << "count(w0) : " << words.count("w0") << "  count(x) : " << words.count("x") << std::endl;
+	print_unordered_map(fileout, "strings", words);
+}
+
+template <class Map>
+static void	test_unordered_collisions(std::ofstream & fileout)
+{
+	typedef typename Map::value_type	value_type;
+
+	fileout << "\n\n TESTING FEW HASH VALUES \n" << std::endl;
+	Map		m;
+
+	table_ops<Map>::reserve(m, 600);
+	for (int i = 0; i < 600; i++)
+		m.insert(value_type((i * 17) % 600, i));
+	for (int i = 0; i < 600; i += 4)
+		m.erase(i);
+	for (int i = 0; i < 100; i++)
+		m.insert(value_type(i * 1000, i));
+	print_unordered_map(fileout, "few_hashes", m);
+}
+
+template <class Set>
+static void	test_unordered_set(std::ofstream & fileout)
+{
+	typedef typename Set::key_type	key_type;
+	typedef table_ops<Set>			table;
+
+	fileout << "\n\n************** TESTING UNORDERED_SET **************\n" << std::endl;
+	Set		s;
+
+	for (int i = 0; i < 200; i++)
+		s.insert(make_key<key_type>((i * 13) % 150));
+	fileout << "insert(1).second : " << s.insert(make_key<key_type>(1)).second << std::endl;
+	fileout << "erase(2) : " << s.erase(make_key<key_type>(2)) << "  erase(2) : " << s.erase(make_key<key_type>(2)) << std::endl;
+	s.erase(s.find(make_key<key_type>(3)));
+	print_unordered_set(fileout, "insert", s);
+
+	int	n = 0;
+
+	for (typename Set::iterator it = s.begin(); it != s.end(); n++)
+	{
+		if (n % 2)
+			++it;
+		else
+			it = table::erase(s, it);
+	}
+	fileout << "erase_iter size : " << s.size() << "  valid : " << table::valid(s) << std::endl;
+
+	Set		copy(s);
+
+	table::rehash(copy, 4096);
+	table::max_load_factor(copy, 0.5f);
+	fileout << "copy == s : " << (copy == s) << "  valid : " << table::valid(copy) << std::endl;
+	s.clear();
+	for (int i = 0; i < 50; i++)
+		s.insert(make_key<key_type>(i));
+	s.swap(copy);
+	print_unordered_set(fileout, "swap", copy);
+}
+
+/* Gli algoritmi di <algorithm> con l'interfaccia di ft::dary_heap, come modello in testing_std().
+   std::is_heap arriva solo con C++11: qui è scritto per lo heap binario. */
+struct std_heap
+{
+	template <class RandomIt, class Compare>
+	static void	push_heap(RandomIt first, RandomIt last, Compare comp) { std::push_heap(first, last, comp); }
+
+	template <class RandomIt, class Compare>
+	static void	pop_heap(RandomIt first, RandomIt last, Compare comp) { std::pop_heap(first, last, comp); }
+
+	template <class RandomIt, class Compare>
+	static void	make_heap(RandomIt first, RandomIt last, Compare comp) { std::make_heap(first, last, comp); }
+
+	template <class RandomIt, class Compare>
+	static void	sort_heap(RandomIt first, RandomIt last, Compare comp) { std::sort_heap(first, last, comp); }
+
+	template <class RandomIt, class Compare>
+	static bool	is_heap(RandomIt first, RandomIt last, Compare comp)
+	{
+		for (std::ptrdiff_t child = 1; child < last - first; child++)
+			if (comp(first[(child - 1) / 2], first[child]))
+				return (false);
+		return (true);
+	}
+};
+
+/* Con arità diverse la disposizione dello heap cambia: si confrontano solo i risultati che non ne
+   dipendono (validità, ordine dei pop, sort_heap). */
+template <class Heap>
+static void	test_heap_algorithms(std::ofstream & fileout, char const * name)
+{
+	std::vector<int>	v;
+	bool				valid = true;
+
+	fileout << "\n\n TESTING HEAP ALGORITHMS (" << name << ") \n" << std::endl;
+	for (int i = 0; i < 200; i++)
+		v.push_back((i * 7919) % 503 % 120);
+	Heap::make_heap(v.begin(), v.end(), std::less<int>());
+	fileout << "make_heap : " << Heap::is_heap(v.begin(), v.end(), std::less<int>()) << std::endl;
+	for (int i = 0; i < 60; i++)
+	{
+		v.push_back((i * 31) % 150);
+		Heap::push_heap(v.begin(), v.end(), std::less<int>());
+		valid = valid && Heap::is_heap(v.begin(), v.end(), std::less<int>());
+	}
+	fileout << "push_heap : " << valid << std::endl << "pop_heap :";
+	while (v.size() > 100)
+	{
+		Heap::pop_heap(v.begin(), v.end(), std::less<int>());
+		fileout << " " << v.back();
+		v.pop_back();
+		valid = valid && Heap::is_heap(v.begin(), v.end(), std::less<int>());
+	}
+	fileout << std::endl << "valid : " << valid << std::endl << "sort_heap :";
+	Heap::sort_heap(v.begin(), v.end(), std::less<int>());
+	for (std::size_t i = 0; i < v.size(); i++)
+		fileout << " " << v[i];
+	fileout << std::endl << "min heap :";
+	Heap::make_heap(v.begin(), v.end(), std::greater<int>());
+	for (int i = 0; i < 20; i++)
+	{
+		Heap::pop_heap(v.begin(), v.end() - i, std::greater<int>());
+		fileout << " " << *(v.end() - i - 1);
+	}
+
+	int	broken[] = { 9, 4, 10, 1 };
+
+	fileout << std::endl << "is_heap(broken) : " << Heap::is_heap(broken, broken + 4, std::less<int>()) << std::endl;
+}
+
+/* Modello di ft::indexed_heap per testing_std(): i valori stanno in una std::map indicizzata dalla handle
+   e la cima si cerca scorrendola tutta. Come nell'originale le handle libere vengono riusate. */
+class indexed_heap_model
+{
+	public:
+		typedef std::size_t	handle_type;
+		typedef std::size_t	size_type;
+
+		indexed_heap_model() : _next(0) {}
+
+		bool		empty() const	{ return (_values.empty()); }
+		size_type	size() const	{ return (_values.size()); }
+
+		handle_type	top_handle() const
+		{
+			if (empty())
+				throw std::out_of_range("top_handle");
+
+			std::map<handle_type, int>::const_iterator	best = _values.begin();
+
+			for (std::map<handle_type, int>::const_iterator it = _values.begin(); it != _values.end(); ++it)
+				if (best->second < it->second)
+					best = it;
+			return (best->first);
+		}
+
+		int const &	top() const	{ return (_values.find(top_handle())->second); }
+		void		pop()		{ erase(top_handle()); }
+
+		handle_type	push(int value)
+		{
+			handle_type	handle = _next;
+
+			if (_free.empty())
+				_next++;
+			else
+			{
+				handle = _free.back();
+				_free.pop_back();
+			}
+			_values[handle] = value;
+			return (handle);
+		}
+
+		bool		contains(handle_type handle) const	{ return (_values.count(handle) != 0); }
+
+		int const &	value(handle_type handle) const
+		{
+			if (!contains(handle))
+				throw std::out_of_range("value");
+			return (_values.find(handle)->second);
+		}
+
+		void		decrease_key(handle_type handle, int value)
+		{
+			if (value < this->value(handle))
+				throw std::invalid_argument("decrease_key");
+			_values[handle] = value;
+		}
+
+		void		update(handle_type handle, int value)
+		{
+			this->value(handle);
+			_values[handle] = value;
+		}
+
+		void		erase(handle_type handle)
+		{
+			this->value(handle);
+			_values.erase(handle);
+			_free.push_back(handle);
+		}
+
+	private:
+		std::map<handle_type, int>	_values;
+		std::vector<handle_type>	_free;
+		handle_type					_next;
+};
+
+/* Tutti i valori nello heap sono distinti, così la handle in cima non dipende dall'arità. */
+template <class Heap>
+static void	test_indexed_heap(std::ofstream & fileout, char const * name)
+{
+	typedef typename Heap::handle_type	handle_type;
+
+	fileout << "\n\n************** TESTING INDEXED_HEAP (" << name << ") **************\n" << std::endl;
+	Heap						heap;
+	std::vector<handle_type>	handles;
+
+	for (int i = 0; i < 100; i++)
+		handles.push_back(heap.push((i * 37) % 101));
+	fileout << "size : " << heap.size() << "  top : " << heap.top() << std::endl << "decrease_key :";
+	for (int i = 0; i < 100; i += 5)
+	{
+		heap.decrease_key(handles[i], heap.value(handles[i]) + 150);
+		fileout << " " << heap.top();
+	}
+	fileout << std::endl;
+
+	bool	invalid = false;
+	bool	outOfRange = false;
+
+	try
+	{
+		heap.decrease_key(handles[1], heap.value(handles[1]) - 1);
+	}
+	catch (std::invalid_argument &)
+	{
+		invalid = true;
+	}
+	try
+	{
+		heap.value(1000);
+	}
+	catch (std::out_of_range &)
+	{
+		outOfRange = true;
+	}
+	fileout << "invalid_argument : " << invalid << "  value kept : " << heap.value(handles[1])
+		<< "  out_of_range : " << outOfRange << std::endl << "update :";
+	for (int i = 0; i < 100; i += 3)
+	{
+		heap.update(handles[i], i % 2 ? 300 + (i * 53) % 307 : -1 - (i * 53) % 307);
+		fileout << " " << heap.top();
+	}
+	fileout << std::endl;
+
+	std::vector<handle_type>	erased;
+	bool						gone = true;
+
+	for (int i = 1; i < 100; i += 4)
+	{
+		heap.erase(handles[i]);
+		erased.push_back(handles[i]);
+	}
+	erased.push_back(heap.top_handle());
+	heap.erase(erased.back());
+	for (std::size_t i = 0; i < erased.size(); i++)
+		gone = gone && !heap.contains(erased[i]);
+	fileout << "erase : " << heap.size() << "  top : " << heap.top() << "  erased gone : " << gone << std::endl;
+
+	std::vector<handle_type>	fresh;
+	bool						values = true;
+
+	for (std::size_t i = 0; i < erased.size(); i++)
+		fresh.push_back(heap.push(1000 + static_cast<int>(i)));
+	for (std::size_t i = 0; i < fresh.size(); i++)
+		values = values && heap.value(fresh[i]) == 1000 + static_cast<int>(i);
+	std::sort(erased.begin(), erased.end());
+	std::sort(fresh.begin(), fresh.end());
+	fileout << "handles reused : " << (erased == fresh) << "  values : " << values << std::endl;
+
+	Heap	copy(heap);
+
+	copy.pop();
+	copy.pop();
+	fileout << "copy : " << copy.size() << " " << copy.top() << "  heap : " << heap.size() << " " << heap.top() << std::endl;
+	fileout << "pop :";
+	while (!heap.empty())
+	{
+		fileout << " " << heap.top();
+		heap.pop();
+	}
+	outOfRange = false;
+	try
+	{
+		heap.pop();
+	}
+	catch (std::out_of_range &)
+	{
+		outOfRange = true;
+	}
+	fileout << std::endl << "pop on empty : " << outOfRange << std::endl;
+}
+
+template <class Queue>
+static void	test_priority_queue(std::ofstream & fileout, char const * name)
+{
+	Queue	q;
+
+	fileout << "\n\n TESTING PRIORITY_QUEUE (" << name << ") \n" << std::endl << "pop :";
+	for (int i = 0; i < 150; i++)
+		q.push((i * 97) % 211 % 80);
+	for (int i = 0; i < 50; i++)
+	{
+		fileout << " " << q.top();
+		q.pop();
+	}
+	for (int i = 0; i < 40; i++)
+		q.push(i * 3);
+	fileout << std::endl << "size : " << q.size() << std::endl << "drain :";
+	while (!q.empty())
+	{
+		fileout << " " << q.top();
+		q.pop();
+	}
+	fileout << std::endl;
+}
+
+/* select, rank e it + n / it - n di ft::set e ft::map; per std::set e std::map il modello è std::advance
+   e std::distance. Fuori dal range [begin(), end()] si arriva su end(), come fa RBNavigator::advance. */
+template <class C>
+struct order_ops
+{
+	typedef typename C::const_iterator	const_iterator;
+	typedef typename C::key_type		key_type;
+
+	static const_iterator	select(C const & c, std::size_t k)
+	{
+		const_iterator	it = c.begin();
+
+		if (k >= c.size())
+			return (c.end());
+		std::advance(it, k);
+		return (it);
+	}
+
+	static std::size_t		rank(C const & c, key_type const & key)
+	{
+		return (std::distance(c.begin(), c.lower_bound(key)));
+	}
+
+	static const_iterator	advance(C const & c, const_iterator it, long n)
+	{
+		long	pos = static_cast<long>(std::distance(c.begin(), it)) + n;
+
+		if (pos < 0 || pos > static_cast<long>(c.size()))
+			return (c.end());
+		return (select(c, pos));
+	}
+};
+
+template <class C>
+struct tree_order_ops
+{
+	typedef typename C::const_iterator	const_iterator;
+	typedef typename C::key_type		key_type;
+
+	static const_iterator	select(C const & c, std::size_t k)			{ return (c.select(k)); }
+	static std::size_t		rank(C const & c, key_type const & key)		{ return (c.rank(key)); }
+
+	static const_iterator	advance(C const &, const_iterator it, long n)
+	{
+		return (n < 0 ? it - (-n) : it + n);
+	}
+};
+
+template <class K, class Cmp, class A>
+struct order_ops<ft::set<K, Cmp, A> > : public tree_order_ops<ft::set<K, Cmp, A> > {};
+
+template <class K, class T, class Cmp, class A>
+struct order_ops<ft::map<K, T, Cmp, A> > : public tree_order_ops<ft::map<K, T, Cmp, A> > {};
+
+static int	key_of(int key)
+{
+	return (key);
+}
+
+template <class Pair>
+static int	key_of(Pair const & value)
+{
+	return (value.first);
+}
+
+/* Il valore da inserire: la coppia per le map, la sola chiave per i set. */
+template <class Value>
+struct entry
+{
+	static Value	make(int key, int mapped) { return (Value(key, mapped)); }
+};
+
+template <>
+struct entry<int>
+{
+	static int		make(int key, int) { return (key); }
+};
+
+template <class C>
+static void	print_position(std::ofstream & fileout, C const & c, typename C::const_iterator it)
+{
+	if (it == c.end())
+		fileout << " end";
+	else
+		fileout << " " << key_of(*it);
+}
+
+/* Inserimenti e rimozioni mescolati prima delle verifiche: un 'count' sbagliato in qualche nodo
+   sposterebbe select, rank e i salti lunghi degli iteratori. */
+template <class C>
+static void	test_order_stats(std::ofstream & fileout, char const * name)
+{
+	typedef order_ops<C>					ops;
+	typedef typename C::const_iterator		const_iterator;
+	typedef typename C::value_type			value_type;
+
+	fileout << "\n\n************** TESTING SELECT, RANK, ADVANCE (" << name << ") **************\n" << std::endl;
+	C		c;
+
+	for (int i = 0; i < 600; i++)
+		c.insert(entry<value_type>::make((i * 7919) % 2003, i));
+	for (int i = 0; i < 2003; i += 3)
+		c.erase(i);
+	for (int i = 0; i < 200; i++)
+		c.insert(entry<value_type>::make((i * 331) % 2500, i));
+	c.erase(c.find(key_of(*c.begin())));
+	c.erase(c.lower_bound(700), c.lower_bound(900));
+
+	long	size = static_cast<long>(c.size());
+
+	fileout << "size : " << size << std::endl << "select :";
+	for (long k = 0; k <= size + 1; k++)
+		print_position(fileout, c, ops::select(c, k));
+	fileout << std::endl << "rank :";
+	for (int key = -5; key < 2520; key += 7)
+		fileout << " " << ops::rank(c, key);
+
+	long	hops[] = { 0, 1, -1, 2, -2, 7, -7, 8, -8, 50, -50, 1000, -1000 };
+
+	fileout << std::endl << "advance :";
+	for (long pos = 0; pos <= size; pos += 11)
+	{
+		const_iterator	it = ops::select(c, pos);
+
+		for (std::size_t h = 0; h < sizeof(hops) / sizeof(hops[0]); h++)
+			print_position(fileout, c, ops::advance(c, it, hops[h]));
+		print_position(fileout, c, ops::advance(c, it, -pos));
+		print_position(fileout, c, ops::advance(c, it, -pos - 1));
+		print_position(fileout, c, ops::advance(c, it, size - pos));
+		print_position(fileout, c, ops::advance(c, it, size - pos + 1));
+	}
+	fileout << std::endl << "from end :";
+	for (long n = 1; n <= size + 1; n += (n < 10 ? 1 : 37))
+		print_position(fileout, c, ops::advance(c, c.end(), -n));
+	print_position(fileout, c, ops::advance(c, c.end(), 1));
+	print_position(fileout, c, ops::advance(c, c.end(), 9));
+	fileout << std::endl;
+}
+
+/* Modello della node handle per testing_std() (extract() arriva con C++17): tiene una copia del valore
+   e, come la handle di ft in C++98, la copia e l'assegnazione le trasferiscono il valore. */
+template <class Value>
+struct handle_model
+{
+	mutable bool	full;
+	mutable Value	stored;
+
+	handle_model() : full(false), stored() {}
+	handle_model(handle_model const & other) : full(other.full), stored(other.stored) { other.full = false; }
+
+	handle_model &	operator=(handle_model const & other)
+	{
+		if (this != &other)
+		{
+			full = other.full;
+			stored = other.stored;
+			other.full = false;
+		}
+		return (*this);
+	}
+
+	bool	empty() const { return (!full); }
+};
+
+/* extract e insert(node_type) di std::map/std::set ricostruiti con erase e insert. */
+template <class C, class Value>
+struct node_ops_model
+{
+	typedef handle_model<Value>			handle_type;
+	typedef typename C::iterator		iterator;
+	typedef typename C::key_type		key_type;
+
+	static handle_type	extract(C & c, iterator it)
+	{
+		handle_type	handle;
+
+		handle.full = true;
+		handle.stored = Value(*it);
+		c.erase(it);
+		return (handle);
+	}
+
+	static handle_type	extract(C & c, key_type const & key)
+	{
+		iterator	it = c.find(key);
+
+		if (it == c.end())
+			return (handle_type());
+		return (extract(c, it));
+	}
+
+	static ft::pair<iterator, bool>	insert(C & c, handle_type & handle)
+	{
+		if (handle.empty())
+			return (ft::make_pair(c.end(), false));
+
+		std::pair<iterator, bool>	ret = c.insert(handle.stored);
+
+		if (ret.second)
+			handle.full = false;
+		return (ft::make_pair(ret.first, ret.second));
+	}
+
+	static iterator	insert(C & c, iterator hint, handle_type & handle)
+	{
+		if (handle.empty())
+			return (c.end());
+
+		std::size_t	before = c.size();
+		iterator	it = c.insert(hint, handle.stored);
+
+		if (c.size() != before)
+			handle.full = false;
+		return (it);
+	}
+
+	static bool	valid(C const &) { return (true); }
+};
+
+template <class C>
+struct node_ops_tree
+{
+	typedef typename C::node_type		handle_type;
+	typedef typename C::iterator		iterator;
+	typedef typename C::key_type		key_type;
+
+	static handle_type	extract(C & c, iterator it)				{ return (c.extract(it)); }
+	static handle_type	extract(C & c, key_type const & key)	{ return (c.extract(key)); }
+
+	static ft::pair<iterator, bool>	insert(C & c, handle_type & handle)	{ return (c.insert(handle)); }
+	static iterator		insert(C & c, iterator hint, handle_type & handle)	{ return (c.insert(hint, handle)); }
+
+	static bool	valid(C const & c) { return (c.verify() == NULL); }
+};
+
+template <class C>
+struct node_ops;
+
+template <class K, class T, class Cmp, class A>
+struct node_ops<std::map<K, T, Cmp, A> > : public node_ops_model<std::map<K, T, Cmp, A>, std::pair<K, T> >
+{
+	typedef handle_model<std::pair<K, T> >	handle_type;
+
+	static K &	key(handle_type & handle)		{ return (handle.stored.first); }
+	static T &	mapped(handle_type & handle)	{ return (handle.stored.second); }
+};
+
+template <class K, class Cmp, class A>
+struct node_ops<std::set<K, Cmp, A> > : public node_ops_model<std::set<K, Cmp, A>, K>
+{
+	static K &	value(handle_model<K> & handle)	{ return (handle.stored); }
+};
+
+template <class K, class T, class Cmp, class A>
+struct node_ops<ft::map<K, T, Cmp, A> > : public node_ops_tree<ft::map<K, T, Cmp, A> >
+{
+	typedef typename ft::map<K, T, Cmp, A>::node_type	handle_type;
+
+	static K &	key(handle_type & handle)		{ return (handle.key()); }
+	static T &	mapped(handle_type & handle)	{ return (handle.mapped()); }
+};
+
+template <class K, class Cmp, class A>
+struct node_ops<ft::set<K, Cmp, A> > : public node_ops_tree<ft::set<K, Cmp, A> >
+{
+	static K &	value(typename ft::set<K, Cmp, A>::node_type & handle)	{ return (handle.value()); }
+};
+
+/* Stringa oltre la small string optimization, così lo spostamento nella handle e ritorno riguarda
+   memoria allocata. */
+static std::string	long_value(int i)
+{
+	return ("value-long-enough-to-live-on-the-heap-" + word(i));
+}
+
+/* Map di int -> std::string: estrazione, chiave già presente (la handle tiene il valore), chiave
+   cambiata nella handle, handle vuote, trasferimento tra handle e tra container. */
+template <class Map>
+static void	test_node_handle_map(std::ofstream & fileout)
+{
+	typedef node_ops<Map>						ops;
+	typedef typename ops::handle_type			handle_type;
+	typedef typename Map::iterator				iterator;
+	typedef typename Map::value_type			value_type;
+
+	fileout << "\n\n************** TESTING NODE HANDLE (map) **************\n" << std::endl;
+	Map		m;
+
+	for (int i = 0; i < 40; i++)
+		m.insert(value_type(i * 2, long_value(i)));
+
+	handle_type	h = ops::extract(m, m.find(10));
+
+	fileout << "extract(it) : " << h.empty() << " " << ops::key(h) << " " << ops::mapped(h)
+		<< "  size : " << m.size() << "  count(10) : " << m.count(10) << std::endl;
+
+	ops::key(h) = 12;
+	ft::pair<iterator, bool>	ret = ops::insert(m, h);
+
+	fileout << "duplicate : " << ret.second << " " << ret.first->first << " " << ret.first->second
+		<< "  kept : " << !h.empty() << " " << ops::key(h) << " " << ops::mapped(h) << std::endl;
+
+	ops::key(h) = 1001;
+	ops::mapped(h) += "-moved";
+	ret = ops::insert(m, h);
+	fileout << "new key : " << ret.second << " " << ret.first->first << " " << ret.first->second
+		<< "  empty : " << h.empty() << "  next is end : " << (++ret.first == m.end()) << std::endl;
+
+	handle_type	none = ops::extract(m, 3);
+
+	ret = ops::insert(m, none);
+	fileout << "absent key : " << none.empty() << "  insert empty : " << ret.second << " " << (ret.first == m.end())
+		<< "  hint insert empty : " << (ops::insert(m, m.begin(), none) == m.end()) << std::endl;
+
+	handle_type	first = ops::extract(m, 20);
+	handle_type	second(FT_MOVE(first));
+	handle_type	third;
+
+	fileout << "copy : " << first.empty() << " " << second.empty() << " " << ops::mapped(second) << std::endl;
+	third = FT_MOVE(second);
+	fileout << "assign : " << second.empty() << " " << third.empty() << " " << ops::mapped(third) << std::endl;
+
+	Map		other;
+
+	ops::key(third) = -7;
+	ret = ops::insert(other, third);
+	fileout << "other container : " << ret.second << " " << ret.first->first << " " << ret.first->second << std::endl;
+
+	handle_type	hinted = ops::extract(m, m.find(30));
+	iterator	it;
+
+	ops::key(hinted) = 31;
+	it = ops::insert(m, m.find(32), hinted);
+	fileout << "good hint : " << it->first << " " << it->second << " " << hinted.empty() << std::endl;
+	hinted = ops::extract(m, 31);
+	ops::key(hinted) = 77;
+	it = ops::insert(m, m.begin(), hinted);
+	fileout << "wrong hint : " << it->first << " " << it->second << " " << hinted.empty() << std::endl;
+	hinted = ops::extract(m, 77);
+	ops::key(hinted) = 40;
+	it = ops::insert(m, m.find(40), hinted);
+	fileout << "duplicate hint : " << it->first << " " << it->second << " " << hinted.empty() << std::endl;
+
+	/* Ogni elemento fa il giro estrazione, nuova chiave, reinserimento. */
+	for (int key = 0; key < 80; key += 2)
+	{
+		handle_type	round = ops::extract(m, key);
+
+		if (round.empty())
+			continue ;
+		ops::key(round) = 3 * key + 1;
+		ops::mapped(round) += "+";
+		ops::insert(m, round);
+	}
+	fileout << "valid : " << ops::valid(m) << "  " << ops::valid(other) << std::endl;
+	print_map(fileout, "round_trip", m);
+	print_map(fileout, "other", other);
+}
+
+template <class Set>
+static void	test_node_handle_set(std::ofstream & fileout)
+{
+	typedef node_ops<Set>				ops;
+	typedef typename ops::handle_type	handle_type;
+
+	fileout << "\n\n************** TESTING NODE HANDLE (set) **************\n" << std::endl;
+	Set		s;
+
+	for (int i = 0; i < 30; i++)
+		s.insert(long_value(i));
+
+	handle_type	h = ops::extract(s, s.begin());
+
+	fileout << "extract : " << ops::value(h) << "  size : " << s.size() << std::endl;
+	ops::value(h) = long_value(5);
+	fileout << "duplicate : " << ops::insert(s, h).second << "  kept : " << ops::value(h) << std::endl;
+	ops::value(h) = "changed-" + ops::value(h);
+	fileout << "changed : " << ops::insert(s, h).second << "  empty : " << h.empty() << std::endl;
+
+	handle_type	none = ops::extract(s, std::string("missing"));
+	handle_type	moved(FT_MOVE(none));
+
+	fileout << "empty handles : " << none.empty() << " " << moved.empty() << " " << ops::insert(s, moved).second << std::endl;
+	fileout << "valid : " << ops::valid(s) << std::endl;
+	print_set(fileout, "node_set", s);
+}
+
+/* Ordine sulle sole chiavi, per usare gli algoritmi di <algorithm> anche sulle map. */
+struct key_less
+{
+	template <class A, class B>
+	bool	operator()(A const & lhs, B const & rhs) const { return (key_of(lhs) < key_of(rhs)); }
+};
+
+/* merge, join, split, unite, intersect e subtract di ft::set e ft::map; per std::set e std::map il
+   modello è std::set_union, std::set_intersection e std::set_difference. join con chiavi che si
+   sovrappongono diventa una merge, quindi ha lo stesso modello. */
+template <class C>
+struct bulk_ops
+{
+	typedef typename C::value_type	value_type;
+	typedef typename C::key_type	key_type;
+
+	static void	merge(C & c, C & other)
+	{
+		C	left;
+		C	united;
+
+		std::set_intersection(other.begin(), other.end(), c.begin(), c.end(), std::inserter(left, left.end()), key_less());
+		std::set_union(c.begin(), c.end(), other.begin(), other.end(), std::inserter(united, united.end()), key_less());
+		c.swap(united);
+		other.swap(left);
+	}
+
+	static void	join(C & c, C & other)	{ merge(c, other); }
+
+	static void	split(C & c, key_type const & key, C & right)
+	{
+		right.clear();
+		right.insert(c.lower_bound(key), c.end());
+		c.erase(c.lower_bound(key), c.end());
+	}
+
+	static void	unite(C & c, C const & other)
+	{
+		C	result;
+
+		std::set_union(c.begin(), c.end(), other.begin(), other.end(), std::inserter(result, result.end()), key_less());
+		c.swap(result);
+	}
+
+	static void	intersect(C & c, C const & other)
+	{
+		C	result;
+
+		std::set_intersection(c.begin(), c.end(), other.begin(), other.end(), std::inserter(result, result.end()), key_less());
+		c.swap(result);
+	}
+
+	static void	subtract(C & c, C const & other)
+	{
+		C	result;
+
+		std::set_difference(c.begin(), c.end(), other.begin(), other.end(), std::inserter(result, result.end()), key_less());
+		c.swap(result);
+	}
+
+	static bool	valid(C const &) { return (true); }
+};
+
+template <class C>
+struct tree_bulk_ops
+{
+	typedef typename C::key_type	key_type;
+
+	static void	merge(C & c, C & other)								{ c.merge(other); }
+	static void	join(C & c, C & other)								{ c.join(other); }
+	static void	split(C & c, key_type const & key, C & right)		{ c.split(key, right); }
+	static void	unite(C & c, C const & other)						{ c.unite(other); }
+	static void	intersect(C & c, C const & other)					{ c.intersect(other); }
+	static void	subtract(C & c, C const & other)					{ c.subtract(other); }
+	static bool	valid(C const & c)									{ return (c.verify() == NULL); }
+};
+
+template <class K, class Cmp, class A>
+struct bulk_ops<ft::set<K, Cmp, A> > : public tree_bulk_ops<ft::set<K, Cmp, A> > {};
+
+template <class K, class T, class Cmp, class A>
+struct bulk_ops<ft::map<K, T, Cmp, A> > : public tree_bulk_ops<ft::map<K, T, Cmp, A> > {};
+
+static void	print_value(std::ofstream & fileout, int value)
+{
+	fileout << " " << value;
+}
+
+template <class Pair>
+static void	print_value(std::ofstream & fileout, Pair const & value)
+{
+	fileout << " " << value.first << ":" << value.second;
+}
+
+/* Dimensione, validità e contenuto nell'ordine di iterazione. */
+template <class C>
+static void	print_bulk(std::ofstream & fileout, char const * name, C const & c)
+{
+	fileout << name << " " << c.size() << " " << bulk_ops<C>::valid(c) << " :";
+	for (typename C::const_iterator it = c.begin(); it != c.end(); ++it)
+		print_value(fileout, *it);
+	fileout << std::endl;
+}
+
+/* Generatore congruenziale: le due versioni del test devono vedere gli stessi numeri. */
+static unsigned long	next_random(unsigned long & state)
+{
+	state = state * 1103515245UL + 12345UL;
+	return ((state / 65536UL) % 32768UL);
+}
+
+/* Chiavi ordinate e distinte per un caso del test: 'n' chiavi casuali in [low, low + range). */
+static std::vector<int>	random_keys(unsigned long seed, int n, int low, int range)
+{
+	std::set<int>	keys;
+
+	for (int i = 0; i < 4 * n && static_cast<int>(keys.size()) < n; i++)
+		keys.insert(low + static_cast<int>(next_random(seed) % range));
+	return (std::vector<int>(keys.begin(), keys.end()));
+}
+
+template <class C>
+static C	build_bulk(std::vector<int> const & keys, int tag)
+{
+	C	c;
+
+	for (std::size_t i = 0; i < keys.size(); i++)
+		c.insert(entry<typename C::value_type>::make(keys[i], tag));
+	return (c);
+}
+
+/* Un caso: ogni operazione parte da due container nuovi costruiti con le chiavi 'a' e 'b'
+   (valore 1 per il primo, 2 per il secondo, così con le map si vede da quale arriva un elemento). */
+template <class C>
+static void	test_bulk_case(std::ofstream & fileout, char const * name, std::vector<int> const & a, std::vector<int> const & b)
+{
+	typedef bulk_ops<C>	ops;
+
+	fileout << "\n case " << name << std::endl;
+	{
+		C	lhs = build_bulk<C>(a, 1);
+		C	rhs = build_bulk<C>(b, 2);
+
+		ops::merge(lhs, rhs);
+		print_bulk(fileout, "merge", lhs);
+		print_bulk(fileout, "merge rest", rhs);
+	}
+	{
+		C	lhs = build_bulk<C>(a, 1);
+		C	rhs = build_bulk<C>(b, 2);
+
+		ops::join(lhs, rhs);
+		print_bulk(fileout, "join", lhs);
+		print_bulk(fileout, "join rest", rhs);
+	}
+	{
+		C	lhs = build_bulk<C>(a, 1);
+		C	rhs = build_bulk<C>(b, 2);
+
+		ops::unite(lhs, rhs);
+		print_bulk(fileout, "unite", lhs);
+		ops::intersect(rhs, build_bulk<C>(a, 1));
+		print_bulk(fileout, "intersect", rhs);
+	}
+	{
+		C	lhs = build_bulk<C>(a, 1);
+
+		ops::subtract(lhs, build_bulk<C>(b, 2));
+		print_bulk(fileout, "subtract", lhs);
+	}
+
+	int	keys[] = { -1000000, 0, 1, 7, 150, 333, 1000000 };
+
+	if (!a.empty())
+		keys[0] = a[a.size() / 2];
+	for (std::size_t k = 0; k < sizeof(keys) / sizeof(keys[0]); k++)
+	{
+		C	lhs = build_bulk<C>(a, 1);
+		C	rhs = build_bulk<C>(b, 2);
+
+		ops::split(lhs, keys[k], rhs);
+		fileout << "split(" << keys[k] << ")" << std::endl;
+		print_bulk(fileout, "split left", lhs);
+		print_bulk(fileout, "split right", rhs);
+	}
+}
+
+template <class C>
+static void	test_bulk_operations(std::ofstream & fileout, char const * name)
+{
+	std::vector<int>	none;
+	std::vector<int>	one(1, 7);
+	std::vector<int>	other(1, 8);
+	std::vector<int>	evens;
+	std::vector<int>	odds;
+	std::vector<int>	high;
+	std::vector<int>	some = random_keys(1, 60, 0, 200);
+	std::vector<int>	subset;
+
+	fileout << "\n\n************** TESTING MERGE, JOIN, SPLIT, UNITE, INTERSECT, SUBTRACT (" << name << ") **************\n" << std::endl;
+	for (int i = 0; i < 100; i++)
+	{
+		evens.push_back(2 * i);
+		odds.push_back(2 * i + 1);
+		high.push_back(300 + i);
+	}
+	for (std::size_t i = 0; i < some.size(); i += 3)
+		subset.push_back(some[i]);
+	test_bulk_case<C>(fileout, "empty, empty", none, none);
+	test_bulk_case<C>(fileout, "random, empty", some, none);
+	test_bulk_case<C>(fileout, "empty, random", none, some);
+	test_bulk_case<C>(fileout, "single, same single", one, one);
+	test_bulk_case<C>(fileout, "single, other single", one, other);
+	test_bulk_case<C>(fileout, "single, random", one, some);
+	test_bulk_case<C>(fileout, "disjoint, ordered", evens, high);
+	test_bulk_case<C>(fileout, "disjoint, reversed", high, evens);
+	test_bulk_case<C>(fileout, "disjoint, interleaved", evens, odds);
+	test_bulk_case<C>(fileout, "full overlap", some, some);
+	test_bulk_case<C>(fileout, "subset", some, subset);
+	test_bulk_case<C>(fileout, "superset", subset, some);
+	for (unsigned long seed = 2; seed < 8; seed++)
+	{
+		int	na = static_cast<int>(seed * seed * 13 % 500);
+		int	nb = static_cast<int>((9 - seed) * 61 % 400);
+
+		test_bulk_case<C>(fileout, "random", random_keys(seed, na, 0, 1000), random_keys(seed * 7, nb, 0, 1000));
+	}
+	test_bulk_case<C>(fileout, "small, big", random_keys(11, 5, 0, 1000), random_keys(12, 600, 0, 1000));
+	test_bulk_case<C>(fileout, "big, small", random_keys(13, 600, 0, 1000), random_keys(14, 5, 0, 1000));
+}
 
 void testing()
 {
@@ -208,6 +1527,28 @@ void testing()
 	fileout << std::endl;
 	for(ite = set3.begin(); ite != set3.end(); ++ite)
 		fileout << "[set3] = " << *ite << std::endl;
+
+	test_flat_map<ft::flat_map<int, std::string> >(fileout);
+	test_flat_set<ft::flat_set<int> >(fileout);
+	test_flat_throw<ft::flat_set<ThrowingKey> >(fileout);
+	test_unordered_map<ft::unordered_map<int, std::string>, ft::unordered_map<std::string, int> >(fileout);
+	test_unordered_collisions<ft::unordered_map<int, int, FewHashes> >(fileout);
+	test_unordered_set<ft::unordered_set<int> >(fileout);
+	test_unordered_set<ft::unordered_set<std::string> >(fileout);
+	test_heap_algorithms<ft::dary_heap<2> >(fileout, "d=2");
+	test_heap_algorithms<ft::dary_heap<3> >(fileout, "d=3");
+	test_heap_algorithms<ft::dary_heap<4> >(fileout, "d=4");
+	test_priority_queue<ft::priority_queue<int, ft::vector<int>, std::less<int>, 4> >(fileout, "d=4");
+	test_priority_queue<ft::priority_queue<int, ft::deque<int>, std::less<int>, 3> >(fileout, "deque, d=3");
+	test_indexed_heap<ft::indexed_heap<int> >(fileout, "d=2");
+	test_indexed_heap<ft::indexed_heap<int, std::less<int>, 3> >(fileout, "d=3");
+	test_indexed_heap<ft::indexed_heap<int, std::less<int>, 4> >(fileout, "d=4");
+	test_order_stats<ft::set<int> >(fileout, "set");
+	test_order_stats<ft::map<int, int> >(fileout, "map");
+	test_node_handle_map<ft::map<int, std::string> >(fileout);
+	test_node_handle_set<ft::set<std::string> >(fileout);
+	test_bulk_operations<ft::set<int> >(fileout, "set");
+	test_bulk_operations<ft::map<int, int> >(fileout, "map");
 }
 
 
@@ -409,6 +1750,28 @@ void testing_std()
 	fileout << std::endl;
 	for(ite = set3.begin(); ite != set3.end(); ++ite)
 		fileout << "[set3] = " << *ite << std::endl;
+
+	test_flat_map<std::map<int, std::string> >(fileout);
+	test_flat_set<std::set<int> >(fileout);
+	test_flat_throw<std::set<ThrowingKey> >(fileout);
+	test_unordered_map<std::map<int, std::string>, std::map<std::string, int> >(fileout);
+	test_unordered_collisions<std::map<int, int> >(fileout);
+	test_unordered_set<std::set<int> >(fileout);
+	test_unordered_set<std::set<std::string> >(fileout);
+	test_heap_algorithms<std_heap>(fileout, "d=2");
+	test_heap_algorithms<std_heap>(fileout, "d=3");
+	test_heap_algorithms<std_heap>(fileout, "d=4");
+	test_priority_queue<std::priority_queue<int> >(fileout, "d=4");
+	test_priority_queue<std::priority_queue<int, std::deque<int> > >(fileout, "deque, d=3");
+	test_indexed_heap<indexed_heap_model>(fileout, "d=2");
+	test_indexed_heap<indexed_heap_model>(fileout, "d=3");
+	test_indexed_heap<indexed_heap_model>(fileout, "d=4");
+	test_order_stats<std::set<int> >(fileout, "set");
+	test_order_stats<std::map<int, int> >(fileout, "map");
+	test_node_handle_map<std::map<int, std::string> >(fileout);
+	test_node_handle_set<std::set<std::string> >(fileout);
+	test_bulk_operations<std::set<int> >(fileout, "set");
+	test_bulk_operations<std::map<int, int> >(fileout, "map");
 }
 int main(void)
 {
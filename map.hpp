@@ -8,7 +8,7 @@
 namespace ft
 {
 	template <class Key, class T, class Compare = std::less<Key>, class Allocator = std::allocator<ft::pair<const Key, T> > >
-	class map : public RBTree<ft::pair<const Key, T>, Node<ft::pair<const Key, T> >,  RBIterator<ft::pair<const Key, T>, Compare, Node<ft::pair<const Key, T> > >, RBIteratorConst<ft::pair<const Key, T>, Compare, Node<ft::pair<const Key, T> > >, Compare, Allocator>
+	class map : public RBTree<ft::pair<const Key, T>, Node<ft::pair<const Key, T> >,  RBIterator<ft::pair<const Key, T>, Compare, Node<ft::pair<const Key, T> > >, RBIteratorConst<ft::pair<const Key, T>, Compare, Node<ft::pair<const Key, T> > >, select_first<ft::pair<const Key, T> >, Compare, Allocator>
 	{
 		public:
 
@@ -26,6 +26,8 @@ namespace ft
 			typedef RBIterator<value_type, Compare, Node<value_type> >					iterator;
 			typedef RBIteratorConst<value_type, Compare, Node<value_type> >				const_iterator;
 			typedef Compare																key_compare;
+			typedef RBTree<value_type, Node<value_type>, iterator, const_iterator, select_first<value_type>, Compare, Allocator>	tree_type;
+			typedef map_node_handle<Key, T>												node_type;
 
 
 			// * COSTRUTTORI * //
@@ -48,21 +50,14 @@ namespace ft
 				this->insert(first, last);
 			};
 
-			// Copy Constructor
-			map (const map& other)
-			{
-				this->insert(other.begin(), other.end());
-			};
+			// Copy Constructor: copia strutturale dell'albero, vedi RBTree::cloneFrom
+			map (const map& other) : tree_type(other) {};
 
 			// Copy Assign Operator
 			map& operator=( map const & other )
 			{
-				if (this == &other)
-					return (*this);
-				this->clear();
-				this->insert(other.begin(), other.end());
+				tree_type::operator=(other);
 				return (*this);
-
 			};
 
 			// Destructor
@@ -75,18 +70,15 @@ namespace ft
 			// * MEMBER FUNCTION *//
 
 
+			/* Una sola discesa (lower bound): se la chiave c'è non viene costruito nessun mapped_type,
+			   altrimenti il lower bound è esattamente il punto di inserimento e viene usato come suggerimento. */
 			T& operator[] (const Key& key)
 			{
-				try
-				{
-					return at(key);
-				}
-				catch(const std::exception& e)
-				{
-					ft::pair<key_type, mapped_type>	ret(key, mapped_type());
-					insert(ret);
-					return (at(key));
-				}
+				pointer	node = this->lowerBound(key);
+
+				if (node == this->_sentinel || this->_c(key, node->data.first))
+					node = this->insertHint(node, value_type(key, mapped_type()));
+				return (node->data.second);
 			};
 
 			T& at (const Key& key)
@@ -100,269 +92,142 @@ namespace ft
 
 			const mapped_type& at (const Key& key) const
 			{
-				iterator tmp = find(key);
+				const_iterator tmp = find(key);
 
 				if (tmp.node == this->_sentinel)
 					throw std::out_of_range("ft::map::at");
-				return (tmp.second);
+				return (tmp->second);
 			};
 
-			/*	Inserisce un valore all'interno dell'albero. Dal valore crea un nodo e controlla
-				se la mappa è vuota e in caso imposta il nodo come nuova root.
-				Altrimenti controlla la prima direzione da prendere dalla root in modo da avere
-				un parent da utilizzare nella funzione insertNode. Altrimenti elimina il nodo
-				e ritorna false. */
+			/*	Inserisce un valore all'interno dell'albero con una sola discesa iterativa (vedi RBTree::insertUnique):
+				la stessa discesa trova il punto di inserimento e, se la chiave è già presente, il nodo esistente.
+				Il nodo viene allocato solo se la chiave non c'è. */
 			ft::pair<iterator, bool> insert( ft::pair<const Key, T> const &value )
 			{
-				ft::pair<iterator, bool>	dst;
-				pointer node = new Node<value_type>(value);
-
-				node->color = RED;
-				node->parent = this->_sentinel;
-				node->child[LEFT] = this->_sentinel;
-				node->child[RIGHT] = this->_sentinel;
-
-				if (this->empty())
-				{
-					this->_root = node;
-					this->_sentinel->parent = node;
-					node->color = BLACK;
-					this->_size++;
-					dst.first = iterator(node, this->_sentinel);
-					dst.second = true;
-					return (dst);
-				}
-				else
-				{
-					if (this->_c(value.first, this->_root->data.first) && this->_root->data.first != value.first)
-						return (insertNode(this->_root->child[LEFT], node, this->_root, 1));
-					else if (this->_c(this->_root->data.first, value.first) && this->_root->data.first != value.first)
-						return (insertNode(this->_root->child[RIGHT], node, this->_root, 1));
-					else
-					{
-						dst.first = find(node->data.first);
-						delete node;
-						dst.second = false;
-						return (dst);
-					}
-				}
+				ft::pair<pointer, bool>	ret = this->insertUnique(value);
+
+				return (ft::make_pair(iterator(ret.first), ret.second));
 			};
 
-			/* Inserisce un range di nodi */
+			/* Inserisce un range di nodi. Su una mappa vuota un range ordinato (come la copia di un'altra mappa)
+			   viene costruito in tempo lineare, vedi RBTree::insertRange. */
 			template< class InputIt >
 			void insert( InputIt first, InputIt last )
 			{
-				while (first != last)
-					this->insert(*first++);
+				this->insertRange(first, last);
 			};
 
+			/* Se la chiave va subito prima (o subito dopo) di 'position' il nodo viene agganciato lì senza
+			   scendere dalla radice: inserire chiavi crescenti con end() come suggerimento costa O(1) ammortizzato. */
 			iterator insert (iterator position, const value_type& val)
 			{
-				ft::pair<iterator, bool> dst;
-
-				(void)position;
-				dst = this->insert(val);
-				return (dst.first);
-			};
-
-			/*	Funzione helper ricorsiva che serve ad inserire il nodo controllando le dipendenze con il parent
-				che viene modificato finchè non arriva a nullo o a sentinel, andando poi ad inserire il nodo effettivamente.
-				Se la Key passata è già presente nella mappa, la funzione elimina il nodo e torna false nel booleano */
-			ft::pair<iterator, bool>	insertNode(pointer &start, pointer &node, pointer& parent, int flag)
-			{
-				ft::pair<iterator, bool>	dst;
-
-				if (!start || start == this->_sentinel)
-				{
-					node->parent = parent;
-					if (this->_c(node->data.first, parent->data.first))
-						parent->child[LEFT] = node;
-					else
-						parent->child[RIGHT] = node;
-					start = node;
-					if (flag)
-						this->_size++;
-					this->balanceInsert(start);
-					dst.first = iterator(node, this->_sentinel);
-					dst.second = true;
-					return (dst);
-				}
-				if (this->_c(node->data.first, start->data.first))
-					return (insertNode(start->child[LEFT], node, start, flag));
-				else if (this->_c(start->data.first, node->data.first))
-					return (insertNode(start->child[RIGHT], node, start, flag));
-				dst.first = find(node->data.first);
-				delete node;
-				dst.second = false;
-				return (dst);
+				return (iterator(this->insertHint(position.node, val)));
 			};
 
+			/* Il nodo viene staccato dall'albero e ribilanciato senza spostare gli altri nodi (vedi RBTree::unlink). */
 			void	erase(iterator pos)
 			{
-				this->erase_deep(*pos);
+				this->eraseNode(pos.node);
 			}
 
 			void	erase(iterator first, iterator last)
 			{
 				while (first != last)
-					this->erase_deep(*first++);
+					this->eraseNode((first++).node);
 			}
 
 			size_type	erase(const key_type& key)
 			{
-				ft::pair<key_type, mapped_type>	tmp(key, mapped_type());
+				pointer	node = this->findNode(key);
 
-				if (erase_deep(tmp) != iterator(NULL, this->_sentinel))
-					return (1);
-				return (0);
+				if (node == this->_sentinel)
+					return (0);
+				this->eraseNode(node);
+				return (1);
 			}
 
-			/* Questa funzione rimuove un elemento dalla mappa utilizzando una ricerca in profondità.
-			   In generale, la funzione cerca l'elemento con la chiave specificata e poi decide come rimuoverlo
-			   in base alla sua posizione all'interno dell'albero rosso-nero.
-			   Se l'elemento da rimuovere è un nodo foglia, il nodo viene semplicemente rimosso dall'albero e
-			   viene ripristinata la proprietà di bilanciamento dell'albero rosso-nero.
-			   Se l'elemento da rimuovere ha un solo figlio, il figlio prende il posto del nodo e la proprietà di bilanciamento dell'albero viene ripristinata.
-			   Se l'elemento da rimuovere ha due figli, viene selezionato il successore o il predecessore del nodo, che diventa il nuovo nodo da rimuovere.
-			   Il successore/predecessore viene quindi rimosso come sopra, e il nodo originale viene sostituito dal successore/predecessore.
-			   In tutti i casi, il nodo viene deallocato e la dimensione della mappa viene ridotta.
-			   La funzione restituisce un iteratore al successore dell'elemento rimosso. */
-			iterator erase_deep(ft::pair<const Key, T> const & val)
-			{
-				// La funzione cerca il nodo dell'albero che corrisponde alla chiave specificata e lo memorizza nella variabile "node".
-				pointer		node = this->find(val.first).node;
-				pointer		temp;
-				pointer		successor;
-				iterator 	ret;
-
-				/* Viene controllato se il nodo esiste nell'albero e non è il nodo sentinella dell'albero,
-				   altrimenti viene restituita un'istanza dell'iteratore con valore nullo e puntatore al nodo sentinella. */
-				if (node && node != this->_sentinel)
-					ret = this->find(this->getSuccessor(node)->data.first);
-				else
-					return (iterator(NULL, this->_sentinel));
-
-				/* Se il nodo non ha figli o ha entrambi i figli come nodi sentinella,
-				   viene eseguita la cancellazione del nodo. Viene controllato se il nodo cancellato è nero e se non è la radice dell'albero.
-				   In questo caso, viene richiamata la funzione "balanceDelete" per bilanciare l'albero.
-				   Successivamente, viene eseguita la disconnessione del nodo dall'albero tramite la funzione "unlink"
-				   se il padre del nodo è diverso dal nodo sentinella. Altrimenti, viene impostata la radice dell'albero come il nodo sentinella. */
-				if ((!node->child[LEFT] && !node->child[RIGHT]) || (node->child[LEFT] == this->_sentinel && node->child[RIGHT] == this->_sentinel))
-				{
-					temp = node->parent;
-					if (node->color == BLACK && node != this->_root)
-						this->balanceDelete(node);
-					if (temp != this->_sentinel)
-						this->unlink(temp, node);
-					else
-					{
-						this->_root = this->_sentinel;
-						this->_sentinel->parent = this->_root;
-					}
-				}
-				/* Se il nodo ha un solo figlio, viene eseguita la cancellazione del nodo.
-				   Viene controllato se il nodo cancellato è nero e se non è la radice dell'albero.
-				   In questo caso, viene richiamata la funzione "balanceDelete" per bilanciare l'albero.
-				   Il figlio del nodo viene collegato al padre del nodo cancellato tramite la funzione "link" se il nodo cancellato non è la radice dell'albero.
-				   Altrimenti, viene impostata la radice dell'albero come il figlio del nodo cancellato. */
-				else if (this->oneChild(node) != this->_sentinel)
-				{
-					if (node->color == BLACK && node != this->_root)
-					{
-						if (this->oneChild(node)->color != RED)
-							this->balanceDelete(node);
-						else
-							this->oneChild(node)->color = BLACK;
-					}
-					this->oneChild(node)->parent = node->parent;
-					if (node != this->_root)
-						this->link(node->parent, node, this->oneChild(node));
-					else
-					{
-						this->_root = this->oneChild(node);
-						this->_sentinel->parent = this->_root;
-					}
-				}
-				/* Se il nodo ha entrambi i figli, viene eseguita la cancellazione del nodo.
-				   Viene selezionato il successore del nodo cancellato.
-				   Se il successore ha un figlio destro diverso dal nodo sentinella,
-				   viene impostato a questo il padre del successore tramite la funzione "unlink".
-				   Successivamente, il successore viene collegato al padre del nodo cancellato tramite la funzione "link".
-				   Infine, i figli del nodo cancellato vengono collegati al successore.
-				   Se il nodo cancellato è la radice dell'albero,
-				   viene eseguita una procedura speciale per collegare correttamente il figlio del nodo cancellato con il nuovo nodo radice.*/
-				else
-				{
-					if (this->_c(node->data.first, this->_root->data.first))
-						successor = this->getSuccessor(node);
-					else
-						successor = this->getPredecessor(node);
-					this->balanceDelete(successor);
-					if (successor->child[RIGHT] != this->_sentinel)
-					{
-						successor->child[RIGHT] = this->_sentinel;
-					}
-					if (node != this->_root)
-					{
-						this->unlink(successor->parent, successor);
-						this->link(node->parent, node, successor);
-						if (node->child[LEFT] != this->_sentinel)
-						{
-							node->child[LEFT]->parent = successor;
-							successor->child[LEFT] = node->child[LEFT];
-						}
-						if (node->child[RIGHT] != this->_sentinel)
-						{
-							if (successor->child[RIGHT] != this->_sentinel)
-								this->link(successor->parent, successor, successor->child[RIGHT]);
-							node->child[RIGHT]->parent = successor;
-							successor->child[RIGHT] = node->child[RIGHT];
-						}
-					}
-					else
-					{
-						pointer toHandle = NULL;
-						pointer	toHandle2 = NULL;
-						this->_root = successor;
-						this->_sentinel->parent = successor;
-						if (this->_root->parent->child[LEFT] == this->_root)
-							this->_root->parent->child[LEFT] = this->_sentinel;
-						else
-							this->_root->parent->child[RIGHT] = this->_sentinel;
-						this->_root->parent = this->_sentinel;
-						if (node->child[RIGHT] == successor)
-						{
-							if (node->child[RIGHT] != this->_sentinel)
-								toHandle = node->child[RIGHT];
-							this->_root->child[LEFT] = node->child[LEFT];
-							node->child[LEFT]->parent = this->_root;
-							this->_root->color = BLACK;
-						}
-						else
-						{
-							if (node->child[LEFT] != this->_sentinel)
-								toHandle2 = node->child[LEFT];
-							this->_root->child[RIGHT] = node->child[RIGHT];
-							node->child[RIGHT]->parent = this->_root;
-							this->_root->color = BLACK;
-						}
-						if (toHandle)
-							insertNode(this->_root, toHandle, this->_root, 0);
-						if (toHandle2)
-							insertNode(this->_root, toHandle2, this->_root, 0);
-					}
-				}
-				this->_alloc.deallocate(node, 1); //Viene deallocato il nodo cancellato e decrementato il valore della variabile _size che tiene traccia della grandezza dell'albero.
-				node = NULL;
-				this->_size--;
-				return (ret); // Viene restituito l'iteratore che punta al successore del nodo cancellato.
-			};
+			/* Stacca l'elemento dal container e lo restituisce dentro una node handle, senza copiarlo:
+			   il valore viene spostato nella handle e lo slot del nodo torna al pool (vedi node_handle_base). */
+			node_type	extract(iterator pos)
+			{
+				node_type	handle;
 
-			void clear()
+				this->extractInto(pos.node, handle);
+				return (handle);
+			}
+
+			/* Handle vuota se la chiave manca. */
+			node_type	extract(const key_type& key)
 			{
-				while(this->_size)
-					this->erase(this->min());
-			};
+				node_type	handle;
+				pointer		node = this->findNode(key);
+
+				if (node != this->_sentinel)
+					this->extractInto(node, handle);
+				return (handle);
+			}
+
+			/* Reinserisce il valore di una handle (anche estratta da un altro container dello stesso tipo)
+			   spostandolo in un nodo del pool. Come insert(value): iteratore all'elemento inserito o a quello
+			   con la stessa chiave, e true se il valore è stato inserito; se la chiave c'era già la handle
+			   tiene il suo valore. Con una handle vuota restituisce end() e false. */
+			ft::pair<iterator, bool>	insert(node_type & handle)
+			{
+				ft::pair<pointer, bool>	ret = this->insertHandle(handle);
+
+				return (ft::make_pair(iterator(ret.first), ret.second));
+			}
+
+#if __cplusplus >= 201103L
+			ft::pair<iterator, bool>	insert(node_type && handle)
+			{
+				return (insert(handle));
+			}
+#endif
+
+			/* Usa 'pos' come suggerimento, vedi RBTree::insertHint. */
+			iterator	insert(iterator pos, node_type & handle)
+			{
+				return (iterator(this->insertHandle(handle, pos.node).first));
+			}
+
+			/* Operazioni in blocco, O(m log(n/m + 1)) con m la dimensione del più piccolo dei due container
+			   (vedi RBTree::mergeFrom). merge() sposta i nodi di 'source' con chiavi che qui mancano senza
+			   copiarli né riallocarli; quelli con chiavi già presenti restano in 'source'. */
+			void	merge(map & source)
+			{
+				this->mergeFrom(source);
+			}
+
+			/* Sposta in 'right' (svuotato prima) gli elementi con chiave non minore di 'key'. */
+			void	split(const key_type& key, map & right)
+			{
+				this->splitAt(key, right);
+			}
+
+			/* Accoda gli elementi di 'right', che devono avere chiavi tutte maggiori: O(log n).
+			   Se le chiavi si sovrappongono diventa una merge(). */
+			void	join(map & right)
+			{
+				this->joinWith(right);
+			}
+
+			/* Unione, intersezione e differenza con 'other', che non viene modificato; a parità di chiave
+			   resta l'elemento di questo container. */
+			void	unite(map const & other)
+			{
+				this->uniteWith(other);
+			}
+
+			void	intersect(map const & other)
+			{
+				this->intersectWith(other);
+			}
+
+			void	subtract(map const & other)
+			{
+				this->subtractWith(other);
+			}
 
 			class value_compare : public std::binary_function<value_type, value_type,bool>
 			{
@@ -385,99 +250,162 @@ namespace ft
 				return (value_compare(this->key_comp()));
 			};
 
+			/* Ricerca iterativa sulla sola chiave, senza costruire un value_type temporaneo (vedi RBTree::findNode). */
 			iterator find(const Key& key)
 			{
-				pointer							node = this->_root;
-				ft::pair<key_type, mapped_type>	ret(key, mapped_type());
-
-				if (!node || node == this->_sentinel)
-					return (iterator(this->_sentinel, this->_sentinel));
-
-				return (findPointer(node, ret));
+				return (iterator(this->findNode(key)));
 			};
 
 			const_iterator find(const Key& key) const
 			{
-				pointer							node = this->_root;
-				ft::pair<key_type, mapped_type>	ret(key, mapped_type());
-
-				if (!node || node == this->_sentinel)
-					return (iterator(this->_sentinel, this->_sentinel));
-
-				return (findPointer(node, ret));
-			};
-
-			iterator	findPointer(pointer& start, ft::pair<const Key, T> const & val) const
-			{
-				if (!start || start->color == SENTINEL)		// valore inesistente
-					return (iterator(this->_sentinel, this->_sentinel));
-
-				if (start->data.first == val.first)			// valore uguale
-					return (iterator(start, this->_sentinel));
-				if (this->_c(val.first, start->data.first))
-					return (findPointer(start->child[LEFT], val));
-				if (this->_c(start->data.first, val.first))	// valore maggiore
-					return (findPointer(start->child[RIGHT], val));
-				else
-					return (iterator(start, this->_sentinel));
+				return (const_iterator(this->findNode(key)));
 			};
 
 			/* controlla l'esistenza della key all'interno della map. */
 			size_type count (const Key& key) const
 			{
-				if (find(key).node == this->_sentinel)
+				if (this->findNode(key) == this->_sentinel)
 					return (0);
 				return (1);
 			};
 
-			/* ritorna il primo elemento maggiore (basandosi sugli iteratori) della map. */
+			/* ritorna il primo elemento con key non minore di quella data, scendendo dalla root (O(log n)). */
 			iterator lower_bound (const Key& key)
 			{
-				iterator	tmp = this->begin();
-
-				while (tmp != this->end() && this->_c(tmp.node->data.first, key))
-					tmp++;
-				return (tmp);
+				return (iterator(this->lowerBound(key)));
 			};
 
 			const_iterator lower_bound (const Key& k) const
 			{
-				const_iterator	tmp = this->begin();
-
-				while (tmp != this->end() && this->_c(tmp.node->data.first, k))
-					tmp++;
-				return (tmp);
+				return (const_iterator(this->lowerBound(k)));
 			};
 
 			/* restituisce un iteratore all'elemento con la key strettamente maggiore della key data. */
 			iterator upper_bound (const Key& k)
 			{
-				iterator	tmp = this->begin();
-
-				while (tmp != this->end() && !this->_c(k, tmp.node->data.first))
-					tmp++;
-				return (tmp);
+				return (iterator(this->upperBound(k)));
 			};
 
 			const_iterator upper_bound (const Key& k) const
 			{
-				const_iterator	tmp = this->begin();
-
-				while (tmp != this->end() && !this->_c(k, tmp.node->data.first))
-					tmp++;
-				return (tmp);
+				return (const_iterator(this->upperBound(k)));
 			};
 
 			/*	ritorna un pair con il primo elemento avente la key data e il primo elemento maggiore.
-				Se il first e il second sono uguali, allora non esistono elementi con la chiave data. */
+				Se il first e il second sono uguali, allora non esistono elementi con la chiave data.
+				Entrambi i limiti vengono calcolati con una sola discesa dell'albero. */
 			ft::pair<iterator,iterator> equal_range (const Key& key)
 			{
-				return (ft::make_pair(this->lower_bound(key), this->upper_bound(key)));
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
+
+				return (ft::make_pair(iterator(range.first), iterator(range.second)));
 			};
 
 			ft::pair<const_iterator,const_iterator> equal_range (const Key& key) const
 			{
-				return (ft::make_pair(this->lower_bound(key), this->upper_bound(key)));
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
+
+				return (ft::make_pair(const_iterator(range.first), const_iterator(range.second)));
+			};
+
+			/* ritorna l'elemento in posizione k (da 0) nell'ordine delle chiavi, o end() se k >= size().
+				Ogni nodo conosce la dimensione del proprio sottoalbero, quindi basta una discesa (O(log n)). */
+			iterator select (size_type k)
+			{
+				return (iterator(this->selectNode(k)));
+			};
+
+			const_iterator select (size_type k) const
+			{
+				return (const_iterator(this->selectNode(k)));
+			};
+
+			/* ritorna il numero di elementi con key strettamente minore di quella data (O(log n)). */
+			size_type rank (const Key& key) const
+			{
+				return (this->rankOf(key));
+			};
+
+			//------------------------------------------------------//
+
+			/* Ricerca eterogenea: se Compare è trasparente (vedi ft::is_transparent) questi overload accettano
+			   qualunque tipo K che il comparatore sa confrontare con Key e lo passano così com'è alle discese
+			   dell'albero, senza costruire un Key temporaneo. Con un comparatore normale non partecipano alla
+			   risoluzione e l'argomento viene convertito in Key come sempre. */
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type	find(K const & key)
+			{
+				return (iterator(this->findNode(key)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type	find(K const & key) const
+			{
+				return (const_iterator(this->findNode(key)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, size_type>::type	count(K const & key) const
+			{
+				return (this->findNode(key) != this->_sentinel);
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type	lower_bound(K const & key)
+			{
+				return (iterator(this->lowerBound(key)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type	lower_bound(K const & key) const
+			{
+				return (const_iterator(this->lowerBound(key)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type	upper_bound(K const & key)
+			{
+				return (iterator(this->upperBound(key)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type	upper_bound(K const & key) const
+			{
+				return (const_iterator(this->upperBound(key)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, ft::pair<iterator, iterator> >::type	equal_range(K const & key)
+			{
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
+
+				return (ft::make_pair(iterator(range.first), iterator(range.second)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, ft::pair<const_iterator, const_iterator> >::type	equal_range(K const & key) const
+			{
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
+
+				return (ft::make_pair(const_iterator(range.first), const_iterator(range.second)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, size_type>::type	rank(K const & key) const
+			{
+				return (this->rankOf(key));
+			};
+
+			/* Gli iteratori vanno sempre a erase(iterator): iterator è un overload esatto, const_iterator viene escluso. */
+			template <class K>
+			typename ft::enable_if<ft::is_transparent<Compare>::value && !ft::is_same<K, const_iterator>::value, size_type>::type	erase(K const & key)
+			{
+				pointer	node = this->findNode(key);
+
+				if (node == this->_sentinel)
+					return (0);
+				this->eraseNode(node);
+				return (1);
 			};
 	};
 
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ft
+{
+	/* Memoria occupata da un container, in byte, come la restituisce memory_usage():
+	   - payload: gli elementi veri e propri (size() * sizeof(value_type));
+	   - overhead: la struttura attorno agli elementi, cioè l'oggetto container, i campi dei nodi
+	     (puntatori, colore, contatore, padding), il sentinella, gli header dei chunk del pool,
+	     i byte di distanza della tabella hash;
+	   - slack: memoria allocata e non ancora usata (capacità del vector, slot liberi del pool o della tabella).
+	   Il totale è quanto il container occupa, oggetto compreso; non è contata la contabilità interna
+	   di malloc, che dipende dall'allocatore. memory_usage() è solo un calcolo sui campi del container
+	   e non ha costi se non viene chiamata, quindi resta disponibile anche senza FT_INSTRUMENT. */
+	struct memory_footprint
+	{
+		std::size_t	payload;
+		std::size_t	overhead;
+		std::size_t	slack;
+
+		memory_footprint() : payload(0), overhead(0), slack(0) {};
+		memory_footprint(std::size_t p, std::size_t o, std::size_t s) : payload(p), overhead(o), slack(s) {};
+
+		std::size_t	total() const { return (payload + overhead + slack); };
+	};
+
+#ifdef FT_INSTRUMENT
+	/* Sink per le statistiche di allocazione, collegato a una singola istanza con set_alloc_stats().
+	   Conta le chiamate all'allocatore e i byte richiesti e restituiti; per raccogliere altro
+	   (istogrammi, log, più container sullo stesso contatore) basta derivare e ridefinire on_allocate
+	   e on_deallocate. Vengono registrate solo le chiamate avvenute mentre il sink è collegato. */
+	class alloc_stats
+	{
+		public:
+			std::size_t	allocations;
+			std::size_t	deallocations;
+			std::size_t	bytes_allocated;
+			std::size_t	bytes_deallocated;
+			std::size_t	peak_bytes;			// massimo di bytes_in_use() da quando il sink è collegato
+
+			alloc_stats() { reset(); };
+			virtual ~alloc_stats() {};
+
+			virtual void	on_allocate(std::size_t bytes)
+			{
+				allocations++;
+				bytes_allocated += bytes;
+				if (bytes_in_use() > peak_bytes)
+					peak_bytes = bytes_in_use();
+			};
+
+			virtual void	on_deallocate(std::size_t bytes)
+			{
+				deallocations++;
+				bytes_deallocated += bytes;
+			};
+
+			/* Ha senso se il sink è stato collegato a container vuoto: altrimenti le restituzioni di memoria
+			   allocata prima possono superare le allocazioni registrate, e il risultato è 0. */
+			std::size_t	bytes_in_use() const
+			{
+				return (bytes_allocated > bytes_deallocated ? bytes_allocated - bytes_deallocated : 0);
+			};
+
+			void	reset()
+			{
+				allocations = 0;
+				deallocations = 0;
+				bytes_allocated = 0;
+				bytes_deallocated = 0;
+				peak_bytes = 0;
+			};
+	};
+
+	/* Base dei container che allocano: tiene il puntatore al sink dell'istanza.
+	   Il sink appartiene all'istanza, non alla memoria: una copia nasce senza sink, l'assegnazione
+	   e swap() lasciano a ciascun container il proprio. */
+	class alloc_stats_hook
+	{
+		public:
+			alloc_stats_hook() : _stats(NULL) {};
+			alloc_stats_hook(alloc_stats_hook const &) : _stats(NULL) {};
+			alloc_stats_hook&	operator=(alloc_stats_hook const &) { return (*this); };
+
+			void			set_alloc_stats(alloc_stats* stats)	{ _stats = stats; };
+			alloc_stats*	get_alloc_stats() const				{ return (_stats); };
+
+		protected:
+			void	recordAllocate(std::size_t bytes) const
+			{
+				if (_stats)
+					_stats->on_allocate(bytes);
+			};
+
+			void	recordDeallocate(std::size_t bytes) const
+			{
+				if (_stats)
+					_stats->on_deallocate(bytes);
+			};
+
+			/* Per i container temporanei che un'operazione costruisce e poi scambia con *this. */
+			void	shareStats(alloc_stats_hook const & owner)	{ _stats = owner._stats; };
+
+		private:
+			alloc_stats*	_stats;
+	};
+#else
+	/* Senza FT_INSTRUMENT la base è vuota (non occupa spazio) e le registrazioni spariscono. */
+	class alloc_stats_hook
+	{
+		protected:
+			void	recordAllocate(std::size_t) const {};
+			void	recordDeallocate(std::size_t) const {};
+			void	shareStats(alloc_stats_hook const &) {};
+	};
+#endif
+}
@@ -0,0 +1,376 @@
+#pragma once
+
+#include <algorithm>
+#include "utility.hpp"
+#include "rb_tree.hpp"
+#include "iterator.hpp"
+
+namespace ft
+{
+	/* Come ft::map, ma con chiavi ripetute: stesso RBTree con Unique = false (vedi RBTree::insertEqual).
+	   Un nuovo elemento va sempre dopo quelli con la stessa chiave, quindi gli equivalenti restano
+	   nell'ordine di inserimento. Gli elementi di una chiave sono contigui nell'albero: equal_range
+	   li delimita con una sola discesa e count() è la differenza dei rank dei due estremi, O(log n)
+	   qualunque sia il numero di ripetizioni. */
+	template <class Key, class T, class Compare = std::less<Key>, class Allocator = std::allocator<ft::pair<const Key, T> > >
+	class multimap : public RBTree<ft::pair<const Key, T>, Node<ft::pair<const Key, T> >,  RBIterator<ft::pair<const Key, T>, Compare, Node<ft::pair<const Key, T> > >, RBIteratorConst<ft::pair<const Key, T>, Compare, Node<ft::pair<const Key, T> > >, select_first<ft::pair<const Key, T> >, Compare, Allocator, false>
+	{
+		public:
+
+			typedef Key																	key_type;
+			typedef	T																	mapped_type;
+			typedef ft::pair<const Key, T>												value_type;
+			typedef typename Allocator::template rebind<Node<value_type> >::other		allocator_type;
+			typedef typename allocator_type::reference									reference;
+			typedef typename allocator_type::const_reference							const_reference;
+			typedef typename allocator_type::pointer									pointer;
+			typedef typename allocator_type::const_pointer								const_pointer;
+			typedef typename allocator_type::size_type									size_type;
+			typedef RBIterator<value_type, Compare, Node<value_type> >					iterator;
+			typedef RBIteratorConst<value_type, Compare, Node<value_type> >				const_iterator;
+			typedef Compare																key_compare;
+			typedef RBTree<value_type, Node<value_type>, iterator, const_iterator, select_first<value_type>, Compare, Allocator, false>	tree_type;
+			typedef map_node_handle<Key, T>												node_type;
+
+
+			// * COSTRUTTORI * //
+
+			multimap() {};
+
+			// Default Constructor (empty)
+			explicit multimap(const Compare& comp, const Allocator& alloc = Allocator())
+			{
+				(void)comp;
+				(void)alloc;
+			};
+
+			// Range Constructor (da 'first' a 'last')
+			template <class InputIt>
+			multimap(InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator())
+			{
+				(void)comp;
+				(void)alloc;
+				this->insert(first, last);
+			};
+
+			// Copy Constructor: copia strutturale dell'albero, vedi RBTree::cloneFrom
+			multimap (const multimap& other) : tree_type(other) {};
+
+			// Copy Assign Operator
+			multimap& operator=( multimap const & other )
+			{
+				tree_type::operator=(other);
+				return (*this);
+			};
+
+			// Destructor
+			~multimap()
+			{
+				this->clear();
+			};
+
+
+			// * MEMBER FUNCTION *//
+
+
+			/* L'inserimento riesce sempre: una discesa fino alla foglia dopo l'ultimo elemento con la stessa
+			   chiave (vedi RBTree::insertEqual). */
+			iterator insert( value_type const &value )
+			{
+				return (iterator(this->insertEqual(value)));
+			};
+
+			/* Su una multimap vuota un range ordinato viene costruito in tempo lineare, vedi RBTree::insertRange. */
+			template< class InputIt >
+			void insert( InputIt first, InputIt last )
+			{
+				this->insertRange(first, last);
+			};
+
+			/* Il valore va il più vicino possibile a 'position', vedi RBTree::insertEqualHint: con end() come
+			   suggerimento le chiavi crescenti (o uguali all'ultima) vengono accodate in O(1) ammortizzato. */
+			iterator insert (iterator position, const value_type& val)
+			{
+				return (iterator(this->insertEqualHint(position.node, val)));
+			};
+
+			void	erase(iterator pos)
+			{
+				this->eraseNode(pos.node);
+			}
+
+			void	erase(iterator first, iterator last)
+			{
+				while (first != last)
+					this->eraseNode((first++).node);
+			}
+
+			/* Rimuove tutti gli elementi con la chiave data: O(log n + k) per k elementi. */
+			size_type	erase(const key_type& key)
+			{
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
+				size_type					ret = this->countEqual(key);
+
+				erase(iterator(range.first), iterator(range.second));
+				return (ret);
+			}
+
+			/* Stacca l'elemento dal container e lo restituisce dentro una node handle, senza copiarlo
+			   (vedi node_handle_base). */
+			node_type	extract(iterator pos)
+			{
+				node_type	handle;
+
+				this->extractInto(pos.node, handle);
+				return (handle);
+			}
+
+			/* Estrae il primo elemento con la chiave data; handle vuota se la chiave manca. */
+			node_type	extract(const key_type& key)
+			{
+				node_type	handle;
+				iterator	it = find(key);
+
+				if (it.node != this->_sentinel)
+					this->extractInto(it.node, handle);
+				return (handle);
+			}
+
+			/* Reinserisce il valore di una handle spostandolo in un nodo del pool, dopo gli elementi con la
+			   stessa chiave. Con una handle vuota restituisce end(). */
+			iterator	insert(node_type & handle)
+			{
+				return (iterator(this->insertHandle(handle).first));
+			}
+
+#if __cplusplus >= 201103L
+			iterator	insert(node_type && handle)
+			{
+				return (insert(handle));
+			}
+#endif
+
+			/* Usa 'pos' come suggerimento, vedi RBTree::insertEqualHint. */
+			iterator	insert(iterator pos, node_type & handle)
+			{
+				return (iterator(this->insertHandle(handle, pos.node).first));
+			}
+
+			/* Sposta tutti gli elementi di 'source' in questo container, uno alla volta e senza copiarli
+			   (extract e insert di una node handle): O(m log n). Le operazioni in blocco di ft::map
+			   presuppongono chiavi univoche e qui non sono disponibili. */
+			void	merge(multimap & source)
+			{
+				if (&source == this)
+					return ;
+				while (!source.empty())
+				{
+					node_type	handle = source.extract(source.begin());
+
+					insert(handle);
+				}
+			}
+
+			class value_compare : public std::binary_function<value_type, value_type,bool>
+			{
+				friend class multimap<Key, T, Compare, Allocator>;
+
+				private:
+					Compare comp;
+					value_compare (Compare c) : comp(c) {}
+				public:
+					bool operator() (const value_type& x, const value_type& y) const
+					{
+						return comp(x.first, y.first);
+					}
+			};
+
+			value_compare value_comp() const
+			{
+				return (value_compare(this->key_comp()));
+			};
+
+			/* Primo elemento con la chiave data: il lower bound, se la sua chiave è quella cercata. */
+			iterator find(const Key& key)
+			{
+				return (iterator(findFirst(key)));
+			};
+
+			const_iterator find(const Key& key) const
+			{
+				return (const_iterator(findFirst(key)));
+			};
+
+			/* Differenza dei rank dei due estremi di equal_range, vedi RBTree::countEqual: O(log n). */
+			size_type count (const Key& key) const
+			{
+				return (this->countEqual(key));
+			};
+
+			iterator lower_bound (const Key& key)
+			{
+				return (iterator(this->lowerBound(key)));
+			};
+
+			const_iterator lower_bound (const Key& k) const
+			{
+				return (const_iterator(this->lowerBound(k)));
+			};
+
+			iterator upper_bound (const Key& k)
+			{
+				return (iterator(this->upperBound(k)));
+			};
+
+			const_iterator upper_bound (const Key& k) const
+			{
+				return (const_iterator(this->upperBound(k)));
+			};
+
+			/* Una sola discesa, vedi RBTree::equalRange: scorrere il range costa poi O(k). */
+			ft::pair<iterator,iterator> equal_range (const Key& key)
+			{
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
+
+				return (ft::make_pair(iterator(range.first), iterator(range.second)));
+			};
+
+			ft::pair<const_iterator,const_iterator> equal_range (const Key& key) const
+			{
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
+
+				return (ft::make_pair(const_iterator(range.first), const_iterator(range.second)));
+			};
+
+			/* Statistiche d'ordine in O(log n), come ft::map::select/rank. */
+			iterator select (size_type k)
+			{
+				return (iterator(this->selectNode(k)));
+			};
+
+			const_iterator select (size_type k) const
+			{
+				return (const_iterator(this->selectNode(k)));
+			};
+
+			size_type rank (const Key& key) const
+			{
+				return (this->rankOf(key));
+			};
+
+			//------------------------------------------------------//
+
+			/* Ricerca eterogenea con un Compare trasparente, come in ft::map. */
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type	find(K const & key)
+			{
+				return (iterator(findFirst(key)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type	find(K const & key) const
+			{
+				return (const_iterator(findFirst(key)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, size_type>::type	count(K const & key) const
+			{
+				return (this->countEqual(key));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type	lower_bound(K const & key)
+			{
+				return (iterator(this->lowerBound(key)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type	lower_bound(K const & key) const
+			{
+				return (const_iterator(this->lowerBound(key)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type	upper_bound(K const & key)
+			{
+				return (iterator(this->upperBound(key)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type	upper_bound(K const & key) const
+			{
+				return (const_iterator(this->upperBound(key)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, ft::pair<iterator, iterator> >::type	equal_range(K const & key)
+			{
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
+
+				return (ft::make_pair(iterator(range.first), iterator(range.second)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, ft::pair<const_iterator, const_iterator> >::type	equal_range(K const & key) const
+			{
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
+
+				return (ft::make_pair(const_iterator(range.first), const_iterator(range.second)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, size_type>::type	rank(K const & key) const
+			{
+				return (this->rankOf(key));
+			};
+
+		private:
+			template <class K>
+			pointer	findFirst(K const & key) const
+			{
+				pointer	node = this->lowerBound(key);
+
+				if (node != this->_sentinel && this->_c(key, node->data.first))
+					return (this->_sentinel);
+				return (node);
+			}
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator==( const ft::multimap<Key, T, Compare, Alloc>& lhs, const ft::multimap<Key, T, Compare, Alloc>& rhs )
+	{
+		return ((lhs.size() == rhs.size()) && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator!=( const ft::multimap<Key, T, Compare, Alloc>& lhs, const ft::multimap<Key, T, Compare, Alloc>& rhs )
+	{
+		return (!(lhs == rhs));
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<( const ft::multimap<Key, T, Compare, Alloc>& lhs, const ft::multimap<Key, T, Compare, Alloc>& rhs )
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<=( const ft::multimap<Key, T, Compare, Alloc>& lhs, const ft::multimap<Key, T, Compare, Alloc>& rhs )
+	{
+		return (!(lhs > rhs));
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>( const ft::multimap<Key, T, Compare, Alloc>& lhs, const ft::multimap<Key, T, Compare, Alloc>& rhs )
+	{
+		return (!(lhs == rhs || lhs < rhs));
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>=( const ft::multimap<Key, T, Compare, Alloc>& lhs, const ft::multimap<Key, T, Compare, Alloc>& rhs )
+	{
+		return (!(lhs < rhs));
+	};
+
+}
@@ -0,0 +1,370 @@
+#pragma once
+
+#include <functional>
+#include "utility.hpp"
+#include "iterator.hpp"
+#include "rb_tree.hpp"
+
+namespace ft
+{
+	/* Come ft::set, ma con chiavi ripetute (vedi ft::multimap): gli elementi equivalenti restano
+	   nell'ordine di inserimento, equal_range costa una discesa e count() O(log n). */
+	template <class Key, class Compare = std::less<Key>, class Alloc = std::allocator<Key> >
+	class multiset : public RBTree<Key, Node<Key>, RBIteratorConst<Key, Compare, Node<Key> >, RBIteratorConst<const Key, Compare, Node<Key> >, identity<Key>, Compare, Alloc, false>
+	{
+		public:
+			typedef Key														key_type;
+			typedef Key														value_type;
+			typedef Compare													key_compare;
+			typedef typename Alloc::template rebind<Node<Key> >::other		allocator_type;
+			typedef typename allocator_type::reference						reference;
+			typedef typename allocator_type::const_reference				const_reference;
+			typedef typename allocator_type::pointer						pointer;
+			typedef typename allocator_type::const_pointer					const_pointer;
+			typedef typename allocator_type::size_type						size_type;
+			typedef RBIteratorConst<Key, Compare, Node<Key> >				iterator;
+			typedef RBIteratorConst<const Key, Compare, Node<Key> >			const_iterator;
+			typedef RBTree<Key, Node<Key>, iterator, const_iterator, identity<Key>, Compare, Alloc, false>	tree_type;
+			typedef set_node_handle<Key>									node_type;
+
+			// * COSTRUTTORI * //
+
+			// Default Constructor
+			explicit multiset(const Compare& comp = Compare(), const Alloc& alloc = Alloc())
+			{
+				this->_key_compare = comp;
+				this->_key_type = key_type();
+				this->_value_type = value_type();
+				(void)alloc;
+			};
+
+			// Range Constructor: [first, last)
+			template <class InputIt>
+			multiset(InputIt first, InputIt last, const Compare& comp = Compare(), const Alloc& alloc = Alloc())
+			{
+				this->_key_compare = comp;
+				this->_key_type = key_type();
+				this->_value_type = value_type();
+				this->insert(first, last);
+				(void)alloc;
+			};
+
+			// Copy Constructor: copia strutturale dell'albero, vedi RBTree::cloneFrom
+			multiset(const multiset& other) : tree_type(other) {};
+
+			// Copy Assign Operator
+			multiset&	operator=(const multiset& rhs)
+			{
+				tree_type::operator=(rhs);
+				return (*this);
+			};
+
+			// Destructor
+			~multiset()
+			{
+				this->clear();
+			};
+
+			// * MEMBER FUNCTION *//
+
+			/* L'inserimento riesce sempre, dopo gli elementi equivalenti (vedi RBTree::insertEqual). */
+			iterator	insert(Key const &value)
+			{
+				return (iterator(this->insertEqual(value)));
+			};
+
+			/* Su un multiset vuoto un range ordinato viene costruito in tempo lineare, vedi RBTree::insertRange. */
+			template <class InputIt>
+			void	insert(InputIt first, InputIt last)
+			{
+				this->insertRange(first, last);
+			};
+
+			/* Usa 'pos' come suggerimento, vedi RBTree::insertEqualHint */
+			iterator	insert(iterator pos, const Key & val)
+			{
+				return (iterator(this->insertEqualHint(pos.node, val)));
+			};
+
+			//------------------------------------------------------//
+
+			/* Restituisce l'iteratore all'elemento successivo, che resta valido dopo la rimozione. */
+			iterator	erase(iterator pos)
+			{
+				iterator	ret = this->getSuccessor(pos.node);
+
+				this->eraseNode(pos.node);
+				return (ret);
+			}
+
+			iterator	erase(iterator first, iterator last)
+			{
+				while (first != last)
+					this->eraseNode((first++).node);
+				return (last.node);
+			}
+
+			/* Rimuove tutti gli elementi equivalenti a 'key' e ne restituisce il numero: O(log n + k). */
+			size_type	erase(const Key& key)
+			{
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
+				size_type					ret = this->countEqual(key);
+
+				erase(iterator(range.first), iterator(range.second));
+				return (ret);
+			}
+
+			/* Vedi ft::set::extract e node_handle_base. */
+			node_type	extract(iterator pos)
+			{
+				node_type	handle;
+
+				this->extractInto(pos.node, handle);
+				return (handle);
+			}
+
+			/* Estrae il primo elemento equivalente a 'key'; handle vuota se manca. */
+			node_type	extract(const Key& key)
+			{
+				node_type	handle;
+				pointer		node = findFirst(key);
+
+				if (node != this->_sentinel)
+					this->extractInto(node, handle);
+				return (handle);
+			}
+
+			/* Reinserisce il valore di una handle dopo gli elementi equivalenti; con una handle vuota
+			   restituisce end(). */
+			iterator	insert(node_type & handle)
+			{
+				return (iterator(this->insertHandle(handle).first));
+			}
+
+#if __cplusplus >= 201103L
+			iterator	insert(node_type && handle)
+			{
+				return (insert(handle));
+			}
+#endif
+
+			/* Usa 'pos' come suggerimento, vedi RBTree::insertEqualHint. */
+			iterator	insert(iterator pos, node_type & handle)
+			{
+				return (iterator(this->insertHandle(handle, pos.node).first));
+			}
+
+			/* Sposta tutti gli elementi di 'source' uno alla volta, come ft::multimap::merge: O(m log n). */
+			void	merge(multiset & source)
+			{
+				if (&source == this)
+					return ;
+				while (!source.empty())
+				{
+					node_type	handle = source.extract(source.begin());
+
+					insert(handle);
+				}
+			}
+
+			//------------------------------------------------------//
+
+			class value_compare : public std::binary_function<value_type, value_type, bool>
+			{
+				friend class multiset<Key, Compare, Alloc>;
+
+				private:
+					Compare comp;
+					value_compare (Compare c) : comp(c) {}
+				public:
+					bool operator() (const value_type& x, const value_type& y) const
+					{
+						return comp(x, y);
+					}
+			};
+
+			value_compare	value_comp() const
+			{
+				return (value_compare(this->key_comp()));
+			};
+
+			//------------------------------------------------------//
+
+			/* Primo elemento equivalente a 'val', o end(). */
+			iterator	find(Key const & val) const
+			{
+				return (iterator(findFirst(val)));
+			};
+
+			//------------------------------------------------------//
+
+			/* O(log n), vedi RBTree::countEqual. */
+			size_type	count(Key const & key) const
+			{
+				return (this->countEqual(key));
+			};
+
+			//------------------------------------------------------//
+
+			iterator	lower_bound(Key const & key)
+			{
+				return (iterator(this->lowerBound(key)));
+			};
+
+			const_iterator	lower_bound(Key const & key) const
+			{
+				return (const_iterator(this->lowerBound(key)));
+			};
+
+			iterator	upper_bound(Key const & key)
+			{
+				return (iterator(this->upperBound(key)));
+			};
+
+			const_iterator	upper_bound(Key const & key) const
+			{
+				return (const_iterator(this->upperBound(key)));
+			};
+
+			ft::pair<iterator, iterator>	equal_range(const Key& key)
+			{
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
+
+				return (ft::make_pair(iterator(range.first), iterator(range.second)));
+			};
+
+			ft::pair<const_iterator, const_iterator>	equal_range(const Key& key) const
+			{
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
+
+				return (ft::make_pair(const_iterator(range.first), const_iterator(range.second)));
+			};
+
+			//------------------------------------------------------//
+
+			/* Statistiche d'ordine in O(log n), come ft::set::select/rank. */
+			iterator	select(size_type k)
+			{
+				return (iterator(this->selectNode(k)));
+			};
+
+			const_iterator	select(size_type k) const
+			{
+				return (const_iterator(this->selectNode(k)));
+			};
+
+			size_type	rank(Key const & key) const
+			{
+				return (this->rankOf(key));
+			};
+
+			//------------------------------------------------------//
+
+			/* Ricerca eterogenea con un Compare trasparente, come in ft::set. */
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type	find(K const & key) const
+			{
+				return (iterator(findFirst(key)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, size_type>::type	count(K const & key) const
+			{
+				return (this->countEqual(key));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type	lower_bound(K const & key)
+			{
+				return (iterator(this->lowerBound(key)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type	lower_bound(K const & key) const
+			{
+				return (const_iterator(this->lowerBound(key)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type	upper_bound(K const & key)
+			{
+				return (iterator(this->upperBound(key)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type	upper_bound(K const & key) const
+			{
+				return (const_iterator(this->upperBound(key)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, ft::pair<iterator, iterator> >::type	equal_range(K const & key)
+			{
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
+
+				return (ft::make_pair(iterator(range.first), iterator(range.second)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, ft::pair<const_iterator, const_iterator> >::type	equal_range(K const & key) const
+			{
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
+
+				return (ft::make_pair(const_iterator(range.first), const_iterator(range.second)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, size_type>::type	rank(K const & key) const
+			{
+				return (this->rankOf(key));
+			};
+
+		private:
+			template <class K>
+			pointer	findFirst(K const & key) const
+			{
+				pointer	node = this->lowerBound(key);
+
+				if (node != this->_sentinel && this->_c(key, node->data))
+					return (this->_sentinel);
+				return (node);
+			}
+	};
+
+	template <class T, class Compare, class Alloc>
+	bool operator==(multiset<T, Compare, Alloc> const & lhs, multiset<T, Compare, Alloc> const & rhs)
+	{
+		return ((lhs.size() == rhs.size()) && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	};
+
+	template <class T, class Compare, class Alloc>
+	bool operator!=(multiset<T, Compare, Alloc> const & lhs, multiset<T, Compare, Alloc> const & rhs)
+	{
+		return (!(lhs == rhs));
+	};
+
+	template <class T, class Compare, class Alloc>
+	bool operator<(multiset<T, Compare, Alloc> const & lhs, multiset<T, Compare, Alloc> const & rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	};
+
+	template <class T, class Compare, class Alloc>
+	bool operator<=(multiset<T, Compare, Alloc> const & lhs, multiset<T, Compare, Alloc> const & rhs)
+	{
+		return (!(lhs > rhs));
+	};
+
+	template <class T, class Compare, class Alloc>
+	bool operator>(multiset<T, Compare, Alloc> const & lhs, multiset<T, Compare, Alloc> const & rhs)
+	{
+		return (!(lhs == rhs || lhs < rhs));
+	};
+
+	template <class T, class Compare, class Alloc>
+	bool operator>=(multiset<T, Compare, Alloc> const & lhs, multiset<T, Compare, Alloc> const & rhs)
+	{
+		return (!(lhs < rhs));
+	};
+
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+namespace ft
+{
+	/* Colore dei nodi dell'RBTree. Sta in un header a parte perché serve anche agli iteratori
+	   (vedi RBNavigator::isSentinel), che non includono rb_tree.hpp. */
+	enum node_color
+	{
+		RED,
+		BLACK,
+		SENTINEL
+	};
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstddef>
+#include "utility.hpp"
+
+namespace ft
+{
+	/* Node handle di map e set, come la restituisce extract().
+	   I nodi dell'RBTree vivono nei chunk del pool del loro albero, che vengono restituiti all'allocatore
+	   tutti insieme: un nodo non può quindi passare da un albero all'altro né sopravvivere al suo container.
+	   La handle tiene invece il valore, spostato (vedi relocate_value) in un buffer interno; lo slot del nodo
+	   torna subito alla free list del pool di origine, e insert() sposta il valore in uno slot del pool di
+	   destinazione. Nessuno dei due passaggi chiama l'allocatore per il singolo elemento, né copia il
+	   valore se il tipo ha uno spostamento (o è rilocabile).
+	   In C++11 la handle si può solo spostare; in C++98 la copia trasferisce il valore, come std::auto_ptr. */
+	template <class Value>
+	class node_handle_base
+	{
+		public:
+			node_handle_base() : _full(false) {};
+			~node_handle_base() { reset(); };
+
+#if __cplusplus >= 201103L
+			node_handle_base(node_handle_base && other) : _full(false) { take(other); };
+
+			node_handle_base&	operator=(node_handle_base && other)
+			{
+				if (this != &other)
+				{
+					reset();
+					take(other);
+				}
+				return (*this);
+			};
+
+			node_handle_base(node_handle_base const &) = delete;
+			node_handle_base&	operator=(node_handle_base const &) = delete;
+
+			explicit operator bool() const { return (_full); };
+#else
+			node_handle_base(node_handle_base const & other) : _full(false) { take(const_cast<node_handle_base&>(other)); };
+
+			node_handle_base&	operator=(node_handle_base const & other)
+			{
+				if (this != &other)
+				{
+					reset();
+					take(const_cast<node_handle_base&>(other));
+				}
+				return (*this);
+			};
+#endif
+
+			bool	empty() const { return (!_full); };
+
+			void	swap(node_handle_base & other)
+			{
+				node_handle_base	tmp;
+
+				tmp.take(other);
+				other.take(*this);
+				take(tmp);
+			};
+
+		protected:
+			Value*			ptr()		{ return (reinterpret_cast<Value*>(_storage.bytes)); };
+			Value const *	ptr() const	{ return (reinterpret_cast<Value const *>(_storage.bytes)); };
+
+		private:
+			/* Memoria grezza per un valore: gli altri membri servono solo all'allineamento. */
+			union Storage
+			{
+				char		bytes[sizeof(Value)];
+				long double	alignLongDouble;
+				long long	alignLongLong;
+				void*		alignPointer;
+			};
+
+			Storage	_storage;
+			bool	_full;
+
+			template <class, class, class, class, class, class, class, bool>
+			friend class RBTree;
+
+			void	reset()
+			{
+				if (_full)
+				{
+					ptr()->~Value();
+					_full = false;
+				}
+			};
+
+			/* Sposta qui il valore di 'other' (che resta vuota); *this deve essere vuota. */
+			void	take(node_handle_base & other)
+			{
+				if (!other._full)
+					return ;
+				relocate_value(ptr(), *other.ptr());
+				other._full = false;
+				_full = true;
+			};
+	};
+
+	/* node_type di map: la chiave si può modificare prima di reinserire il valore. */
+	template <class Key, class T>
+	class map_node_handle : public node_handle_base<ft::pair<const Key, T> >
+	{
+		public:
+			typedef Key		key_type;
+			typedef T		mapped_type;
+
+			key_type&		key() const		{ return (const_cast<key_type&>(self()->first)); };
+			mapped_type&	mapped() const	{ return (self()->second); };
+
+		private:
+			ft::pair<const Key, T>*	self() const
+			{
+				return (const_cast<map_node_handle*>(this)->ptr());
+			};
+	};
+
+	/* node_type di set. */
+	template <class Value>
+	class set_node_handle : public node_handle_base<Value>
+	{
+		public:
+			typedef Value	value_type;
+
+			value_type&	value() const { return (*const_cast<set_node_handle*>(this)->ptr()); };
+	};
+
+	template <class Value>
+	void	swap(node_handle_base<Value> & lhs, node_handle_base<Value> & rhs)
+	{
+		lhs.swap(rhs);
+	}
+}
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <memory>
+#include "memory_stats.hpp"
+
+namespace ft
+{
+	/* Allocatore a blocchi (slab) per i nodi dell'RBTree.
+	   Invece di chiedere all'allocatore un nodo alla volta, il pool chiede dei chunk contigui
+	   di nodi e li distribuisce uno per uno. I nodi restituiti finiscono in una free list
+	   intrusiva (il puntatore al prossimo nodo libero è scritto dentro il nodo stesso) e vengono
+	   riutilizzati dai successivi inserimenti. I chunk vengono restituiti all'allocatore tutti
+	   insieme con release(), quindi il costo di clear() e del distruttore non dipende dal numero
+	   di nodi ma dal numero di chunk.
+	   'Allocator' è l'allocatore dell'utente già rimappato (rebind) sul tipo del nodo: tutta la
+	   memoria continua a passare da lui, solo a blocchi più grandi.
+	   Il pool non costruisce né distrugge i valori: se ne occupa l'RBTree.
+	   Con FT_INSTRUMENT il sink delle statistiche dell'albero sta qui, dove avvengono le allocazioni. */
+	template <class NodeType, class Allocator>
+	class NodePool : public alloc_stats_hook
+	{
+		public:
+			typedef Allocator						allocator_type;
+			typedef typename Allocator::size_type	size_type;
+
+			static const size_type	FIRST_CHUNK = 16;		// nodi nel primo chunk
+			static const size_type	MAX_CHUNK = 4096;		// limite alla crescita geometrica dei chunk
+
+			explicit NodePool(allocator_type const & alloc = allocator_type()) :
+				_alloc(alloc),
+				_chunks(NULL),
+				_free(NULL),
+				_next(NULL),
+				_last(NULL),
+				_chunkSize(FIRST_CHUNK)
+			{};
+
+			~NodePool() { release(); };
+
+			/* Restituisce memoria non inizializzata per un nodo: prima dalla free list,
+			   poi dal chunk corrente, e solo se entrambi sono esauriti da un nuovo chunk. */
+			NodeType*	allocate()
+			{
+				if (_free)
+				{
+					FreeSlot*	slot = _free;
+
+					_free = slot->next;
+					return (reinterpret_cast<NodeType*>(slot));
+				}
+				if (_next == _last)
+				{
+					grow(_chunkSize);
+					if (_chunkSize < MAX_CHUNK)
+						_chunkSize *= 2;
+				}
+				return (_next++);
+			};
+
+			/* Rimette il nodo (già distrutto) in testa alla free list. */
+			void	deallocate(NodeType* node)
+			{
+				FreeSlot*	slot = reinterpret_cast<FreeSlot*>(node);
+
+				slot->next = _free;
+				_free = slot;
+			};
+
+			/* Garantisce che i prossimi 'n' allocate() vengano serviti dal chunk corrente senza
+			   ulteriori chiamate all'allocatore: utile quando il numero di nodi è noto in anticipo. */
+			void	reserve(size_type n)
+			{
+				if (static_cast<size_type>(_last - _next) >= n)
+					return ;
+				while (_next != _last)
+					deallocate(_next++);
+				grow(n);
+			};
+
+			/* Restituisce tutti i chunk all'allocatore. I nodi ancora in uso diventano invalidi. */
+			void	release()
+			{
+				while (_chunks)
+				{
+					Chunk*	next = _chunks->next;
+
+					this->recordDeallocate(_chunks->slots * sizeof(NodeType));
+					_alloc.deallocate(reinterpret_cast<NodeType*>(_chunks), _chunks->slots);
+					_chunks = next;
+				}
+				_free = NULL;
+				_next = NULL;
+				_last = NULL;
+				_chunkSize = FIRST_CHUNK;
+			};
+
+			void	swap(NodePool & other)
+			{
+				allocator_type	tmpAlloc = _alloc;
+				Chunk*			tmpChunks = _chunks;
+				FreeSlot*		tmpFree = _free;
+				NodeType*		tmpNext = _next;
+				NodeType*		tmpLast = _last;
+				size_type		tmpChunkSize = _chunkSize;
+
+				_alloc = other._alloc;
+				_chunks = other._chunks;
+				_free = other._free;
+				_next = other._next;
+				_last = other._last;
+				_chunkSize = other._chunkSize;
+				other._alloc = tmpAlloc;
+				other._chunks = tmpChunks;
+				other._free = tmpFree;
+				other._next = tmpNext;
+				other._last = tmpLast;
+				other._chunkSize = tmpChunkSize;
+			};
+
+			/* Prende tutti i chunk di 'other', che resta vuoto: i nodi che contengono passano a questo pool
+			   senza essere copiati né riallocati (serve a RBTree::mergeFrom e joinWith). I due allocatori devono
+			   essere uguali, perché sarà questo pool a restituire i chunk. Costa il numero di chunk di 'other',
+			   la lunghezza della sua free list e gli slot mai usati del più corto tra i due chunk correnti, che
+			   finiscono nella free list. Con FT_INSTRUMENT i chunk cambiano anche sink (vedi transferStats). */
+			void	splice(NodePool & other)
+			{
+				if (!other._chunks)
+					return ;
+
+				Chunk*		lastChunk = other._chunks;
+				size_type	bytes = lastChunk->slots * sizeof(NodeType);
+
+				while (lastChunk->next)
+				{
+					lastChunk = lastChunk->next;
+					bytes += lastChunk->slots * sizeof(NodeType);
+				}
+				transferStats(other, *this, bytes);
+				lastChunk->next = _chunks;
+				_chunks = other._chunks;
+				if (other._free)
+				{
+					FreeSlot*	lastFree = other._free;
+
+					while (lastFree->next)
+						lastFree = lastFree->next;
+					lastFree->next = _free;
+					_free = other._free;
+				}
+				if (other._last - other._next > _last - _next)
+				{
+					while (_next != _last)
+						deallocate(_next++);
+					_next = other._next;
+					_last = other._last;
+				}
+				else
+					while (other._next != other._last)
+						deallocate(other._next++);
+				if (other._chunkSize > _chunkSize)
+					_chunkSize = other._chunkSize;
+				other._chunks = NULL;
+				other._free = NULL;
+				other._next = NULL;
+				other._last = NULL;
+				other._chunkSize = FIRST_CHUNK;
+			};
+
+			/* Da chiamare dopo uno swap con cui i nodi cambiano albero senza che l'utente lo veda
+			   (le operazioni in blocco dell'RBTree): i chunk scambiati cambiano anche sink. Lo swap
+			   pubblico dei container invece lascia a ogni sink quello che ha registrato. */
+			void	recordExchange(NodePool & other)
+			{
+#ifdef FT_INSTRUMENT
+				transferStats(other, *this, chunkBytes());
+				transferStats(*this, other, other.chunkBytes());
+#else
+				(void)other;
+#endif
+			};
+
+			allocator_type	get_allocator() const { return (_alloc); };
+
+			/* Slot per nodi in tutti i chunk (header esclusi) e numero di chunk, per memory_usage(). */
+			void	footprint(size_type & slots, size_type & chunks) const
+			{
+				slots = 0;
+				chunks = 0;
+				for (Chunk const * chunk = _chunks; chunk; chunk = chunk->next)
+				{
+					slots += chunk->slots - 1;
+					chunks++;
+				}
+			};
+
+		private:
+			/* Il primo slot di ogni chunk ospita l'header con il collegamento al chunk precedente;
+			   un nodo libero ospita il collegamento al prossimo nodo libero. */
+			struct Chunk
+			{
+				Chunk*		next;
+				size_type	slots;
+			};
+
+			struct FreeSlot
+			{
+				FreeSlot*	next;
+			};
+
+			allocator_type	_alloc;
+			Chunk*			_chunks;	// lista dei chunk allocati
+			FreeSlot*		_free;		// nodi restituiti, pronti per essere riusati
+			NodeType*		_next;		// primo slot mai usato del chunk corrente
+			NodeType*		_last;		// fine del chunk corrente
+			size_type		_chunkSize;	// nodi del prossimo chunk
+
+			NodePool(NodePool const &);
+			NodePool&	operator=(NodePool const &);
+
+			/* Byte chiesti all'allocatore per tutti i chunk del pool. */
+			size_type	chunkBytes() const
+			{
+				size_type	bytes = 0;
+
+				for (Chunk const * chunk = _chunks; chunk; chunk = chunk->next)
+					bytes += chunk->slots * sizeof(NodeType);
+				return (bytes);
+			};
+
+			/* I chunk passati da 'from' a 'to' senza chiamare l'allocatore: per il sink di 'from' sono
+			   restituiti, per quello di 'to' allocati, così bytes_in_use() di entrambi resta giusto. */
+			static void	transferStats(NodePool & from, NodePool & to, size_type bytes)
+			{
+				if (!bytes)
+					return ;
+				from.recordDeallocate(bytes);
+				to.recordAllocate(bytes);
+			};
+
+			void	grow(size_type nodes)
+			{
+				NodeType*	block = _alloc.allocate(nodes + 1);
+				Chunk*		chunk = reinterpret_cast<Chunk*>(block);
+
+				this->recordAllocate((nodes + 1) * sizeof(NodeType));
+				chunk->next = _chunks;
+				chunk->slots = nodes + 1;
+				_chunks = chunk;
+				_next = block + 1;
+				_last = block + nodes + 1;
+			};
+	};
+}
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <stdexcept>
+#include <functional>
+#include "deque.hpp"
+#include "vector.hpp"
+#include "heap.hpp"
+
+namespace ft
+{
+	/* Coda FIFO sopra ft::deque: push in coda e pop in testa sono O(1) e, grazie al blocco di scorta
+	   del deque, una coda che scorre riusa sempre gli stessi blocchi (vedi deque.hpp).
+	   Il container sottostante deve fornire front, back, push_back e pop_front. */
+	template <class T, class Container = ft::deque<T> >
+	class queue
+	{
+		public:
+			typedef 			Container					container_type;
+			typedef				T							value_type;
+			typedef typename 	Container::size_type		size_type;
+			typedef typename	Container::reference		reference;
+			typedef typename	Container::const_reference	const_reference;
+
+
+			// * COSTRUTTORI * //
+
+			explicit queue (const Container& ctnr = Container()) : _c(ctnr) {}
+
+			queue (const queue& other) : _c(other._c) {}
+
+			queue& operator=(const queue& other)
+			{
+				if (this == &other)
+					return (*this);
+				this->_c = other._c;
+				return (*this);
+			}
+
+			~queue() {};
+
+
+			// * MEMBER FUNCTION * //
+
+			bool empty() const
+			{
+				return (_c.empty());
+			};
+
+			size_type size() const
+			{
+				return (_c.size());
+			};
+
+			reference front()
+			{
+				if (empty())
+					throw std::out_of_range("queue::front(): empty queue");
+				return (_c.front());
+			};
+
+			const_reference front() const
+			{
+				if (empty())
+					throw std::out_of_range("queue::front(): empty queue");
+				return (_c.front());
+			};
+
+			reference back()
+			{
+				if (empty())
+					throw std::out_of_range("queue::back(): empty queue");
+				return (_c.back());
+			};
+
+			const_reference back() const
+			{
+				if (empty())
+					throw std::out_of_range("queue::back(): empty queue");
+				return (_c.back());
+			};
+
+			void push (const value_type& value)
+			{
+				_c.push_back(value);
+			};
+
+			void pop()
+			{
+				_c.pop_front();
+			};
+
+			/* Quella del container sottostante, che deve fornire memory_usage() (ft::deque lo fa). */
+			memory_footprint	memory_usage() const
+			{
+				memory_footprint	usage = _c.memory_usage();
+
+				usage.overhead += sizeof(*this) - sizeof(_c);
+				return (usage);
+			};
+
+#ifdef FT_INSTRUMENT
+			void			set_alloc_stats(alloc_stats* stats)	{ _c.set_alloc_stats(stats); };
+			alloc_stats*	get_alloc_stats() const				{ return (_c.get_alloc_stats()); };
+#endif
+
+			template <class V, class Cont>
+			friend bool operator== (const queue<V,Cont>& lhs, const queue<V,Cont>& rhs);
+			template <class V, class Cont>
+			friend bool operator< (const queue<V,Cont>& lhs, const queue<V,Cont>& rhs);
+
+		protected:
+			container_type	_c;
+
+	};
+
+	template <class V, class Cont>
+	bool operator==(const ft::queue<V,Cont>& lhs, const ft::queue<V,Cont>& rhs)
+	{
+		return (lhs._c == rhs._c);
+	}
+
+	template <class V, class Cont>
+	bool operator!=(const ft::queue<V,Cont>& lhs, const ft::queue<V,Cont>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class V, class Cont>
+	bool operator<(const ft::queue<V,Cont>& lhs, const ft::queue<V,Cont>& rhs)
+	{
+		return (lhs._c < rhs._c);
+	}
+
+	template <class V, class Cont>
+	bool operator<=(const ft::queue<V,Cont>& lhs, const ft::queue<V,Cont>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class V, class Cont>
+	bool operator>(const ft::queue<V,Cont>& lhs, const ft::queue<V,Cont>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class V, class Cont>
+	bool operator>=(const ft::queue<V,Cont>& lhs, const ft::queue<V,Cont>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	/* Coda di priorità: uno heap implicito nel container (vedi dary_heap), con in cima l'elemento massimo
+	   secondo Compare; con std::greater è un min-heap, ad esempio per le scadenze di un timer. push e pop
+	   costano O(log n) spostamenti dentro un unico array, senza allocare un nodo per elemento né ribilanciare
+	   come farebbe ft::map usata allo stesso scopo. Arity sceglie lo heap d-ario: 4 dimezza l'altezza e
+	   di solito rende pop più veloce su code grandi (vedi bench/priority_queue).
+	   Il container deve avere iteratori ad accesso casuale, front, push_back e pop_back. */
+	template <class T, class Container = ft::vector<T>, class Compare = std::less<typename Container::value_type>,
+		std::size_t Arity = 2>
+	class priority_queue
+	{
+		public:
+			typedef				Container					container_type;
+			typedef				Compare						value_compare;
+			typedef typename	Container::value_type		value_type;
+			typedef typename	Container::size_type		size_type;
+			typedef typename	Container::reference		reference;
+			typedef typename	Container::const_reference	const_reference;
+			typedef				dary_heap<Arity>			heap_type;
+
+
+			// * COSTRUTTORI * //
+
+			explicit priority_queue(const Compare& comp = Compare(), const Container& ctnr = Container())
+				: _c(ctnr), _comp(comp)
+			{
+				heap_type::make_heap(_c.begin(), _c.end(), _comp);
+			}
+
+			/* Accoda [first, last) al container e costruisce lo heap una volta sola: O(n). */
+			template <class InputIt>
+			priority_queue(InputIt first, InputIt last, const Compare& comp = Compare(), const Container& ctnr = Container())
+				: _c(ctnr), _comp(comp)
+			{
+				_c.insert(_c.end(), first, last);
+				heap_type::make_heap(_c.begin(), _c.end(), _comp);
+			}
+
+			priority_queue(const priority_queue& other) : _c(other._c), _comp(other._comp) {}
+
+			priority_queue& operator=(const priority_queue& other)
+			{
+				if (this == &other)
+					return (*this);
+				this->_c = other._c;
+				this->_comp = other._comp;
+				return (*this);
+			}
+
+			~priority_queue() {};
+
+
+			// * MEMBER FUNCTION * //
+
+			bool empty() const
+			{
+				return (_c.empty());
+			};
+
+			size_type size() const
+			{
+				return (_c.size());
+			};
+
+			const_reference top() const
+			{
+				if (empty())
+					throw std::out_of_range("priority_queue::top(): empty priority_queue");
+				return (_c.front());
+			};
+
+			void push(const value_type& value)
+			{
+				_c.push_back(value);
+				heap_type::push_heap(_c.begin(), _c.end(), _comp);
+			};
+
+#if __cplusplus >= 201103L
+			void push(value_type&& value)
+			{
+				_c.push_back(std::move(value));
+				heap_type::push_heap(_c.begin(), _c.end(), _comp);
+			};
+#endif
+
+			void pop()
+			{
+				heap_type::pop_heap(_c.begin(), _c.end(), _comp);
+				_c.pop_back();
+			};
+
+			void swap(priority_queue& other)
+			{
+				Compare	tmp = _comp;
+
+				_c.swap(other._c);
+				_comp = other._comp;
+				other._comp = tmp;
+			};
+
+			/* Quella del container sottostante, che deve fornire memory_usage(). */
+			memory_footprint	memory_usage() const
+			{
+				memory_footprint	usage = _c.memory_usage();
+
+				usage.overhead += sizeof(*this) - sizeof(_c);
+				return (usage);
+			};
+
+#ifdef FT_INSTRUMENT
+			void			set_alloc_stats(alloc_stats* stats)	{ _c.set_alloc_stats(stats); };
+			alloc_stats*	get_alloc_stats() const				{ return (_c.get_alloc_stats()); };
+#endif
+
+		protected:
+			container_type	_c;
+			Compare			_comp;
+
+	};
+}
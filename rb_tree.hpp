@@ -1,21 +1,22 @@
 #pragma once
 
 #include <memory>
+#include <new>
 #include <utility>
 #include <iostream>
 #include <limits.h>
+#include <stdexcept>
+#include <string>
 #include "utility.hpp"
 #include "iterator.hpp"
+#include "node_color.hpp"
+#include "node_pool.hpp"
+#include "node_handle.hpp"
+#include "memory_stats.hpp"
+#include "vector.hpp"
 
 namespace ft
 {
-	enum node_color
-	{
-		RED,
-		BLACK,
-		SENTINEL
-	};
-
 	enum branch
 	{
 		LEFT,
@@ -23,16 +24,21 @@ namespace ft
 	};
 
 	/*Define a struct to represent a node in the RBTree. It stores a value, a color,
-	  pointers to its parent and its left and right children. */
+	  pointers to its parent and its left and right children.
+	  'count' è il numero di nodi del sottoalbero radicato nel nodo (0 nel sentinella): permette di
+	  rispondere a rank/select e di spostare gli iteratori in O(log n). */
 	template <typename T>
 	struct Node
 	{
 		node_color	color;
 		Node		*parent;
 		Node		*child[2];
+		std::size_t	count;
 		T 			data;
 
-		template <class U, class V> //Constructor for creating a node from a value
+		Node(T const & val) : data(val) {}; //Constructor for creating a node from a value
+
+		template <class U, class V> //Constructor for creating a node from a pair of a different type
 		Node(ft::pair<U, V> const & val) : data(val) {};
 	};
 
@@ -48,18 +54,57 @@ namespace ft
 		int						color;
 	};
 
+	/* Estrattori della chiave dal valore contenuto nel nodo: la map confronta solo il 'first'
+	   della coppia, il set confronta il valore stesso. Servono all'RBTree per scendere
+	   nell'albero senza conoscere il tipo concreto del container. */
+	template <class Pair>
+	struct select_first
+	{
+		typedef typename Pair::first_type	key_type;
+
+		key_type const &	operator()(Pair const & val) const { return (val.first); }
+	};
+
+	template <class T>
+	struct identity
+	{
+		typedef T	key_type;
+
+		T const &	operator()(T const & val) const { return (val); }
+	};
+
+	/* Forma dell'albero, come la restituisce RBTree::stats(). La profondità di un nodo è il numero di nodi
+	   visitati da una ricerca che lo trova (1 per la radice): per un albero rosso-nero height resta sotto
+	   2 * log2(size + 1), e average_depth vicino a log2(size + 1). */
+	struct tree_stats
+	{
+		std::size_t					size;
+		std::size_t					height;				// profondità massima, 0 per l'albero vuoto
+		std::size_t					black_height;		// nodi neri su ogni cammino dalla radice a una foglia
+		double						average_depth;		// media della profondità sulle chiavi
+		ft::vector<std::size_t>		depth_histogram;	// [d] = numero di chiavi a profondità d + 1
+
+		tree_stats() : size(0), height(0), black_height(0), average_depth(0) {};
+	};
+
 	/* Define a class to represent a Red-Black Tree (RBTree) with nodes of type NodeType,
 	   keys of type Key, and values of type Value. The RBTree is implemented using a binary
 	   search tree, and satisfies the properties of a red-black tree (e.g., every node is
 	   either red or black, the root is black, no two adjacent nodes can be red, etc.).
 	   The class also provides various methods for manipulating the tree, including
-	   insert, remove, find, and traversal methods. */
+	   insert, remove, find, and traversal methods.
+	   'Unique' distingue map e set (chiavi univoche) da multimap e multiset: decide solo come si comportano
+	   insertRange, insertHandle e verify(); gli inserimenti con chiavi ripetute sono insertEqual e insertEqualHint.
+	   Le operazioni che valgono solo con chiavi univoche sono protette (vedi insertUnique) e arrivano
+	   all'interfaccia solo attraverso map e set. */
 	template <	class Key,
 				class NodeType,
 				class Iterator,
 				class ConstIterator,
+				class KeyOfValue,
 				class Compare = std::less<Key>,
-				class Alloc = std::allocator<Key> >
+				class Alloc = std::allocator<Key>,
+				bool Unique = true >
 	class RBTree
 	{
 
@@ -69,8 +114,10 @@ namespace ft
 		typedef Key														value_type;
 		typedef Compare													key_compare;
 		typedef Compare													value_compare;
+		typedef typename KeyOfValue::key_type							node_key_type;
 		typedef typename Alloc::template rebind<NodeType>::other		allocator_type;
 		typedef typename Alloc::template rebind<originalNode>::other	allocator_type2;
+		typedef NodePool<NodeType, allocator_type>						pool_type;
 		typedef typename allocator_type::reference						reference;
 		typedef typename allocator_type::const_reference				const_reference;
 		typedef typename allocator_type::pointer						pointer;
@@ -85,63 +132,208 @@ namespace ft
 		/* Questo è il costruttore di default della classe RBTree.
 		   Viene inizializzato l'albero con la radice NULL, la dimensione 0 e un allocator di tipo allocator_type().
 		   Viene inoltre allocato il sentinel, un elemento sentinella, che sarà utilizzato come elemento terminale dell'albero e colorato come SENTINEL.
-		   Il sentinel viene poi impostato come radice dell'albero, e viene assegnato come padre della radice. */
+		   Il sentinel viene poi impostato come radice dell'albero, e viene assegnato come padre della radice.
+		   I figli del sentinel non servono come foglia: tengono in cache il minimo (child[LEFT]) e il massimo (child[RIGHT])
+		   dell'albero, e in un albero vuoto puntano al sentinel stesso. */
 		RBTree() :	_root(NULL),
 						_size(0),
-						_alloc(allocator_type())
+						_alloc(allocator_type()),
+						_pool(_alloc)
 		{
 			_sentinel = _alloc.allocate(1);
 			_sentinel->color = SENTINEL;
+			_sentinel->count = 0;
 			_root = _sentinel;
 			_sentinel->parent = _root;
+			_sentinel->child[LEFT] = _sentinel;
+			_sentinel->child[RIGHT] = _sentinel;
 		};
 
-		/* Il costruttore di copia RBTree(RBTree const &src) crea una nuova istanza di RBTree come copia di src.
-		   Inizializza il membro _alloc con un'istanza di allocator_type(), alloca un nodo sentinella _sentinel attraverso la funzione allocate() dell'allocator _alloc,
-		   inizializza i campi di _sentinel con SENTINEL per il colore e con _root per il puntatore del genitore, quindi assegna _sentinel a _root e inizializza _size a 0.
-		   Successivamente, itera sugli elementi di src usando l'iteratore iterator e inserisce ogni valore nell'albero attraverso la funzione insert().
-		   Alla fine, viene creata una copia dell'albero src. */
-		RBTree(RBTree const &src)
+		/* Il costruttore di copia crea un nuovo sentinella e poi clona la struttura di src (vedi cloneFrom):
+		   stessa forma, stessi colori, nessun confronto tra chiavi e nodi presi da un unico blocco del pool.
+		   Se la copia di un valore lancia un'eccezione, i nodi già copiati vengono distrutti e il sentinella
+		   liberato prima di propagarla. */
+		RBTree(RBTree const &src) :	_key_compare(src._key_compare),
+										_root(NULL),
+										_size(0),
+										_alloc(src._alloc),
+										_pool(_alloc),
+										_c(src._c)
 		{
-			_alloc = allocator_type();
 			_sentinel = _alloc.allocate(1);
 			_sentinel->color = SENTINEL;
+			_sentinel->count = 0;
 			_root = _sentinel;
 			_sentinel->parent = _root;
-			_root = _sentinel;
-			_size = 0;
-			iterator	iter = src.begin();
-			while (iter != src.end())
-				this->insert(*iter++);
+			_sentinel->child[LEFT] = _sentinel;
+			_sentinel->child[RIGHT] = _sentinel;
+			try
+			{
+				cloneFrom(src);
+			}
+			catch (...)
+			{
+				_alloc.deallocate(_sentinel, 1);
+				throw ;
+			}
 		};
 
-		/* Questa è la definizione dell'operatore di assegnazione, ovvero l'operatore che permette di copiare una RBTree in un'altra.
-		   L'operatore è ridefinito perché, essendo una struttura di dati complessa, la copia bit a bit dei dati non è sufficiente per effettuare una copia corretta.
-		   Il codice controlla innanzitutto che gli oggetti non siano gli stessi (in tal caso ritorna il puntatore all'oggetto corrente).
-		   Dopodiché, copia l'allocator dall'oggetto passato come parametro, alloca l'oggetto _sentinel, lo imposta come sentinella (SENTELIN),
-		   ne assegna il genitore a _root e imposta il valore di _size a 0. Infine, chiama la funzione insert per ogni elemento nella RBTree passata come parametro, copiandoli tutti nella RBTree corrente.
-		   Il valore di ritorno è l'oggetto RBTree corrente, perché in C++ l'operatore di assegnazione deve restituire un riferimento all'oggetto che viene assegnato. */
+		/* L'assegnazione svuota l'albero (il sentinella viene riutilizzato, non riallocato) e clona rhs.
+		   Se la copia di un valore lancia un'eccezione l'albero resta vuoto ma valido. */
 		RBTree &operator=(RBTree const &rhs)
 		{
 			if (this == &rhs)
 				return (*this);
-			_alloc = rhs.get_allocator();
-			_sentinel = _alloc.allocate(1);
-			_sentinel->color = SENTINEL;
-			_root = _sentinel;
-			_sentinel->parent = _root;
-			_root = _sentinel;
-			_size = 0;
-			this->insert(rhs.begin(), rhs.end());
+			clear();
+			_key_compare = rhs._key_compare;
+			_c = rhs._c;
+			cloneFrom(rhs);
 			return (*this);
 		};
 
-		/*Libera la memoria allocata per il nodo sentinella.*/
-		~RBTree() { _alloc.deallocate(_sentinel, 1); };
+		/* Distrugge gli elementi rimasti, restituisce i chunk del pool e libera il nodo sentinella. */
+		~RBTree()
+		{
+			clear();
+			_alloc.deallocate(_sentinel, 1);
+		};
 
 		/* Restituisce l'allocator utilizzato per allocare la memoria per il RBTree. */
 		allocator_type	get_allocator() const { return (this->_alloc); }
 
+		/* L'overhead comprende, per ogni elemento, i campi del nodo oltre al valore (colore, tre puntatori,
+		   contatore del sottoalbero e padding), più il sentinella e l'header di ogni chunk del pool.
+		   Lo slack sono gli slot del pool non occupati: free list e coda del chunk corrente. */
+		memory_footprint	memory_usage() const
+		{
+			size_type	slots;
+			size_type	chunks;
+
+			_pool.footprint(slots, chunks);
+			return (memory_footprint(_size * sizeof(value_type),
+				sizeof(*this) + _size * (sizeof(NodeType) - sizeof(value_type)) + (chunks + 1) * sizeof(NodeType),
+				(slots - _size) * sizeof(NodeType)));
+		}
+
+#ifdef FT_INSTRUMENT
+		/* I nodi arrivano tutti dal pool, quindi il sink è il suo. Il sentinella, allocato dal costruttore
+		   prima che un sink si possa collegare, non viene registrato. */
+		void			set_alloc_stats(alloc_stats* stats)	{ _pool.set_alloc_stats(stats); }
+		alloc_stats*	get_alloc_stats() const				{ return (_pool.get_alloc_stats()); }
+#endif
+
+		/* Altezza, altezza nera e distribuzione delle profondità, con una visita di tutto l'albero: O(n).
+		   La visita usa uno stack esplicito, quindi funziona anche su un albero degenerato. */
+		tree_stats	stats() const
+		{
+			tree_stats				ret;
+			ft::vector<WalkFrame>	stack;
+			double					depthSum = 0;
+
+			ret.size = _size;
+			if (_root == _sentinel)
+				return (ret);
+			stack.push_back(WalkFrame(_root, _sentinel, _sentinel, 1, 0));
+			while (!stack.empty())
+			{
+				WalkFrame	frame = stack.back();
+
+				stack.pop_back();
+				if (frame.node->color == BLACK)
+					frame.blacks++;
+				if (ret.depth_histogram.size() < frame.depth)
+					ret.depth_histogram.resize(frame.depth, 0);
+				ret.depth_histogram[frame.depth - 1]++;
+				depthSum += frame.depth;
+				if (frame.node->child[LEFT] == _sentinel || frame.node->child[RIGHT] == _sentinel)
+					ret.black_height = frame.blacks;
+				for (int side = LEFT; side <= RIGHT; side++)
+					if (frame.node->child[side] != _sentinel)
+						stack.push_back(WalkFrame(frame.node->child[side], _sentinel, _sentinel, frame.depth + 1, frame.blacks));
+			}
+			ret.height = ret.depth_histogram.size();
+			ret.average_depth = depthSum / _size;
+			return (ret);
+		}
+
+		/* Controlla tutte le invarianti dell'albero in O(n): ordine delle chiavi (crescente, o non decrescente
+		   con chiavi ripetute), colori (radice nera,
+		   nessun rosso con figli rossi), stessa altezza nera su ogni cammino, collegamenti ai padri,
+		   contatori dei sottoalberi, size() e la cache di minimo e massimo nel sentinella.
+		   Restituisce NULL se l'albero è valido, altrimenti la descrizione della prima violazione trovata.
+		   Non si fida dei puntatori ai padri e si ferma dopo size() nodi, quindi termina anche su un albero
+		   corrotto. Compilando con FT_RBTREE_DEBUG viene chiamata dopo ogni modifica (vedi debugVerify). */
+		char const *	verify() const
+		{
+			ft::vector<WalkFrame>	stack;
+			size_type				visited = 0;
+			size_type				blackHeight = 0;
+
+			if (_sentinel->color != SENTINEL || _sentinel->count != 0)
+				return ("sentinel was modified");
+			if (_sentinel->parent != _root)
+				return ("sentinel does not point to the root");
+			if (_root == _sentinel)
+			{
+				if (_size != 0)
+					return ("empty tree with non-zero size");
+				if (_sentinel->child[LEFT] != _sentinel || _sentinel->child[RIGHT] != _sentinel)
+					return ("empty tree with cached min/max");
+				return (NULL);
+			}
+			if (_root->parent != _sentinel)
+				return ("root parent is not the sentinel");
+			if (_root->color != BLACK)
+				return ("root is not black");
+			stack.push_back(WalkFrame(_root, _sentinel, _sentinel, 1, 0));
+			while (!stack.empty())
+			{
+				WalkFrame	frame = stack.back();
+				pointer		node = frame.node;
+
+				stack.pop_back();
+				if (++visited > _size)
+					return ("more nodes than size()");
+				if (node->color != RED && node->color != BLACK)
+					return ("node with invalid color");
+				if (node->color == BLACK)
+					frame.blacks++;
+				if (frame.low != _sentinel && (Unique ? !_c(KeyOfValue()(frame.low->data), KeyOfValue()(node->data))
+						: _c(KeyOfValue()(node->data), KeyOfValue()(frame.low->data))))
+					return ("key order violated");
+				if (frame.high != _sentinel && (Unique ? !_c(KeyOfValue()(node->data), KeyOfValue()(frame.high->data))
+						: _c(KeyOfValue()(frame.high->data), KeyOfValue()(node->data))))
+					return ("key order violated");
+				if (node->count != node->child[LEFT]->count + node->child[RIGHT]->count + 1)
+					return ("wrong subtree count");
+				for (int side = LEFT; side <= RIGHT; side++)
+				{
+					pointer	child = node->child[side];
+
+					if (child == _sentinel)
+					{
+						if (blackHeight == 0)
+							blackHeight = frame.blacks;
+						else if (blackHeight != frame.blacks)
+							return ("black height differs between paths");
+						continue ;
+					}
+					if (child->parent != node)
+						return ("wrong parent link");
+					if (node->color == RED && child->color == RED)
+						return ("red node with red child");
+					stack.push_back(WalkFrame(child, side == LEFT ? frame.low : node, side == LEFT ? node : frame.high,
+						frame.depth + 1, frame.blacks));
+				}
+			}
+			if (visited != _size)
+				return ("fewer nodes than size()");
+			if (_sentinel->child[LEFT] != RBNavigator<NodeType>::leftmost(_root)
+				|| _sentinel->child[RIGHT] != RBNavigator<NodeType>::rightmost(_root))
+				return ("cached min/max out of date");
+			return (NULL);
+		}
+
 		/* Restituisce true se il RBTree è vuoto, false altrimenti. */
 		bool empty() const { return ((!this->_size) ? true : false); }
 
@@ -153,105 +345,176 @@ namespace ft
 
 
 		/* Restituiscono degli iteratori che permettono di iterare tra gli elementi del RBTree. */
-		iterator				begin() { return (iterator(min(), _sentinel)); }
-		const_iterator			begin() const { return (const_iterator(min(), _sentinel)); }
-		iterator				end() { return iterator(_sentinel, _sentinel); }
-		const_iterator			end() const { return const_iterator(_sentinel, _sentinel); }
+		iterator				begin() { return (iterator(min())); }
+		const_iterator			begin() const { return (const_iterator(min())); }
+		iterator				end() { return iterator(_sentinel); }
+		const_iterator			end() const { return const_iterator(_sentinel); }
 		reverse_iterator		rbegin() { return (reverse_iterator(end())); }
-		const_reverse_iterator	rbegin() const { return (const_iterator(end())); }
+		const_reverse_iterator	rbegin() const { return (const_reverse_iterator(end())); }
 		reverse_iterator		rend() { return (reverse_iterator(begin())); }
 		const_reverse_iterator	rend() const { return (const_reverse_iterator(begin())); }
 
-		/* Questo metodo accetta un puntatore a nodo e un valore di chiave e cerca ricorsivamente il nodo nell'albero con quella chiave.
-		   Restituisce un iteratore al nodo se trovato, altrimenti restituisce un iteratore alla fine. */
-		virtual iterator					findPointer(pointer& start, Key const & val) const = 0;
+		/* Le discese per chiave sono template sul tipo cercato: di solito è node_key_type, ma con un
+		   comparatore trasparente (vedi is_transparent) map e set ci passano direttamente il tipo dell'utente,
+		   che viene confrontato con le chiavi dei nodi senza mai essere convertito.
 
-		/* Questo metodo accetta un valore di chiave e rimuove dal sottoalbero radicato al nodo con la chiave specificata tutti i nodi con quella chiave.
-		   Restituisce il numero di nodi rimossi. */
-		virtual iterator					erase_deep(Key const & val) = 0;
+		   Cerca il nodo con chiave equivalente a 'key' con una discesa iterativa: si calcola il
+		   lower bound (un solo confronto per livello) e si controlla con un ultimo confronto che
+		   la chiave trovata non sia maggiore di quella cercata. Restituisce il sentinella se la chiave manca. */
+		template <class K>
+		pointer	findNode(K const & key) const
+		{
+			pointer	node = lowerBound(key);
 
-		/* questo metodo accetta un valore di chiave e inserisce un nuovo nodo nell'albero con quella chiave.
-		   Restituisce un oggetto pair composto da un iteratore al nodo appena inserito
-		   e un flag booleano che indica se l'inserimento è avvenuto con successo o se la chiave era già presente nell'albero. */
-		virtual ft::pair<iterator, bool>	insert(Key const &val) = 0;
+			if (node == _sentinel || _c(key, KeyOfValue()(node->data)))
+				return (_sentinel);
+			return (node);
+		}
 
-		/* Questo metodo accetta tre puntatori a nodi e un flag.
-		   Inserisce il nodo node nell'albero come figlio del nodo parent, avendo come figlio destro o sinistro a seconda del valore di flag.
-		   Il parametro start è il puntatore alla radice dell'albero. Restituisce un oggetto pair composto da un iteratore al nodo appena inserito e un flag booleano che indica se l'inserimento è avvenuto con successo.*/
-		virtual ft::pair<iterator, bool>	insertNode(pointer &start, pointer &node, pointer& parent, int flag) = 0;
+		/* Inserimento con chiavi ripetute, dopo tutti gli equivalenti (vedi insertEqualFrom). */
+		pointer	insertEqual(value_type const & val)
+		{
+			return (insertEqualFrom(val, false));
+		}
 
-		virtual void						clear() = 0;
+		/* Inserimento con chiavi ripetute e suggerimento (vedi insertEqualHintFrom). */
+		pointer	insertEqualHint(pointer hint, value_type const & val)
+		{
+			return (insertEqualHintFrom(hint, val));
+		}
 
-		/* La funzione controlla se il nodo passato come argomento è il nodo più piccolo dell'albero.
-		   In questo caso, restituisce un puntatore al sentinella, che rappresenta il minimo valore nell'albero.
-		   Se il nodo non è il minimo, cerca il massimo valore nel sottoalbero sinistro del nodo.
-		   Se esiste, restituisce il massimo valore. Se non esiste, la funzione risale l'albero risalendo i genitori
-		   fino a trovare il primo genitore che ha il figlio destro uguale al nodo passato come argomento e restituisce questo genitore. */
-		pointer	getPredecessor(pointer const & node) const
+		/* Inserimento di un range. Se l'albero è vuoto il range viene letto una sola volta: finché i valori
+		   arrivano ordinati i nodi vengono creati e accodati in una lista (con chiavi univoche i duplicati consecutivi sono saltati),
+		   poi la lista diventa un albero perfettamente bilanciato in O(n) senza confronti né rotazioni (vedi buildBalanced).
+		   Se il range smette di essere ordinato (o l'albero non è vuoto), gli elementi rimanenti vengono inseriti uno alla volta
+		   con la fine come suggerimento, così un range che prosegue oltre il massimo non scende mai dalla radice.
+		   Con iteratori forward o superiori il pool viene riservato in anticipo, così i nodi arrivano da un solo chunk.
+		   Se la costruzione di un valore lancia un'eccezione i nodi già creati vengono distrutti e l'albero resta vuoto. */
+		template <class InputIt>
+		void	insertRange(InputIt first, InputIt last)
 		{
-			pointer	tmp = node;
+			pointer		head = _sentinel;
+			pointer		tail = _sentinel;
+			size_type	count = 0;
 
-			if (node == min())
-				return (_sentinel);
-			if (tmp->child[LEFT] != _sentinel)
-				return (max(tmp->child[LEFT]));
-			else
+			if (_size)
 			{
-				while (tmp->parent != _sentinel)
+				while (first != last)
+					insertAtEnd(*first++);
+				return ;
+			}
+			if (is_forward_iterator_tagged<typename ft::iterator_traits<InputIt>::iterator_category>::value)
+				_pool.reserve(ft::distance(first, last));
+			try
+			{
+				for (; first != last; ++first)
 				{
-					if (tmp->parent->child[RIGHT] == tmp)
+					if (tail != _sentinel && !_c(KeyOfValue()(tail->data), KeyOfValue()(*first)))
 					{
-						tmp = tmp->parent;
-						break ;
+						if (_c(KeyOfValue()(*first), KeyOfValue()(tail->data)))
+							break ;
+						if (Unique)
+							continue ;
 					}
-					tmp = tmp->parent;
+					pointer	node = createNode(*first);
+
+					if (tail == _sentinel)
+						head = node;
+					else
+						tail->child[RIGHT] = node;
+					tail = node;
+					count++;
 				}
-				return (tmp);
 			}
+			catch (...)
+			{
+				destroyList(head);
+				throw ;
+			}
+			buildFromList(head, count);
+			while (first != last)
+				insertAtEnd(*first++);
 		}
 
-		/* La funzione controlla se il nodo passato come parametro è il massimo della pianta: in questo caso restituisce il sentinella.
-		   Altrimenti, se il figlio destro del nodo non è il sentinella, restituisce il nodo minimo del sottoalbero radicato in quel figlio destro.
-		   In caso contrario, cerca il primo genitore a sinistra e restituisce tale nodo, oppure il sentinella se non trova un genitore a sinistra.
-		   Il comportamento di getPredecessor è simile, ma cerca il predecessore invece del successore del nodo passato come parametro. */
-		pointer	getSuccessor(pointer const & node) const
+		/* Rimuove 'node' dall'albero, ribilancia e distrugge il nodo restituendolo al pool.
+		   Gli altri nodi non vengono spostati in memoria, quindi gli iteratori agli altri elementi restano validi. */
+		void	eraseNode(pointer node)
 		{
-			pointer	tmp = node;
+			unlink(node);
+			destroyNode(node);
+		}
 
-			if (node == max())
-				return (_sentinel);
-			if (tmp->child[RIGHT] != _sentinel)
-				return (min(tmp->child[RIGHT]));
-			else
+		/* Sposta il valore di 'node' nella handle vuota 'handle', stacca il nodo dall'albero e ne restituisce
+		   lo slot al pool. Se lo spostamento lancia un'eccezione l'albero e la handle restano come prima. */
+		template <class Handle>
+		void	extractInto(pointer node, Handle & handle)
+		{
+			relocate_value(handle.ptr(), node->data);
+			handle._full = true;
+			unlink(node);
+			_pool.deallocate(node);
+		}
+
+		/* Inserisce il valore della handle spostandolo in un nodo del pool; la handle si svuota solo se
+		   il valore viene inserito, altrimenti lo tiene (chiave già presente, solo con chiavi univoche). Con 'hint' diverso da NULL
+		   l'inserimento parte dal suggerimento come insertHint. Una handle vuota non inserisce nulla
+		   e restituisce il sentinella. */
+		template <class Handle>
+		ft::pair<pointer, bool>	insertHandle(Handle & handle, pointer hint = NULL)
+		{
+			ft::pair<pointer, bool>	ret(_sentinel, false);
+
+			if (handle.empty())
+				return (ret);
+			if (hint)
 			{
-				while (tmp->parent != _sentinel)
-				{
-					if (tmp->parent->child[LEFT] == tmp)
-					{
-						tmp = tmp->parent;
-						break ;
-					}
-					tmp = tmp->parent;
-				}
-				return (tmp);
+				size_type	before = _size;
+
+				ret.first = Unique ? insertHintAdopt(hint, *handle.ptr()) : insertEqualHintAdopt(hint, *handle.ptr());
+				ret.second = (_size != before);
 			}
+			else if (Unique)
+				ret = insertUniqueAdopt(*handle.ptr());
+			else
+				ret = ft::make_pair(insertEqualAdopt(*handle.ptr()), true);
+			if (ret.second)
+				handle._full = false;
+			return (ret);
 		}
 
-		/* In questa implementazione, viene innanzitutto inizializzato un puntatore node all'indirizzo della radice _root.
-		   Se l'albero è vuoto o la radice è il sentinella, viene restituito il puntatore al sentinella.
-		   In caso contrario, il ciclo while viene eseguito finché il puntatore node non punta a un nodo che non ha un figlio sinistro oppure il figlio sinistro è il sentinella.
-		   In questo caso, il puntatore viene aggiornato al puntatore al figlio sinistro del nodo corrente.
-		   Quando il ciclo termina, il puntatore node punta al nodo con la chiave minima e viene restituito il suo valore. */
-		pointer	min() const
+		/* Distrugge tutti gli elementi con una visita dell'albero (senza ribilanciamenti) e restituisce
+		   all'allocatore tutti i chunk del pool in un colpo solo. */
+		void	clear()
 		{
-			const pointer*	node = &_root;
+			destroySubtree(_root);
+			_pool.release();
+			_root = _sentinel;
+			_sentinel->parent = _root;
+			_sentinel->child[LEFT] = _sentinel;
+			_sentinel->child[RIGHT] = _sentinel;
+			_size = 0;
+		}
 
-			if (!(*node) || (*node) == _sentinel)
-				return (_sentinel);
+		/* Restituisce il nodo che precede 'node' nell'ordine delle chiavi, oppure il sentinella se 'node' è il minimo.
+		   Se esiste un sottoalbero sinistro il predecessore è il suo massimo, altrimenti si risale finché
+		   non si arriva da un figlio destro. Vedi RBNavigator in iterator.hpp. */
+		pointer	getPredecessor(pointer const & node) const
+		{
+			return (RBNavigator<NodeType>::predecessor(node));
+		}
+
+		/* Restituisce il nodo che segue 'node' nell'ordine delle chiavi, oppure il sentinella se 'node' è il massimo.
+		   Il comportamento è simmetrico a getPredecessor e non richiede di calcolare il massimo dell'albero. */
+		pointer	getSuccessor(pointer const & node) const
+		{
+			return (RBNavigator<NodeType>::successor(node));
+		}
 
-			while ((*node)->child[LEFT] && (*node)->child[LEFT] != _sentinel)
-				node = &(*node)->child[LEFT];
-			return (*node);
+		/* Il minimo dell'albero è tenuto in cache nel figlio sinistro del sentinella: O(1).
+		   In un albero vuoto è il sentinella stesso, quindi begin() == end(). */
+		pointer	min() const
+		{
+			return (_sentinel->child[LEFT]);
 		}
 
 		/* La funzione 'min' prende un puntatore a un nodo dell'albero e restituisce un puntatore al nodo con la chiave minima dell'albero il cui nodo radice è il nodo passato come parametro.
@@ -271,21 +534,10 @@ namespace ft
 			return (*tmp);
 		}
 
-		/* La funzione 'max' restituisce un puntatore all'elemento con la chiave massima nell'albero.
-		   Inizialmente, viene inizializzato un puntatore node con la radice dell'albero _root.
-		   Se la radice è null o _sentinel, l'albero è vuoto e viene restituito il puntatore _sentinel.
-		   Altrimenti, si itera sull'albero a partire dalla radice, seguendo sempre il figlio destro finché esiste un figlio destro e non è il _sentinel.
-		   Quando non è più possibile seguire il figlio destro, l'iterazione termina e viene restituito il puntatore al nodo trovato come massimo. */
+		/* Il massimo dell'albero, tenuto in cache nel figlio destro del sentinella: O(1). */
 		pointer	max() const
 		{
-			pointer	node = _root;
-
-			if (!node || node == _sentinel)
-				return (_sentinel);
-
-			while (node->child[RIGHT] && node->child[RIGHT] != _sentinel)
-				node = node->child[RIGHT];
-			return (node);
+			return (_sentinel->child[RIGHT]);
 		}
 
 		/* La funzione riceve un parametro node che rappresenta la radice del sottoalbero in cui cercare il valore massimo.
@@ -304,6 +556,85 @@ namespace ft
 			return (tmp);
 		}
 
+		/* Discesa radice-foglia che restituisce il primo nodo la cui chiave non è minore di 'key'.
+		   Ogni volta che il nodo corrente è un candidato lo si memorizza e si prosegue a sinistra,
+		   altrimenti si prosegue a destra: il costo è l'altezza dell'albero, O(log n).
+		   Se nessun nodo soddisfa la condizione viene restituito il sentinella (end()). */
+		template <class K>
+		pointer	lowerBound(K const & key) const
+		{
+			return (lowerBound(_root, _sentinel, key));
+		}
+
+		/* Come lowerBound, ma restituisce il primo nodo la cui chiave è strettamente maggiore di 'key'. */
+		template <class K>
+		pointer	upperBound(K const & key) const
+		{
+			return (upperBound(_root, _sentinel, key));
+		}
+
+		/* Il nodo in posizione k (da 0) nell'ordine delle chiavi, o il sentinella se k >= size(): O(log n). */
+		pointer	selectNode(size_type k) const
+		{
+			return (RBNavigator<NodeType>::select(_sentinel, k));
+		}
+
+		/* Numero di chiavi strettamente minori di 'key'. Stessa discesa di lowerBound: ogni volta che si
+		   va a destra si contano il nodo corrente e il suo sottoalbero sinistro. */
+		template <class K>
+		size_type	rankOf(K const & key) const
+		{
+			pointer		node = _root;
+			size_type	ret = 0;
+
+			while (node != _sentinel)
+			{
+				if (_c(KeyOfValue()(node->data), key))
+				{
+					ret += node->child[LEFT]->count + 1;
+					node = node->child[RIGHT];
+				}
+				else
+					node = node->child[LEFT];
+			}
+			return (ret);
+		}
+
+		/* Restituisce la coppia [lower, upper) in una sola discesa: finché la chiave non viene trovata
+		   si aggiorna solo il limite superiore; una volta trovato il nodo uguale, il lower bound si cerca
+		   nel suo sottoalbero sinistro e l'upper bound nel suo sottoalbero destro. */
+		template <class K>
+		ft::pair<pointer, pointer>	equalRange(K const & key) const
+		{
+			pointer	node = _root;
+			pointer	upper = _sentinel;
+
+			while (node != _sentinel)
+			{
+				if (_c(KeyOfValue()(node->data), key))
+					node = node->child[RIGHT];
+				else if (_c(key, KeyOfValue()(node->data)))
+				{
+					upper = node;
+					node = node->child[LEFT];
+				}
+				else
+					return (ft::make_pair(lowerBound(node->child[LEFT], node, key),
+											upperBound(node->child[RIGHT], upper, key)));
+			}
+			return (ft::make_pair(upper, upper));
+		}
+
+		/* Numero di elementi con chiave equivalente a 'key' (più di uno solo con chiavi ripetute): la differenza
+		   tra le posizioni dei due estremi di equalRange, O(log n) qualunque sia il numero di elementi. */
+		template <class K>
+		size_type	countEqual(K const & key) const
+		{
+			ft::pair<pointer, pointer>	range = equalRange(key);
+
+			return (RBNavigator<NodeType>::rank(range.second) - RBNavigator<NodeType>::rank(range.first));
+		}
+
 		/* Questo metodo scambia i contenuti dell'oggetto corrente con quelli di un altro oggetto RBTree passato per riferimento come parametro.
 		   Il metodo inizia con un controllo per evitare di scambiare l'oggetto corrente con se stesso, quindi salva temporaneamente i membri dell'oggetto corrente
 		   (radice, sentinella, dimensione, tipo di allocazione e comparatore) in variabili temporanee.
@@ -332,11 +663,59 @@ namespace ft
 			rhs._size = tmpSize;
 			rhs._alloc = tmpAllocatorType;
 			rhs._c = tmpCompare;
+			this->_pool.swap(rhs._pool);
 		}
 
 		key_compare		key_comp() const { return (this->_key_compare); }
 
 	protected:
+		/* Un passo della visita di stats() e verify(): il nodo, i nodi che ne limitano la chiave
+		   (il sentinella se non c'è limite), la sua profondità e i nodi neri sopra di lui. */
+		struct WalkFrame
+		{
+			pointer		node;
+			pointer		low;
+			pointer		high;
+			size_type	depth;
+			size_type	blacks;
+
+			WalkFrame(pointer n, pointer l, pointer h, size_type d, size_type b) : node(n), low(l), high(h), depth(d), blacks(b) {};
+		};
+
+		/* Un albero rosso-nero staccato, con la radice nera (o il sentinella) e la sua altezza nera,
+		   cioè i nodi neri su ogni cammino dalla radice a una foglia. È l'unità su cui lavorano
+		   split e join: l'altezza nera viaggia con l'albero, così un join non deve ricalcolarla. */
+		struct Subtree
+		{
+			pointer		root;
+			size_type	blackHeight;
+
+			Subtree() : root(NULL), blackHeight(0) {};
+			Subtree(pointer r, size_type h) : root(r), blackHeight(h) {};
+		};
+
+		/* Lista ordinata di nodi collegati tramite child[RIGHT], terminata dal sentinella: gli elementi
+		   scartati da mergeFrom e quelli che splitAt sposta in un altro albero. */
+		struct NodeList
+		{
+			pointer		head;
+			pointer		tail;
+			size_type	count;
+
+			NodeList(pointer sentinel) : head(sentinel), tail(sentinel), count(0) {};
+
+			void	append(pointer node, pointer sentinel)
+			{
+				node->child[RIGHT] = sentinel;
+				if (tail == sentinel)
+					head = node;
+				else
+					tail->child[RIGHT] = node;
+				tail = node;
+				count++;
+			};
+		};
+
 		key_type		_key_type;
 		value_type		_value_type;
 		key_compare		_key_compare;
@@ -346,394 +725,725 @@ namespace ft
 		size_type		_size;
 		allocator_type	_alloc;
 		allocator_type2	_alloc2;
+		pool_type		_pool;
 		Compare			_c;
 
-		/* Questa è una funzione privata della classe RBTree che prende un nodo e restituisce il suo unico figlio, se tale figlio non ha figli a sua volta (ovvero è una foglia).
-		   La funzione controlla se il nodo ha un figlio sinistro ma non destro o viceversa, in tal caso restituisce il figlio che soddisfa questa condizione.
-		   Se il nodo ha entrambi i figli o nessun figlio, la funzione restituisce NULL.
-		   Successivamente, viene controllato se il figlio restituito ha a sua volta figli. Se il figlio ha figli, la funzione restituisce NULL. Altrimenti, la funzione restituisce il figlio.
-		   Questa funzione viene utilizzata internamente dalla classe RBTree durante la cancellazione di un nodo con zero o un solo figlio.
-		   Se il nodo ha un solo figlio, il figlio viene utilizzato per sostituire il nodo cancellato.
-		   La funzione getOnlyChildWithoutChildren viene utilizzata per controllare se il figlio del nodo cancellato è effettivamente una foglia.
-		   In caso contrario, la cancellazione non può essere eseguita e viene restituito un errore. */
-		pointer	getOnlyChildWithoutChildren(pointer const & node)
-		{
-			pointer	child;
-
-			if (node->child[LEFT] != _sentinel && node->child[RIGHT] == _sentinel)
-				child = node->child[LEFT];
-			else if (node->child[LEFT] == _sentinel && node->child[RIGHT] != _sentinel)
-				child = node->child[RIGHT];
-			else
-				return (NULL);
-			if (child->child[LEFT] != _sentinel || child->child[RIGHT] != _sentinel)
-				return (NULL);
-			return (child);
+		/* Operazioni che presuppongono chiavi univoche. Sono protette, quindi l'unico accesso è attraverso
+		   i metodi di map e set (insert, merge, split, join, unite, intersect, subtract): multimap e multiset,
+		   che derivano dallo stesso RBTree con Unique = false, non le espongono. Un'altra operazione che
+		   richiede chiavi univoche va aggiunta qui. */
+
+		/* Inserimento con chiave univoca in una sola discesa (vedi insertUniqueFrom): restituisce il nodo
+		   (nuovo o già esistente) e true se è stato inserito. */
+		ft::pair<pointer, bool>	insertUnique(value_type const & val)
+		{
+			return (insertUniqueFrom(val));
 		}
 
-		/* La funzione rotateLeft effettua una rotazione sinistra nell'albero rosso-nero a partire dal nodo passato come parametro node.
-		   La rotazione sinistra coinvolge il nodo stesso e il suo figlio destro.
-		   La funzione gestisce diverse operazioni per eseguire la rotazione, come la creazione di un puntatore temporaneo tmp,
-		   la gestione del puntatore a un eventuale figlio del figlio destro del nodo, la gestione del caso in cui il nodo passato come parametro sia la radice dell'albero
-		   e la modifica dei puntatori dei nodi coinvolti nella rotazione.
-		   Infine, la funzione restituisce un puntatore al figlio sinistro del nodo passato come parametro. */
-		pointer*	rotateLeft(pointer & node)
+		/* Inserimento con suggerimento, 'hint' è il nodo davanti al quale il valore dovrebbe finire
+		   (vedi insertHintFrom). Restituisce il nodo inserito o quello già presente. */
+		pointer	insertHint(pointer hint, value_type const & val)
 		{
-			pointer		toHandle;
-			pointer*	tmp = &node;
-			pointer*	ret;
+			return (insertHintFrom(hint, val));
+		}
 
-			if ((*tmp)->child[RIGHT]->child[LEFT] != _sentinel)
-				toHandle = (*tmp)->child[RIGHT]->child[LEFT];
-			else
-				toHandle = NULL;
-			if ((*tmp) == _root)
+		/* Operazioni in blocco tra due alberi, costruite su split e join (vedi splitSubtree e joinSubtrees):
+		   invece di inserire o cercare un elemento alla volta si divide un albero attorno alle chiavi dell'altro
+		   e si riattaccano i pezzi. Con m la dimensione dell'albero più piccolo e n quella del più grande
+		   il costo è O(m log(n/m + 1)): O(log n) per un solo elemento, lineare per due alberi della stessa
+		   dimensione, come una fusione di due sequenze ordinate.
+		   I nodi però appartengono al pool del loro albero, che li restituisce all'allocatore a chunk interi,
+		   e le loro foglie puntano al sentinella del loro albero. Quando dei nodi cambiano albero:
+		   - mergeFrom e joinWith prendono tutti i chunk dell'albero più piccolo (vedi NodePool::splice) e ne
+		     riscrivono le foglie, O(m); nessun nodo viene copiato o riallocato;
+		   - splitAt sposta i valori della parte più piccola nel pool dell'altro albero (vedi relocate_value).
+
+		   Sposta in questo albero gli elementi di 'other' con chiavi che qui mancano; gli altri restano in 'other',
+		   come std::map::merge. Se gli allocatori sono diversi i chunk non possono cambiare pool e gli elementi
+		   vengono spostati uno alla volta, O(m log n). Gli elementi lasciati in 'other' tornano nel suo pool:
+		   se il loro spostamento lancia un'eccezione quelli non ancora spostati vengono distrutti. */
+		void	mergeFrom(RBTree & other)
+		{
+			if (this == &other || !other._size)
+				return ;
+			if (!(_alloc == other._alloc))
 			{
-				_root = (*tmp)->child[RIGHT];
-				_sentinel->parent = _root;
-				(*tmp)->child[RIGHT]->parent = _sentinel;
+				mergeOneByOne(other);
+				return ;
 			}
-			else
-			{
-				(*tmp)->child[RIGHT]->parent = (*tmp)->parent;
-				if ((*tmp)->parent->child[RIGHT] == *tmp)
-					(*tmp)->parent->child[RIGHT] = (*tmp)->child[RIGHT];
-				else
-					(*tmp)->parent->child[LEFT] = (*tmp)->child[RIGHT];
-			}
-			(*tmp)->parent = (*tmp)->child[RIGHT];
-			(*tmp)->child[RIGHT]->child[LEFT] = (*tmp);
-			(*tmp)->child[RIGHT] = _sentinel;
-			if (toHandle)
-				insertNode((*tmp)->parent, toHandle, (*tmp)->parent, 0);
-			ret = &(*tmp)->child[LEFT];
-			return (ret);
+
+			bool	swapped = other._size > _size;
+
+			if (swapped)
+				swapNodes(other);
+
+			NodeList	rejects(_sentinel);
+			Subtree		small = adoptTree(other);
+			Subtree		big = takeRoot();
+
+			setRoot(uniteSubtrees(big, small, swapped, rejects));
+			other.relocateList(rejects, *this);
 		}
 
-		pointer*	rotateRight(pointer & node)
+		/* Sposta in 'right' (che viene prima svuotato) gli elementi con chiave non minore di 'key'.
+		   La divisione costa O(log n); poi i valori della parte più piccola vengono spostati nel pool
+		   dell'altro albero, O(min(k, n - k)) per k elementi spostati. Se uno spostamento lancia un'eccezione
+		   gli elementi non ancora spostati di quella parte vengono distrutti. */
+		template <class K>
+		void	splitAt(K const & key, RBTree & right)
 		{
-			pointer		toHandle;
-			pointer*	tmp = &node;
-			pointer*	ret;
+			Subtree		low;
+			Subtree		high;
+			pointer		found;
+			NodeList	moving(_sentinel);
 
-			if ((*tmp) && (*tmp)->child[LEFT] != _sentinel && (*tmp)->child[LEFT]->child[RIGHT] != _sentinel)
-				toHandle = (*tmp)->child[LEFT]->child[RIGHT];
-			else
-				toHandle = NULL;
-			if ((*tmp) == _root)
+			if (this == &right)
+				return ;
+			right.clear();
+			splitSubtree(takeRoot(), key, low, found, high);
+			if (found != _sentinel)
+				high = joinSubtrees(Subtree(_sentinel, 0), found, high);
+			if (high.root->count <= low.root->count)
 			{
-				_root = (*tmp)->child[LEFT];
-				_sentinel->parent = _root;
-				(*tmp)->child[LEFT]->parent = _sentinel;
+				setRoot(low);
+				flatten(high.root, moving);
+				right.relocateList(moving, *this);
+				return ;
 			}
-			else
-			{
-				(*tmp)->child[LEFT]->parent = (*tmp)->parent;
-				if ((*tmp)->parent->child[RIGHT] == *tmp)
-					(*tmp)->parent->child[RIGHT] = (*tmp)->child[LEFT];
-				else
-					(*tmp)->parent->child[LEFT] = (*tmp)->child[LEFT];
-			}
-			(*tmp)->parent = (*tmp)->child[LEFT];
-			(*tmp)->child[LEFT]->child[RIGHT] = (*tmp);
-			(*tmp)->child[LEFT] = _sentinel;
-			if (toHandle)
-				insertNode((*tmp), toHandle, (*tmp), 0);
-			ret = &(*tmp)->child[RIGHT];
-			return (ret);
+			setRoot(high);
+			flatten(low.root, moving);
+			swapNodes(right);
+			relocateList(moving, right);
 		}
 
-		/* Questo è un algoritmo per bilanciare un albero rosso-nero dopo la cancellazione di un nodo.
-		   L'obiettivo è quello di mantenere le proprietà dell'albero rosso-nero, in particolare quella di avere un'altezza logaritmica,
-		   ovvero proporzionale al logaritmo del numero di nodi presenti nell'albero.
-		   L'algoritmo controlla se la cancellazione ha rotto le proprietà dell'albero e, se necessario, applica alcune rotazioni e/o ricolorazioni dei nodi per ripristinarle.
-		   L'algoritmo scorre l'albero dalla radice fino al nodo cancellato, controllando di volta in volta le proprietà dell'albero per bilanciarlo correttamente.
-		   L'implementazione usa una serie di controlli per determinare quale operazione applicare a seconda della configurazione dei nodi circostanti. */
-		void	balanceDelete(pointer & node)
+		/* Accoda gli elementi di 'right', che resta vuoto: tutte le sue chiavi devono essere maggiori
+		   di quelle di questo albero, altrimenti (o se gli allocatori sono diversi) diventa una mergeFrom.
+		   Un solo join, O(log n), più la riscrittura delle foglie dell'albero più piccolo. */
+		void	joinWith(RBTree & right)
 		{
-			pointer*	tmp = &node;
-			pointer		sibling;
-			pointer		leftNephew;
-			pointer		rightNephew;
-
-			while ((*tmp) != _root && (*tmp)->color == BLACK)
+			if (this == &right || !right._size)
+				return ;
+			if (!(_alloc == right._alloc) || (_size && !_c(KeyOfValue()(max()->data), KeyOfValue()(right.min()->data))))
 			{
-				getRelatives2((*tmp), sibling, leftNephew, rightNephew);
-				if ((*tmp) == (*tmp)->parent->child[LEFT])
-				{
-					if (sibling && sibling->color == RED)
-					{
-						(*tmp)->parent->color = RED;
-						sibling->color = BLACK;
-						tmp = rotateLeft((*tmp)->parent);
-					}
-					else
-					{
-						if (leftNephew && leftNephew->color == BLACK && rightNephew && rightNephew->color == BLACK)
-						{
-							sibling->color = RED;
-							tmp = &(*tmp)->parent;
-						}
-						else if (leftNephew && leftNephew->color == RED && rightNephew && rightNephew->color == BLACK)
-						{
-							leftNephew->color = BLACK;
-							sibling->color = RED;
-							tmp = rotateRight(sibling);
-						}
-						else if (rightNephew && rightNephew->color == RED)
-						{
-							sibling->color = (*tmp)->parent->color;
-							(*tmp)->parent->color = BLACK;
-							rightNephew->color = BLACK;
-							rotateLeft((*tmp)->parent);
-							break ;
-						}
-						else if (oneChild(*tmp) && oneChild(*tmp)->color == RED)
-						{
-							oneChild(*tmp)->color = BLACK;
-							break ;
-						}
-						else if (sibling && sibling->color == BLACK && (*tmp)->color == BLACK)
-						{
-							sibling->color = RED;
-							(*tmp)->parent->color = BLACK;
-							tmp = &(*tmp)->parent;
-							break ;
-						}
-						else
-							tmp = &(*tmp)->parent;
-					}
-				}
-				else
-				{
-					if (sibling && sibling->color == RED)
-					{
-						(*tmp)->parent->color = RED;
-						sibling->color = BLACK;
-						tmp = rotateRight((*tmp)->parent);
-					}
-					else
-					{
-						if (rightNephew && rightNephew->color == BLACK && leftNephew&& leftNephew->color == BLACK)
-						{
-							sibling->color = RED;
-							tmp = &(*tmp)->parent;
-						}
-						else if (rightNephew && rightNephew->color == RED && leftNephew && leftNephew->color == BLACK)
-						{
-							rightNephew->color = BLACK;
-							sibling->color = RED;
-							tmp = rotateLeft(sibling);
-						}
-						else if (leftNephew && leftNephew->color == RED)
-						{
-							sibling->color = (*tmp)->parent->color;
-							(*tmp)->parent->color = BLACK;
-							leftNephew->color = BLACK;
-							rotateRight((*tmp)->parent);
-							break ;
-						}
-						else if (oneChild(*tmp)->color == RED)
-						{
-							oneChild(*tmp)->color = BLACK;
-							break ;
-						}
-						else if (sibling && sibling->color == BLACK && (*tmp)->color == BLACK)
-						{
-							sibling->color = RED;
-							(*tmp)->parent->color = BLACK;
-							tmp = &(*tmp)->parent;
-							break ;
-						}
-						else
-							tmp = &(*tmp)->parent;
-					}
-				}
+				mergeFrom(right);
+				return ;
 			}
+
+			bool	swapped = right._size > _size;
+			Subtree	small;
+			Subtree	big;
+
+			if (swapped)
+				swapNodes(right);
+			small = adoptTree(right);
+			big = takeRoot();
+			setRoot(swapped ? joinSubtrees(small, big) : joinSubtrees(big, small));
 		}
 
-		/* Questa è una funzione che prende tre puntatori a nodi di un albero rosso-nero: il puntatore al nodo padre, al nodo nonno e allo zio del nodo padre (il fratello del nonno).
-		   La funzione determina il nonno e lo zio del nodo padre, a partire dal puntatore del padre passato come parametro.
-		   Se il padre è il nodo radice, il nonno sarà NULL (o sentinella) e lo zio sarà NULL. Se il padre ha un nonno e il padre è figlio sinistro del nonno,
-		   lo zio sarà il figlio destro del nonno. Altrimenti, se il padre è figlio destro del nonno,
-		   lo zio sarà il figlio sinistro del nonno. Se il nonno o il figlio destro/sinistro del nonno non esistono, lo zio sarà NULL. */
-		void	getRelatives(pointer & parent, pointer & grandParent, pointer & uncle)
+		/* Aggiunge una copia degli elementi di 'other' con chiavi che qui mancano: 'other' viene copiato
+		   (O(m), e se una copia lancia un'eccezione questo albero non cambia) e la copia viene fusa con mergeFrom. */
+		void	uniteWith(RBTree const & other)
 		{
-			if (parent != _sentinel)
-				grandParent = parent->parent;
-			else
-				grandParent = NULL;
-			if (grandParent != _sentinel && grandParent)
-			{
-				if (grandParent->child[LEFT] == parent && grandParent->child[RIGHT] != _sentinel)
-					uncle = grandParent->child[RIGHT];
-				else if (grandParent->child[RIGHT] == parent && grandParent->child[LEFT] != _sentinel)
-					uncle = grandParent->child[LEFT];
-				else
-					uncle = NULL;
-			}
-			else
-				uncle = NULL;
-		}
-
-		/* Questa funzione verifica se un nodo ha uno zio (cioè un fratello del genitore del nodo) nel suo albero rosso-nero.
-		   Restituisce 1 se il nodo ha uno zio, altrimenti restituisce 0.
-		   Il modo in cui la funzione verifica la presenza di uno zio è controllando se il nodo ha un genitore non radice (_sentinel)
-		   e se il genitore ha due figli (cioè se il fratello del nodo non è _sentinel).
-		   Se il nodo è il figlio sinistro del genitore, la funzione controlla se il fratello del nodo è il figlio destro del genitore, e viceversa.
-		   Se il nodo ha un genitore ma il genitore non ha due figli, il nodo non ha uno zio. */
-		int	hasUncle(pointer & node)
-		{
-			if (node->parent == _sentinel)
-				return (0);
-			if (node->parent->child[LEFT] != _sentinel && node->parent->child[LEFT] == node && node->parent->child[RIGHT] != _sentinel)
-				return (1);
-			if (node->parent->child[RIGHT] != _sentinel && node->parent->child[RIGHT] == node && node->parent->child[LEFT] != _sentinel)
-				return (1);
-			return (0);
-		}
-
-		/* Questa funzione restituisce un puntatore all'uncle del nodo passato come parametro.
-		   Se il nodo non ha uno zio, la funzione restituirà un puntatore all'elemento sentinella (o a NULL se l'elemento sentinella non viene utilizzato).
-		   La funzione assume che il nodo abbia un genitore non nullo (altrimenti non avrebbe senso cercare lo zio), quindi non controlla questa condizione.
-		   Inoltre, la funzione non controlla se lo zio esiste effettivamente, quindi se il genitore del nodo non ha un figlio a sinistra o a destra,
-		   la funzione restituirà un puntatore non valido. */
-		pointer&	getUncle(pointer & node)
-		{
-			if (node->parent->child[LEFT] == node)
-				return (node->parent->child[RIGHT]);
-			return (node->parent->child[LEFT]);
-		}
-
-		/* Questa funzione è utilizzata per mantenere la proprietà dell'albero rosso-nero (red-black tree) dopo l'inserimento di un nuovo nodo.
-		   La funzione prende in input un puntatore a un nodo dell'albero e, utilizzando diverse operazioni di rotazione,
-		   aggiorna i colori dei nodi dell'albero per mantenere le proprietà dell'albero rosso-nero.
-		   La funzione inizia ottenendo i puntatori del padre, del nonno e dello zio del nodo da inserire utilizzando la funzione getRelatives.
-		   In seguito, controlla se il nodo da inserire è la radice dell'albero e, in tal caso, lo colora di nero e termina l'esecuzione della funzione.
-		   Se il padre del nodo da inserire è già nero, allora l'albero soddisfa già la proprietà dell'albero rosso-nero e la funzione termina.
-		   Se il padre del nodo da inserire è rosso, allora potrebbe essere necessario eseguire delle rotazioni per mantenere le proprietà dell'albero rosso-nero.
-		   In particolare, se lo zio del nodo da inserire è rosso, allora viene eseguita una serie di operazioni di colorazione per mantenere la proprietà dell'albero.
-		   Se lo zio è nero, invece, vengono eseguite delle rotazioni dell'albero a seconda della posizione del nodo rispetto al padre e al nonno.
-		   In questo caso, vengono eseguite delle rotazioni sinistra e destra per mantenere l'albero bilanciato. Se le rotazioni non sono necessarie, la funzione termina. */
-		void	balanceInsert(pointer & node)
-		{
-			pointer*	tmp = &node;
-			pointer		parent = node->parent;
-			pointer		grandParent;
-			pointer		uncle;
-
-			while (*tmp && *tmp != _sentinel)
-			{
-				parent = (*tmp)->parent;
-				getRelatives(parent, grandParent, uncle);
-				if (!parent || parent == _sentinel)
-				{
-					(*tmp)->color = BLACK;
-					break ;
-				}
-				else if (parent->color == BLACK)
-					break ;
-				else if (uncle && (*tmp)->color == RED && parent->color == RED && uncle->color == RED)
-				{
-					parent->color = BLACK;
-					uncle->color = BLACK;
-					grandParent->color = RED;
-					tmp = &(*tmp)->parent->parent;
-				}
-				else if ((*tmp)->color == RED && parent->color == RED)
-				{
-					if (parent->child[RIGHT] == (*tmp) && grandParent->child[LEFT] == parent)
-						tmp = rotateLeft(parent);
-					else if (parent->child[LEFT] == (*tmp) && grandParent->child[RIGHT] == parent)
-						tmp = rotateRight(parent);
-					else if (parent->child[LEFT] == (*tmp) && grandParent->child[LEFT] == parent)
-					{
-						parent->color = BLACK;
-						grandParent->color = RED;
-						rotateRight(grandParent);
-						break ;
-					}
-					else if (parent->child[RIGHT] == (*tmp) && grandParent->child[RIGHT] == parent)
-					{
-						parent->color = BLACK;
-						grandParent->color = RED;
-						rotateLeft(grandParent);
-						break ;
-					}
-				}
-				else
-					break ;
-			}
+			if (this == &other || !other._size)
+				return ;
+
+			RBTree	copy(other);
+
+			mergeFrom(copy);
 		}
 
-		/* Questa funzione prende in input un puntatore a un nodo dell'albero rosso-nero e restituisce tre puntatori:
-		   uno al sibling (il fratello del nodo), e due ai nipoti sinistro e destro del sibling.
-		   La funzione verifica prima se il nodo ha un sibling e, in caso affermativo, restituisce il puntatore ad esso.
-		   Successivamente, controlla se il sibling ha dei nipoti e, se sì, restituisce i puntatori a questi ultimi. Se il sibling non ha nipoti,
-		   i puntatori a sinistra e destra dei nipoti saranno entrambi NULL. Se il nodo non ha un sibling, tutti e tre i puntatori saranno NULL. */
-		void	getRelatives2(pointer & node, pointer & sibling, pointer & leftNephew, pointer & rightNephew)
+		/* Tiene solo gli elementi con una chiave presente anche in 'other', che non viene modificato.
+		   Nessun nodo viene allocato o spostato: gli elementi scartati vengono distrutti. */
+		void	intersectWith(RBTree const & other)
 		{
-			if (node->parent->child[LEFT] != _sentinel && node->parent->color != SENTINEL && node->parent->child[LEFT] == node && node->parent->child[RIGHT] && node->parent->child[RIGHT] != _sentinel)
-				sibling = node->parent->child[RIGHT];
-			else if (node->parent->child[RIGHT] != _sentinel && node->parent->color != SENTINEL && node->parent->child[LEFT] && node->parent->child[LEFT] != _sentinel)
-				sibling = node->parent->child[LEFT];
-			else
+			if (this == &other)
+				return ;
+			setRoot(intersectSubtree(takeRoot(), other, other._root));
+		}
+
+		/* Toglie gli elementi con una chiave presente in 'other', che non viene modificato. */
+		void	subtractWith(RBTree const & other)
+		{
+			if (this == &other)
 			{
-				sibling = NULL;
-				leftNephew = NULL;
-				rightNephew = NULL;
+				clear();
 				return ;
 			}
-			if (sibling && sibling->child[LEFT] && sibling->child[LEFT] != _sentinel)
-				leftNephew = sibling->child[LEFT];
-			else
-				leftNephew = NULL;
-			if (sibling && sibling->child[RIGHT] && sibling->child[RIGHT] != _sentinel)
-				rightNephew = sibling->child[RIGHT];
-			else
-				rightNephew = NULL;
+			setRoot(subtractSubtree(takeRoot(), other, other._root));
 		}
 
-		/* Questa funzione getSibling prende in input un puntatore a un nodo e restituisce il puntatore al sibling di quel nodo.
-		   Inizialmente controlla se il nodo ha un parent valido (non il sentinel) e poi controlla se il nodo è il child destro o sinistro del suo parent.
-		   Se il nodo è il child sinistro, restituisce il sibling destro e viceversa. Se il nodo non ha un sibling (ad esempio, se è l'unico child del parent), restituisce NULL. */
-		pointer	getSibling(pointer & node)
+		/* Inserimento con la fine come suggerimento, con chiavi univoche o ripetute secondo 'Unique'. */
+		pointer	insertAtEnd(value_type const & val)
 		{
-			if (node->parent == _sentinel)
-				return (NULL);
-			if (node->parent->child[LEFT] != _sentinel && node->parent->child[LEFT] == node)
-				return (node->parent->child[RIGHT]);
-			else if (node->parent->child[RIGHT] != _sentinel && node->parent->child[RIGHT] == node)
-				return (node->parent->child[LEFT]);
-			return (NULL);
+			if (Unique)
+				return (insertHint(_sentinel, val));
+			return (insertEqualHint(_sentinel, val));
 		}
 
-		/* La funzione oneChild prende in input un puntatore ad un nodo dell'albero e restituisce un riferimento al figlio non sentinella del nodo che ha esattamente un figlio, se esiste.
-		   In caso contrario, restituisce un riferimento al puntatore sentinella dell'albero.
-		   La funzione controlla se il figlio sinistro o il figlio destro del nodo sono sentinelle e restituisce il riferimento al figlio non sentinella.
-		   Se entrambi i figli sono sentinelle, la funzione restituisce il riferimento al puntatore sentinella dell'albero. */
-		pointer&	oneChild(pointer& node)
+		/* Come insertUnique, insertHint, insertEqual e insertEqualHint, ma il valore viene spostato nel nodo
+		   invece che copiato (vedi adoptNode): servono a reinserire il valore di una node handle e a mergeFrom. */
+		ft::pair<pointer, bool>	insertUniqueAdopt(value_type & val)
 		{
-			if (node->child[LEFT] != _sentinel && node->child[RIGHT] == _sentinel)
-				return (node->child[LEFT]);
-			else if (node->child[RIGHT] != _sentinel && node->child[LEFT] == _sentinel)
-				return (node->child[RIGHT]);
-			return (_sentinel);
+			return (insertUniqueFrom(val));
 		}
 
-		/* Questa funzione "link" è utilizzata per collegare un nodo "node" come figlio di un altro nodo "parent", sostituendo il figlio precedente "oldSon".
-		   La funzione prende tre puntatori: "parent", "oldSon" e "node".
-		   "parent" è il nodo padre del nodo che deve essere sostituito, "oldSon" è il nodo che deve essere sostituito con "node",
-		   e "node" è il nuovo nodo che deve essere collegato come figlio del "parent".
-		   Se "parent" è il nodo sentinella, significa che il vecchio figlio "oldSon" era la radice dell'albero. In questo caso, il padre del "parent" deve essere impostato su "node".
-		   Altrimenti, se il vecchio figlio "oldSon" si trova a sinistra di "parent", il figlio sinistro di "parent" deve essere impostato su "node".
-		   Altrimenti, se "oldSon" si trova a destra di "parent", il figlio destro di "parent" deve essere impostato su "node".
-		   Infine, se "node" non è il nodo sentinella, il padre del "node" deve essere impostato su "parent". */
-		void	link(pointer& parent, pointer& oldSon, pointer& node)
+		pointer	insertHintAdopt(pointer hint, value_type & val)
 		{
-			if (parent == _sentinel)
-				parent->parent = node;
-			else if (parent->child[LEFT] == oldSon)
+			return (insertHintFrom(hint, val));
+		}
+
+		pointer	insertEqualAdopt(value_type & val)
+		{
+			return (insertEqualFrom(val, false));
+		}
+
+		pointer	insertEqualHintAdopt(pointer hint, value_type & val)
+		{
+			return (insertEqualHintFrom(hint, val));
+		}
+
+		/* Inserimento con chiave univoca in una sola discesa radice-foglia.
+		   Durante la discesa si fa un solo confronto per livello e si ricorda l'ultimo nodo visitato:
+		   alla fine il possibile duplicato è l'ultimo nodo da cui si è andati a destra, cioè il padre
+		   se si scende a destra, altrimenti il suo predecessore. Basta quindi un confronto in più per
+		   sapere se la chiave è già presente, senza una seconda ricerca. Il nodo viene allocato solo
+		   se la chiave manca. Restituisce il nodo (nuovo o già esistente) e true se è stato inserito. */
+		template <class Source>
+		ft::pair<pointer, bool>	insertUniqueFrom(Source & val)
+		{
+			pointer	parent = _sentinel;
+			pointer	node = _root;
+			bool	goLeft = true;
+
+			while (node != _sentinel)
+			{
+				parent = node;
+				goLeft = _c(KeyOfValue()(val), KeyOfValue()(node->data));
+				node = node->child[goLeft ? LEFT : RIGHT];
+			}
+			node = parent;
+			if (goLeft)
+				node = (parent == _sentinel || parent == min()) ? _sentinel : getPredecessor(parent);
+			if (node != _sentinel && !_c(KeyOfValue()(node->data), KeyOfValue()(val)))
+				return (ft::make_pair(node, false));
+			return (ft::make_pair(insertLeaf(parent, goLeft ? LEFT : RIGHT, makeNode(val)), true));
+		}
+
+		/* Inserimento con suggerimento: 'hint' è il nodo davanti al quale il valore dovrebbe finire (il sentinella
+		   per la fine). Se la chiave cade tra il predecessore di 'hint' e 'hint' stesso, il nodo viene agganciato
+		   direttamente come figlio destro del predecessore o sinistro di 'hint' (uno dei due è sempre libero),
+		   senza scendere dalla radice; lo stesso vale se la chiave cade subito dopo 'hint'.
+		   Se il suggerimento è sbagliato si ripiega su insertUniqueFrom. Restituisce il nodo inserito o quello già presente. */
+		template <class Source>
+		pointer	insertHintFrom(pointer hint, Source & val)
+		{
+			if (hint == _sentinel || _c(KeyOfValue()(val), KeyOfValue()(hint->data)))
+			{
+				pointer	before = (hint == min()) ? _sentinel : getPredecessor(hint);
+
+				if (before == _sentinel)
+					return (insertLeaf(hint, LEFT, makeNode(val)));
+				if (_c(KeyOfValue()(before->data), KeyOfValue()(val)))
+				{
+					if (before->child[RIGHT] == _sentinel)
+						return (insertLeaf(before, RIGHT, makeNode(val)));
+					return (insertLeaf(hint, LEFT, makeNode(val)));
+				}
+			}
+			else if (_c(KeyOfValue()(hint->data), KeyOfValue()(val)))
+			{
+				pointer	after = (hint == max()) ? _sentinel : getSuccessor(hint);
+
+				if (after == _sentinel || _c(KeyOfValue()(val), KeyOfValue()(after->data)))
+				{
+					if (hint->child[RIGHT] == _sentinel)
+						return (insertLeaf(hint, RIGHT, makeNode(val)));
+					return (insertLeaf(after, LEFT, makeNode(val)));
+				}
+			}
+			else
+				return (hint);
+			return (insertUniqueFrom(val).first);
+		}
+
+		/* Inserimento con chiavi ripetute: il nodo va dopo tutti quelli con chiave equivalente (la discesa va
+		   a destra a parità di chiave), quindi gli elementi uguali restano nell'ordine in cui sono stati inseriti.
+		   Con 'lower' va invece prima di tutti gli equivalenti. Una sola discesa, nessun confronto in più. */
+		template <class Source>
+		pointer	insertEqualFrom(Source & val, bool lower)
+		{
+			pointer	parent = _sentinel;
+			pointer	node = _root;
+			bool	goLeft = true;
+
+			while (node != _sentinel)
+			{
+				parent = node;
+				if (lower)
+					goLeft = !_c(KeyOfValue()(node->data), KeyOfValue()(val));
+				else
+					goLeft = _c(KeyOfValue()(val), KeyOfValue()(node->data));
+				node = node->child[goLeft ? LEFT : RIGHT];
+			}
+			return (insertLeaf(parent, goLeft ? LEFT : RIGHT, makeNode(val)));
+		}
+
+		/* Inserimento con chiavi ripetute e suggerimento, con le stesse scelte di std::multimap (libstdc++):
+		   il valore va subito prima di 'hint' se ci sta, cioè se non è maggiore di 'hint' e non è minore del suo
+		   predecessore; con end() come suggerimento va in coda se non è minore del massimo. Se invece è maggiore
+		   di 'hint' va subito dopo, se non è maggiore del successore. Altrimenti si ripiega su insertEqual:
+		   dopo gli equivalenti se il valore non superava 'hint', prima se lo superava. */
+		template <class Source>
+		pointer	insertEqualHintFrom(pointer hint, Source & val)
+		{
+			if (hint == _sentinel)
+			{
+				if (_size && !_c(KeyOfValue()(val), KeyOfValue()(max()->data)))
+					return (insertLeaf(max(), RIGHT, makeNode(val)));
+				return (insertEqualFrom(val, false));
+			}
+			if (!_c(KeyOfValue()(hint->data), KeyOfValue()(val)))
+			{
+				if (hint == min())
+					return (insertLeaf(hint, LEFT, makeNode(val)));
+
+				pointer	before = getPredecessor(hint);
+
+				if (!_c(KeyOfValue()(val), KeyOfValue()(before->data)))
+				{
+					if (before->child[RIGHT] == _sentinel)
+						return (insertLeaf(before, RIGHT, makeNode(val)));
+					return (insertLeaf(hint, LEFT, makeNode(val)));
+				}
+				return (insertEqualFrom(val, false));
+			}
+			if (hint == max())
+				return (insertLeaf(hint, RIGHT, makeNode(val)));
+
+			pointer	after = getSuccessor(hint);
+
+			if (!_c(KeyOfValue()(after->data), KeyOfValue()(val)))
+			{
+				if (hint->child[RIGHT] == _sentinel)
+					return (insertLeaf(hint, RIGHT, makeNode(val)));
+				return (insertLeaf(after, LEFT, makeNode(val)));
+			}
+			return (insertEqualFrom(val, true));
+		}
+
+		/* Prende un nodo dal pool e ci costruisce dentro una copia di 'val' (vedi initLinks per i collegamenti).
+		   Se la copia del valore lancia un'eccezione
+		   lo slot torna al pool e l'eccezione viene propagata. */
+		pointer	createNode(value_type const & val)
+		{
+			pointer	node = _pool.allocate();
+
+			try
+			{
+				::new (static_cast<void*>(node)) NodeType(val);
+			}
+			catch (...)
+			{
+				_pool.deallocate(node);
+				throw ;
+			}
+			return (initLinks(node));
+		}
+
+		/* Come createNode, ma il valore viene spostato da 'val' (vedi relocate_value), che alla fine non
+		   esiste più: serve a reinserire il valore di una node handle. Se lo spostamento lancia
+		   un'eccezione lo slot torna al pool e 'val' resta intatto. */
+		pointer	adoptNode(value_type & val)
+		{
+			pointer	node = _pool.allocate();
+
+			try
+			{
+				relocate_value(&node->data, val);
+			}
+			catch (...)
+			{
+				_pool.deallocate(node);
+				throw ;
+			}
+			return (initLinks(node));
+		}
+
+		/* Le versioni From creano il nodo secondo il tipo del valore: un valore const viene copiato,
+		   gli altri (il buffer di una node handle, un nodo di un altro albero) vengono spostati. */
+		pointer	makeNode(value_type const & val)
+		{
+			return (createNode(val));
+		}
+
+		pointer	makeNode(value_type & val)
+		{
+			return (adoptNode(val));
+		}
+
+		/* Il nodo nasce rosso e scollegato (padre e figli puntano al sentinella). */
+		pointer	initLinks(pointer node)
+		{
+			node->color = RED;
+			node->count = 1;
+			node->parent = _sentinel;
+			node->child[LEFT] = _sentinel;
+			node->child[RIGHT] = _sentinel;
+			return (node);
+		}
+
+		/* Distrugge il valore contenuto nel nodo e restituisce il nodo al pool. */
+		void	destroyNode(pointer node)
+		{
+			_alloc.destroy(node);
+			_pool.deallocate(node);
+		}
+
+		/* Distrugge i valori di un sottoalbero. I nodi non vengono restituiti uno per uno: il chiamante
+		   libera l'intero pool subito dopo. */
+		void	destroySubtree(pointer node)
+		{
+			while (node != _sentinel)
+			{
+				pointer	left = node->child[LEFT];
+
+				destroySubtree(node->child[RIGHT]);
+				_alloc.destroy(node);
+				node = left;
+			}
+		}
+
+		/* Versioni delle discese che partono da un sottoalbero qualsiasi, con 'bound' come miglior candidato
+		   già trovato più in alto (il sentinella se non ce n'è ancora uno). */
+		template <class K>
+		pointer	lowerBound(pointer node, pointer bound, K const & key) const
+		{
+			while (node != _sentinel)
+			{
+				if (!_c(KeyOfValue()(node->data), key))
+				{
+					bound = node;
+					node = node->child[LEFT];
+				}
+				else
+					node = node->child[RIGHT];
+			}
+			return (bound);
+		}
+
+		template <class K>
+		pointer	upperBound(pointer node, pointer bound, K const & key) const
+		{
+			while (node != _sentinel)
+			{
+				if (_c(key, KeyOfValue()(node->data)))
+				{
+					bound = node;
+					node = node->child[LEFT];
+				}
+				else
+					node = node->child[RIGHT];
+			}
+			return (bound);
+		}
+
+		/* Copia strutturale di 'src' in questo albero, che deve essere vuoto. Il pool viene riservato per
+		   tutti i nodi in un colpo solo, poi la forma e i colori vengono riprodotti nodo per nodo (vedi cloneSubtree);
+		   minimo e massimo in cache si ritrovano scendendo lungo i due bordi. */
+		void	cloneFrom(RBTree const & src)
+		{
+			if (!src._size)
+				return ;
+			_pool.reserve(src._size);
+			_root = cloneSubtree(src._root, src._sentinel, _sentinel);
+			_sentinel->parent = _root;
+			_sentinel->child[LEFT] = RBNavigator<NodeType>::leftmost(_root);
+			_sentinel->child[RIGHT] = RBNavigator<NodeType>::rightmost(_root);
+			_size = src._size;
+		}
+
+		/* Copia il sottoalbero 'src' (che termina su 'srcSentinel') appendendolo a 'parent'.
+		   Si scende iterativamente lungo il bordo sinistro e si ricorre solo sui figli destri,
+		   quindi la profondità della ricorsione è limitata dall'altezza dell'albero.
+		   Ogni nodo viene agganciato appena creato: se una copia lancia un'eccezione, il sottoalbero
+		   parziale viene distrutto e i nodi tornano al pool prima di propagarla. */
+		pointer	cloneSubtree(pointer src, pointer srcSentinel, pointer parent)
+		{
+			pointer	top = cloneNode(src, parent);
+
+			try
+			{
+				if (src->child[RIGHT] != srcSentinel)
+					top->child[RIGHT] = cloneSubtree(src->child[RIGHT], srcSentinel, top);
+				parent = top;
+				src = src->child[LEFT];
+				while (src != srcSentinel)
+				{
+					pointer	node = cloneNode(src, parent);
+
+					parent->child[LEFT] = node;
+					if (src->child[RIGHT] != srcSentinel)
+						node->child[RIGHT] = cloneSubtree(src->child[RIGHT], srcSentinel, node);
+					parent = node;
+					src = src->child[LEFT];
+				}
+			}
+			catch (...)
+			{
+				eraseSubtree(top);
+				throw ;
+			}
+			return (top);
+		}
+
+		/* Copia il valore e il colore di 'src' in un nuovo nodo figlio di 'parent'. */
+		pointer	cloneNode(pointer src, pointer parent)
+		{
+			pointer	node = createNode(src->data);
+
+			node->color = src->color;
+			node->count = src->count;
+			node->parent = parent;
+			return (node);
+		}
+
+		/* Come destroySubtree, ma restituisce anche ogni nodo al pool. */
+		void	eraseSubtree(pointer node)
+		{
+			while (node != _sentinel)
+			{
+				pointer	left = node->child[LEFT];
+
+				eraseSubtree(node->child[RIGHT]);
+				destroyNode(node);
+				node = left;
+			}
+		}
+
+		/* Distrugge una lista di nodi collegati tramite child[RIGHT] e terminata dal sentinella. */
+		void	destroyList(pointer node)
+		{
+			while (node != _sentinel)
+			{
+				pointer	next = node->child[RIGHT];
+
+				destroyNode(node);
+				node = next;
+			}
+		}
+
+		/* Sostituisce l'albero (vuoto) con i 'count' nodi ordinati della lista 'head'. */
+		void	buildFromList(pointer head, size_type count)
+		{
+			size_type	redDepth = 0;
+
+			if (!count)
+				return ;
+			for (size_type n = count; n > 1; n >>= 1)
+				redDepth++;
+			_sentinel->child[LEFT] = head;
+			_root = buildBalanced(head, count, 0, redDepth);
+			_root->parent = _sentinel;
+			_root->color = BLACK;
+			_sentinel->parent = _root;
+			_sentinel->child[RIGHT] = RBNavigator<NodeType>::rightmost(_root);
+			_size = count;
+			debugVerify();
+		}
+
+		/* Costruisce in ordine simmetrico un sottoalbero con i prossimi 'count' nodi della lista:
+		   prima il figlio sinistro con metà dei nodi, poi il nodo corrente, poi il figlio destro.
+		   Le due metà differiscono al più di un nodo, quindi tutte le foglie stanno sugli ultimi due livelli:
+		   colorando di rosso solo i nodi dell'ultimo livello ('redDepth') ogni cammino ha lo stesso numero di nodi neri. */
+		pointer	buildBalanced(pointer & list, size_type count, size_type depth, size_type redDepth)
+		{
+			if (!count)
+				return (_sentinel);
+
+			size_type	leftCount = (count - 1) / 2;
+			pointer		left = buildBalanced(list, leftCount, depth + 1, redDepth);
+			pointer		node = list;
+
+			list = list->child[RIGHT];
+			node->child[LEFT] = left;
+			if (left != _sentinel)
+				left->parent = node;
+			node->child[RIGHT] = buildBalanced(list, count - 1 - leftCount, depth + 1, redDepth);
+			if (node->child[RIGHT] != _sentinel)
+				node->child[RIGHT]->parent = node;
+			node->color = (depth == redDepth) ? RED : BLACK;
+			node->count = count;
+			return (node);
+		}
+
+		/* Aggancia il nodo 'node' (rosso, senza figli) come figlio 'side' di 'parent', oppure come
+		   radice se 'parent' è il sentinella, e ripristina le proprietà rosso-nere.
+		   Un nodo diventa il nuovo minimo solo se viene agganciato a sinistra del minimo (simmetrico per il massimo):
+		   le rotazioni non cambiano l'ordine simmetrico, quindi la cache del sentinella resta valida. */
+		pointer	insertLeaf(pointer parent, int side, pointer node)
+		{
+			node->parent = parent;
+			if (parent == _sentinel)
+			{
+				_root = node;
+				_sentinel->parent = node;
+				_sentinel->child[LEFT] = node;
+				_sentinel->child[RIGHT] = node;
+			}
+			else
+			{
+				parent->child[side] = node;
+				if (parent == _sentinel->child[side])
+					_sentinel->child[side] = node;
+			}
+			for (pointer ancestor = parent; ancestor != _sentinel; ancestor = ancestor->parent)
+				ancestor->count++;
+			_size++;
+			balanceInsert(node);
+			debugVerify();
+			return (node);
+		}
+
+		/* Rotazione sinistra attorno a 'node': il figlio destro prende il suo posto e 'node' ne diventa
+		   il figlio sinistro; il vecchio sottoalbero sinistro del figlio passa a destra di 'node'.
+		   Vengono solo riagganciati tre puntatori, l'ordine delle chiavi non cambia.
+		   Cambiano solo i sottoalberi dei due nodi coinvolti: il pivot eredita il count di 'node',
+		   che viene ricalcolato dai suoi nuovi figli. */
+		void	rotateLeft(pointer node)
+		{
+			pointer	pivot = node->child[RIGHT];
+
+			node->child[RIGHT] = pivot->child[LEFT];
+			if (pivot->child[LEFT] != _sentinel)
+				pivot->child[LEFT]->parent = node;
+			link(node->parent, node, pivot);
+			pivot->child[LEFT] = node;
+			node->parent = pivot;
+			pivot->count = node->count;
+			node->count = node->child[LEFT]->count + node->child[RIGHT]->count + 1;
+		}
+
+		/* Simmetrica di rotateLeft. */
+		void	rotateRight(pointer node)
+		{
+			pointer	pivot = node->child[LEFT];
+
+			node->child[LEFT] = pivot->child[RIGHT];
+			if (pivot->child[RIGHT] != _sentinel)
+				pivot->child[RIGHT]->parent = node;
+			link(node->parent, node, pivot);
+			pivot->child[RIGHT] = node;
+			node->parent = pivot;
+			pivot->count = node->count;
+			node->count = node->child[LEFT]->count + node->child[RIGHT]->count + 1;
+		}
+
+		/* Ruota 'node' verso il lato 'side' (LEFT = rotazione sinistra). */
+		void	rotate(pointer node, int side)
+		{
+			if (side == LEFT)
+				rotateLeft(node);
+			else
+				rotateRight(node);
+		}
+
+		/* Ripristina le proprietà dopo l'aggancio di un nodo rosso. Finché il padre è rosso:
+		   se lo zio è rosso si ricolorano padre, zio e nonno e si risale di due livelli;
+		   altrimenti, se il nodo è un figlio "interno" lo si porta all'esterno con una rotazione sul padre,
+		   poi una rotazione sul nonno chiude il ciclo. Il sentinella non è mai rosso, quindi fa da foglia nera.
+		   Restituisce true se la radice è stata ricolorata di nero, cioè se l'altezza nera è cresciuta di uno
+		   (serve a joinSubtrees). */
+		bool	balanceInsert(pointer node)
+		{
+			bool	grew;
+
+			while (node->parent->color == RED)
+			{
+				pointer	parent = node->parent;
+				pointer	grandParent = parent->parent;
+				int		side = (parent == grandParent->child[LEFT]) ? LEFT : RIGHT;
+				pointer	uncle = grandParent->child[!side];
+
+				if (uncle->color == RED)
+				{
+					parent->color = BLACK;
+					uncle->color = BLACK;
+					grandParent->color = RED;
+					node = grandParent;
+				}
+				else
+				{
+					if (node == parent->child[!side])
+					{
+						node = parent;
+						rotate(node, side);
+						parent = node->parent;
+					}
+					parent->color = BLACK;
+					grandParent->color = RED;
+					rotate(grandParent, !side);
+				}
+			}
+			grew = (_root->color == RED);
+			_root->color = BLACK;
+			return (grew);
+		}
+
+		/* Ripristina le proprietà dopo la rimozione di un nodo nero. 'node' è il nodo che porta il "nero in più"
+		   (può essere il sentinella, per questo il padre viene passato a parte e il sentinella non viene mai modificato).
+		   Casi classici: fratello rosso (rotazione per renderlo nero), fratello nero con nipoti neri (si risale),
+		   nipote esterno nero (rotazione sul fratello), nipote esterno rosso (rotazione sul padre e fine). */
+		void	balanceDelete(pointer node, pointer parent)
+		{
+			while (node != _root && node->color != RED)
+			{
+				int		side = (node == parent->child[LEFT]) ? LEFT : RIGHT;
+				pointer	sibling = parent->child[!side];
+
+				if (sibling->color == RED)
+				{
+					sibling->color = BLACK;
+					parent->color = RED;
+					rotate(parent, side);
+					sibling = parent->child[!side];
+				}
+				if (sibling->child[LEFT]->color != RED && sibling->child[RIGHT]->color != RED)
+				{
+					sibling->color = RED;
+					node = parent;
+					parent = parent->parent;
+				}
+				else
+				{
+					if (sibling->child[!side]->color != RED)
+					{
+						sibling->child[side]->color = BLACK;
+						sibling->color = RED;
+						rotate(sibling, !side);
+						sibling = parent->child[!side];
+					}
+					sibling->color = parent->color;
+					parent->color = BLACK;
+					sibling->child[!side]->color = BLACK;
+					rotate(parent, side);
+					node = _root;
+				}
+			}
+			if (node != _sentinel)
+				node->color = BLACK;
+		}
+
+		/* Sostituisce il figlio 'oldSon' di 'parent' con 'node'. Se 'parent' è il sentinella 'oldSon' era
+		   la radice, quindi 'node' diventa la nuova radice. Il padre del sentinella non viene mai toccato
+		   se non come puntatore alla radice. */
+		void	link(pointer parent, pointer oldSon, pointer node)
+		{
+			if (parent == _sentinel)
+			{
+				_root = node;
+				_sentinel->parent = node;
+			}
+			else if (parent->child[LEFT] == oldSon)
 				parent->child[LEFT] = node;
 			else
 				parent->child[RIGHT] = node;
@@ -741,37 +1451,517 @@ namespace ft
 				node->parent = parent;
 		}
 
-		/* La funzione unlink viene utilizzata per rimuovere un nodo dall'albero binario di ricerca.
-		   Il primo parametro parent rappresenta il genitore del nodo da rimuovere, mentre il secondo parametro node rappresenta il nodo da rimuovere.
-		   Innanzitutto, la funzione verifica se il nodo da rimuovere è il figlio sinistro o destro del suo genitore. Se il nodo da rimuovere è il figlio sinistro, l
-		   a funzione assegna il valore _sentinel al puntatore del figlio sinistro del genitore.
-		   Inoltre, se il nodo da rimuovere ha un figlio sinistro ma non ha un figlio destro, la funzione assegna il figlio sinistro del nodo da rimuovere al figlio sinistro del genitore
-		   e assegna il genitore al figlio sinistro del nodo rimosso.
-		   Se il nodo da rimuovere è il figlio destro, la funzione assegna il valore _sentinel al puntatore del figlio destro del genitore.
-		   Inoltre, se il nodo da rimuovere ha un figlio destro ma non ha un figlio sinistro, la funzione assegna il figlio destro del nodo da rimuovere al figlio destro del genitore
-		   e assegna il genitore al figlio destro del nodo rimosso.
-		   Infine, la funzione assegna il valore _sentinel al puntatore del genitore del nodo rimosso per indicare che il nodo è stato rimosso dall'albero. */
-		void	unlink(pointer& parent, pointer& node)
+		/* Stacca 'node' dall'albero senza distruggerlo. Se ha al più un figlio, il figlio prende il suo posto;
+		   altrimenti al suo posto viene spostato (riagganciando i puntatori, non copiando il valore)
+		   il successore, che eredita anche il colore. Se il nodo tolto dalla sua posizione era nero
+		   si ribilancia a partire dal figlio che l'ha sostituito.
+		   Se il nodo è il minimo (o il massimo) in cache, il suo successore (o predecessore) prende il suo posto:
+		   essendo un estremo ha al più un figlio, quindi il vicino si trova in O(1).
+		   Prima di toccare i puntatori si decrementa il count di tutti i nodi sopra il punto da cui
+		   un nodo sparisce davvero (il padre di 'node', o quello del successore); il successore che prende
+		   il posto di 'node' ne eredita il count. */
+		void	unlink(pointer node)
 		{
-			if (parent->child[LEFT] == node)
+			pointer		child;
+			pointer		childParent;
+			node_color	removedColor = node->color;
+			pointer		successor = _sentinel;
+			pointer		removedFrom = node->parent;
+
+			if (node == _sentinel->child[LEFT])
+				_sentinel->child[LEFT] = getSuccessor(node);
+			if (node == _sentinel->child[RIGHT])
+				_sentinel->child[RIGHT] = getPredecessor(node);
+			if (node->child[LEFT] != _sentinel && node->child[RIGHT] != _sentinel)
 			{
-				parent->child[LEFT] = _sentinel;
-				if (node->child[LEFT] != _sentinel && node->child[RIGHT] == _sentinel)
+				successor = RBNavigator<NodeType>::leftmost(node->child[RIGHT]);
+				removedFrom = successor->parent;
+			}
+			for (; removedFrom != _sentinel; removedFrom = removedFrom->parent)
+				removedFrom->count--;
+			if (successor == _sentinel)
+			{
+				child = node->child[node->child[LEFT] == _sentinel ? RIGHT : LEFT];
+				childParent = node->parent;
+				link(node->parent, node, child);
+			}
+			else
+			{
+				removedColor = successor->color;
+				child = successor->child[RIGHT];
+				if (successor->parent == node)
+					childParent = successor;
+				else
 				{
-					parent->child[LEFT] = node->child[LEFT];
-					node->child[LEFT]->parent = parent;
+					childParent = successor->parent;
+					link(successor->parent, successor, child);
+					successor->child[RIGHT] = node->child[RIGHT];
+					successor->child[RIGHT]->parent = successor;
 				}
+				link(node->parent, node, successor);
+				successor->child[LEFT] = node->child[LEFT];
+				successor->child[LEFT]->parent = successor;
+				successor->color = node->color;
+				successor->count = node->count;
+			}
+			_size--;
+			if (removedColor == BLACK)
+				balanceDelete(child, childParent);
+			debugVerify();
+		}
+
+		/* Altezza nera dell'albero, contata lungo il bordo sinistro: O(log n). */
+		size_type	rootBlackHeight() const
+		{
+			size_type	height = 0;
+
+			for (pointer node = _root; node != _sentinel; node = node->child[LEFT])
+				if (node->color == BLACK)
+					height++;
+			return (height);
+		}
+
+		/* Stacca l'intero albero come Subtree e lascia l'albero vuoto: i nodi restano nel pool. */
+		Subtree	takeRoot()
+		{
+			Subtree	tree(_root, rootBlackHeight());
+
+			_root = _sentinel;
+			_sentinel->parent = _sentinel;
+			_sentinel->child[LEFT] = _sentinel;
+			_sentinel->child[RIGHT] = _sentinel;
+			_size = 0;
+			return (tree);
+		}
+
+		/* Fa di 'tree' l'intero albero: la dimensione è il contatore della radice, minimo e massimo in cache
+		   si ritrovano scendendo lungo i due bordi. */
+		void	setRoot(Subtree tree)
+		{
+			_root = tree.root;
+			_sentinel->parent = _root;
+			_sentinel->child[LEFT] = _sentinel;
+			_sentinel->child[RIGHT] = _sentinel;
+			_size = 0;
+			if (_root != _sentinel)
+			{
+				_root->parent = _sentinel;
+				_sentinel->child[LEFT] = RBNavigator<NodeType>::leftmost(_root);
+				_sentinel->child[RIGHT] = RBNavigator<NodeType>::rightmost(_root);
+				_size = _root->count;
+			}
+			debugVerify();
+		}
+
+		/* swap interno alle operazioni in blocco: i nodi cambiano albero, quindi con FT_INSTRUMENT anche i loro
+		   chunk cambiano sink (vedi NodePool::recordExchange). */
+		void	swapNodes(RBTree & other)
+		{
+			swap(other);
+			_pool.recordExchange(other._pool);
+		}
+
+		/* Prende l'intero albero 'other', che resta vuoto, come Subtree di questo: le sue foglie vengono
+		   riagganciate al nostro sentinella e i suoi chunk passano al nostro pool. Gli allocatori devono essere uguali. */
+		Subtree	adoptTree(RBTree & other)
+		{
+			Subtree	tree = other.takeRoot();
+
+			if (tree.root == other._sentinel)
+				return (Subtree(_sentinel, 0));
+			tree.root->parent = _sentinel;
+			relinkLeaves(tree.root, other._sentinel);
+			_pool.splice(other._pool);
+			return (tree);
+		}
+
+		void	relinkLeaves(pointer node, pointer oldSentinel)
+		{
+			for (int side = LEFT; side <= RIGHT; side++)
+			{
+				if (node->child[side] == oldSentinel)
+					node->child[side] = _sentinel;
+				else
+					relinkLeaves(node->child[side], oldSentinel);
+			}
+		}
+
+		/* Il figlio 'side' della radice (nera) di un Subtree alto 'height', come Subtree a sé: il suo
+		   sottoalbero è alto 'height' - 1, e se la sua radice è rossa diventa nera e l'altezza cresce di uno.
+		   La radice da cui si stacca non viene toccata. */
+		Subtree	detachChild(pointer root, int side, size_type height)
+		{
+			Subtree	child(root->child[side], height - 1);
+
+			if (child.root == _sentinel)
+				return (child);
+			child.root->parent = _sentinel;
+			if (child.root->color == RED)
+			{
+				child.root->color = BLACK;
+				child.blackHeight++;
+			}
+			return (child);
+		}
+
+		/* Join: unisce 'left', il nodo 'mid' e 'right', con tutte le chiavi di 'left' minori di quella di 'mid'
+		   e tutte quelle di 'right' maggiori, senza confronti. Se le due altezze nere coincidono 'mid' diventa
+		   la radice; altrimenti si scende lungo il bordo destro dell'albero più alto (sinistro se il più alto
+		   è 'right') fino al primo nodo nero con la stessa altezza nera dell'altro, 'mid' prende il suo posto
+		   (rosso, con lui e l'altro albero come figli) e balanceInsert ripara l'eventuale rosso con figlio rosso.
+		   Costa O(differenza delle altezze + 1). */
+		Subtree	joinSubtrees(Subtree left, pointer mid, Subtree right)
+		{
+			if (left.blackHeight == right.blackHeight)
+			{
+				mid->color = BLACK;
+				mid->parent = _sentinel;
+				mid->child[LEFT] = left.root;
+				mid->child[RIGHT] = right.root;
+				if (left.root != _sentinel)
+					left.root->parent = mid;
+				if (right.root != _sentinel)
+					right.root->parent = mid;
+				mid->count = left.root->count + right.root->count + 1;
+				return (Subtree(mid, left.blackHeight + 1));
+			}
+
+			int			side = (left.blackHeight > right.blackHeight) ? RIGHT : LEFT;
+			Subtree		tall = (side == RIGHT) ? left : right;
+			Subtree		other = (side == RIGHT) ? right : left;
+			pointer		parent = _sentinel;
+			pointer		node = tall.root;
+			size_type	height = tall.blackHeight;
+			size_type	added = other.root->count + 1;
+			bool		grew;
+
+			while (node->color == RED || height != other.blackHeight)
+			{
+				if (node->color == BLACK)
+					height--;
+				parent = node;
+				node = node->child[side];
+			}
+			mid->color = RED;
+			mid->parent = parent;
+			mid->child[side] = other.root;
+			mid->child[!side] = node;
+			mid->count = node->count + added;
+			parent->child[side] = mid;
+			if (other.root != _sentinel)
+				other.root->parent = mid;
+			if (node != _sentinel)
+				node->parent = mid;
+			for (; parent != _sentinel; parent = parent->parent)
+				parent->count += added;
+			_root = tall.root;
+			grew = balanceInsert(mid);
+			return (Subtree(_root, tall.blackHeight + (grew ? 1 : 0)));
+		}
+
+		/* Join senza nodo centrale: il massimo di 'left' fa da 'mid'. */
+		Subtree	joinSubtrees(Subtree left, Subtree right)
+		{
+			Subtree	rest;
+			pointer	last;
+
+			if (left.root == _sentinel)
+				return (right);
+			if (right.root == _sentinel)
+				return (left);
+			last = splitLast(left, rest);
+			return (joinSubtrees(rest, last, right));
+		}
+
+		/* Stacca il massimo di 'tree' e restituisce in 'rest' gli altri nodi: una discesa lungo il bordo destro
+		   e un join per livello risalendo, O(log n) in tutto perché ogni join costa la differenza tra le altezze. */
+		pointer	splitLast(Subtree tree, Subtree & rest)
+		{
+			pointer	root = tree.root;
+			Subtree	left = detachChild(root, LEFT, tree.blackHeight);
+			Subtree	right;
+			Subtree	shorter;
+			pointer	last;
+
+			if (root->child[RIGHT] == _sentinel)
+			{
+				rest = left;
+				return (root);
+			}
+			right = detachChild(root, RIGHT, tree.blackHeight);
+			last = splitLast(right, shorter);
+			rest = joinSubtrees(left, root, shorter);
+			return (last);
+		}
+
+		/* Split: divide 'tree' nelle chiavi minori di 'key' ('low'), il nodo con chiave equivalente ('found',
+		   il sentinella se manca) e le chiavi maggiori ('high'). Si scende verso 'key' e, risalendo, ogni radice
+		   lasciata indietro viene riattaccata con un join al lato da cui la discesa si è allontanata: O(log n). */
+		template <class K>
+		void	splitSubtree(Subtree tree, K const & key, Subtree & low, pointer & found, Subtree & high)
+		{
+			pointer	root = tree.root;
+			Subtree	left;
+			Subtree	right;
+			Subtree	part;
+
+			if (root == _sentinel)
+			{
+				low = tree;
+				high = tree;
+				found = _sentinel;
+				return ;
+			}
+			left = detachChild(root, LEFT, tree.blackHeight);
+			right = detachChild(root, RIGHT, tree.blackHeight);
+			if (_c(key, KeyOfValue()(root->data)))
+			{
+				splitSubtree(left, key, low, found, part);
+				high = joinSubtrees(part, root, right);
+			}
+			else if (_c(KeyOfValue()(root->data), key))
+			{
+				splitSubtree(right, key, part, found, high);
+				low = joinSubtrees(left, root, part);
 			}
 			else
 			{
-				parent->child[RIGHT] = _sentinel;
-				if (node->child[RIGHT] != _sentinel && node->child[LEFT] == _sentinel)
+				low = left;
+				found = root;
+				high = right;
+			}
+		}
+
+		/* Unione: si divide 'b' attorno alla radice di 'a', si uniscono ricorsivamente le due metà sinistre
+		   e le due metà destre e si riattacca tutto con la radice nel mezzo. Una chiave presente in entrambi
+		   tiene il nodo di 'a' (di 'b' con 'preferB') e l'altro finisce, in ordine, in 'rejects'. */
+		Subtree	uniteSubtrees(Subtree a, Subtree b, bool preferB, NodeList & rejects)
+		{
+			pointer	root = a.root;
+			Subtree	left;
+			Subtree	right;
+			Subtree	low;
+			Subtree	high;
+			pointer	found;
+
+			if (b.root == _sentinel)
+				return (a);
+			if (a.root == _sentinel)
+				return (b);
+			left = detachChild(root, LEFT, a.blackHeight);
+			right = detachChild(root, RIGHT, a.blackHeight);
+			splitSubtree(b, KeyOfValue()(root->data), low, found, high);
+			left = uniteSubtrees(left, low, preferB, rejects);
+			if (found != _sentinel)
+			{
+				if (preferB)
+					std::swap(root, found);
+				rejects.append(found, _sentinel);
+			}
+			right = uniteSubtrees(right, high, preferB, rejects);
+			return (joinSubtrees(left, root, right));
+		}
+
+		/* Scende in 'other' dal nodo 'node' finché la sua chiave cade fuori dall'intervallo di chiavi di 'tree':
+		   tutto 'tree' sta dallo stesso lato, quindi basta un confronto per livello, senza dividere niente.
+		   Restituisce il primo nodo con la chiave dentro l'intervallo, o il sentinella di 'other'. */
+		pointer	skipOutside(Subtree tree, RBTree const & other, pointer node) const
+		{
+			pointer	low = RBNavigator<NodeType>::leftmost(tree.root);
+			pointer	high = RBNavigator<NodeType>::rightmost(tree.root);
+
+			while (node != other._sentinel)
+			{
+				if (_c(KeyOfValue()(node->data), KeyOfValue()(low->data)))
+					node = node->child[RIGHT];
+				else if (_c(KeyOfValue()(high->data), KeyOfValue()(node->data)))
+					node = node->child[LEFT];
+				else
+					break ;
+			}
+			return (node);
+		}
+
+		/* Intersezione con il sottoalbero 'node' di 'other', che viene solo letto: si divide 'tree' attorno
+		   alla chiave di 'node' e si prosegue sui due figli. Le parti senza corrispondenza vengono distrutte.
+		   Con skipOutside un albero piccolo attraversa quello grande come una serie di ricerche, e si divide
+		   solo quando una chiave di 'other' cade tra le sue. */
+		Subtree	intersectSubtree(Subtree tree, RBTree const & other, pointer node)
+		{
+			Subtree	low;
+			Subtree	high;
+			pointer	found;
+
+			if (tree.root == _sentinel)
+				return (tree);
+			node = skipOutside(tree, other, node);
+			if (node == other._sentinel)
+			{
+				eraseSubtree(tree.root);
+				return (Subtree(_sentinel, 0));
+			}
+			if (tree.root->count <= FILTER_SIZE)
+				return (filterSubtree(tree, other, node, true));
+			splitSubtree(tree, KeyOfValue()(node->data), low, found, high);
+			low = intersectSubtree(low, other, node->child[LEFT]);
+			high = intersectSubtree(high, other, node->child[RIGHT]);
+			if (found != _sentinel)
+				return (joinSubtrees(low, found, high));
+			return (joinSubtrees(low, high));
+		}
+
+		/* Differenza: come intersectSubtree, ma si distruggono i nodi trovati e si tiene il resto. */
+		Subtree	subtractSubtree(Subtree tree, RBTree const & other, pointer node)
+		{
+			Subtree	low;
+			Subtree	high;
+			pointer	found;
+
+			if (tree.root == _sentinel)
+				return (tree);
+			node = skipOutside(tree, other, node);
+			if (node == other._sentinel)
+				return (tree);
+			if (tree.root->count <= FILTER_SIZE)
+				return (filterSubtree(tree, other, node, false));
+			splitSubtree(tree, KeyOfValue()(node->data), low, found, high);
+			low = subtractSubtree(low, other, node->child[LEFT]);
+			high = subtractSubtree(high, other, node->child[RIGHT]);
+			if (found != _sentinel)
+				destroyNode(found);
+			return (joinSubtrees(low, high));
+		}
+
+		/* Sotto questa dimensione intersectSubtree e subtractSubtree smettono di dividere: ogni split e ogni
+		   join costano qualche rotazione e un giro sui contatori, mentre per pochi nodi bastano delle ricerche. */
+		static const size_type	FILTER_SIZE = 16;
+
+		/* Cerca ogni chiave di 'tree' nel sottoalbero 'node' di 'other' (le chiavi di 'tree' fuori da quel
+		   sottoalbero non possono essere in 'other') e tiene quelle trovate se 'keepFound', le altre altrimenti.
+		   I nodi tenuti formano un nuovo albero bilanciato, gli altri vengono distrutti. */
+		Subtree	filterSubtree(Subtree tree, RBTree const & other, pointer node, bool keepFound)
+		{
+			NodeList	nodes(_sentinel);
+			NodeList	kept(_sentinel);
+			pointer		current;
+
+			flatten(tree.root, nodes);
+			current = nodes.head;
+			for (size_type left = nodes.count; left; left--)
+			{
+				pointer	next = current->child[RIGHT];
+				pointer	match = other.lowerBound(node, other._sentinel, KeyOfValue()(current->data));
+				bool	found = match != other._sentinel && !_c(KeyOfValue()(current->data), KeyOfValue()(match->data));
+
+				if (found == keepFound)
+					kept.append(current, _sentinel);
+				else
+					destroyNode(current);
+				current = next;
+			}
+			return (buildSubtree(kept));
+		}
+
+		/* Come buildFromList, ma il risultato è un Subtree staccato: con buildBalanced i livelli sopra
+		   'redDepth' sono neri, quindi l'altezza nera è 'redDepth' (uno se c'è solo la radice, che diventa nera). */
+		Subtree	buildSubtree(NodeList & list)
+		{
+			size_type	redDepth = 0;
+			pointer		head = list.head;
+			pointer		root;
+
+			if (!list.count)
+				return (Subtree(_sentinel, 0));
+			for (size_type n = list.count; n > 1; n >>= 1)
+				redDepth++;
+			root = buildBalanced(head, list.count, 0, redDepth);
+			root->parent = _sentinel;
+			if (root->color == RED)
+			{
+				root->color = BLACK;
+				return (Subtree(root, 1));
+			}
+			return (Subtree(root, redDepth));
+		}
+
+		/* Accoda in ordine i nodi del sottoalbero 'node' a 'list'. */
+		void	flatten(pointer node, NodeList & list)
+		{
+			while (node != _sentinel)
+			{
+				pointer	right = node->child[RIGHT];
+
+				flatten(node->child[LEFT], list);
+				list.append(node, _sentinel);
+				node = right;
+			}
+		}
+
+		/* Costruisce questo albero, vuoto, con i valori dei nodi di 'list', che appartengono a 'from': ogni valore
+		   viene spostato in un nodo del nostro pool (vedi adoptNode) e il vecchio slot torna al pool di 'from'.
+		   Se uno spostamento lancia un'eccezione i valori non ancora spostati vengono distrutti e l'albero
+		   tiene quelli già spostati. */
+		void	relocateList(NodeList & list, RBTree & from)
+		{
+			NodeList	moved(_sentinel);
+			pointer		node = list.head;
+			size_type	left = list.count;
+
+			try
+			{
+				for (; left; left--)
 				{
-					parent->child[RIGHT] = node->child[RIGHT];
-					node->child[RIGHT]->parent = parent;
+					pointer	next = node->child[RIGHT];
+
+					moved.append(adoptNode(node->data), _sentinel);
+					from._pool.deallocate(node);
+					node = next;
 				}
 			}
-			node->parent = _sentinel;
+			catch (...)
+			{
+				for (; left; left--)
+				{
+					pointer	next = node->child[RIGHT];
+
+					from.destroyNode(node);
+					node = next;
+				}
+				buildFromList(moved.head, moved.count);
+				throw ;
+			}
+			buildFromList(moved.head, moved.count);
+		}
+
+		/* mergeFrom con allocatori diversi: ogni valore che qui manca viene spostato in un nodo del nostro
+		   pool e il suo nodo viene staccato da 'other', come extract() seguito da insert(). */
+		void	mergeOneByOne(RBTree & other)
+		{
+			pointer	node = other.min();
+
+			while (node != other._sentinel)
+			{
+				pointer	next = (node == other.max()) ? other._sentinel : other.getSuccessor(node);
+
+				if (insertUniqueAdopt(node->data).second)
+				{
+					other.unlink(node);
+					other._pool.deallocate(node);
+				}
+				node = next;
+			}
+		}
+
+		/* Con FT_RBTREE_DEBUG ogni inserimento, rimozione e costruzione in blocco verifica l'intero albero
+		   (O(n) per operazione) e lancia std::logic_error alla prima invariante violata. */
+		void	debugVerify() const
+		{
+#ifdef FT_RBTREE_DEBUG
+			char const *	error = verify();
+
+			if (error)
+				throw std::logic_error(std::string("ft::RBTree: ") + error);
+#endif
 		}
 	};
 }
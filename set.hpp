@@ -8,7 +8,7 @@
 namespace ft
 {
 	template <class Key, class Compare = std::less<Key>, class Alloc = std::allocator<Key> >
-	class set : public RBTree<Key, Node<Key>, RBIteratorConst<Key, Compare, Node<Key> >, RBIteratorConst<const Key, Compare, Node<Key> >, Compare, Alloc>
+	class set : public RBTree<Key, Node<Key>, RBIteratorConst<Key, Compare, Node<Key> >, RBIteratorConst<const Key, Compare, Node<Key> >, identity<Key>, Compare, Alloc>
 	{
 		public:
 			typedef Key														key_type;
@@ -22,6 +22,8 @@ namespace ft
 			typedef typename allocator_type::size_type						size_type;
 			typedef RBIteratorConst<Key, Compare, Node<Key> >				iterator;
 			typedef RBIteratorConst<const Key, Compare, Node<Key> >			const_iterator;
+			typedef RBTree<Key, Node<Key>, iterator, const_iterator, identity<Key>, Compare, Alloc>	tree_type;
+			typedef set_node_handle<Key>									node_type;
 
 			// * COSTRUTTORI * //
 
@@ -45,130 +47,55 @@ namespace ft
 				(void)alloc;
 			};
 
-			// Copy Constructor
-			set(const set& other)
-			{
-				this->_key_type = other._key_type;
-				this->_value_type = other._value_type;
-				this->_key_compare = other._key_compare;
-				if (other.begin() != other.end())
-					this->insert(other.begin(), other.end());
-			};
+			// Copy Constructor: copia strutturale dell'albero, vedi RBTree::cloneFrom
+			set(const set& other) : tree_type(other) {};
 
 			// Copy Assign Operator
 			set&	operator=(const set& rhs)
 			{
-				if (this == &rhs)
-					return (*this);
-				this->_key_type = rhs._key_type;
-				this->_value_type = rhs._value_type;
-				this->_key_compare = rhs._key_compare;
-				this->_alloc = rhs._alloc;
-				this->clear();
-				this->insert(rhs.begin(), rhs.end());
+				tree_type::operator=(rhs);
 				return (*this);
 			};
 
 			// Destructor
 			~set()
 			{
-				clear();
+				this->clear();
 			};
 
 			// * MEMBER FUNCTION *//
 
+			/* Una sola discesa iterativa trova il punto di inserimento o il nodo già presente
+			   (vedi RBTree::insertUnique); in caso di duplicato l'iteratore punta all'elemento esistente. */
 			ft::pair<iterator, bool> insert(Key const &value)
 			{
-				ft::pair<iterator, bool>	dst;
-				pointer node = this->_alloc.allocate(1);
-
-				node->color = RED;
-				node->parent = this->_sentinel;
-				node->child[LEFT] = this->_sentinel;
-				node->child[RIGHT] = this->_sentinel;
-				node->data = value;
-
-				if (this->empty())
-				{
-					this->_root = node;
-					this->_sentinel->parent = node;
-					node->color = BLACK;
-					this->_size++;
-					dst.first = iterator(node, this->_sentinel);
-					dst.second = true;
-					return (dst);
-				}
-				else
-				{
-					dst.first = iterator(node, this->_sentinel);
-					dst.second = false;
-					if (this->_c(value, this->_root->data) && this->_root->data != value)
-						return (insertNode(this->_root->child[LEFT], node, this->_root, 1));
-					else if (this->_c(this->_root->data, value) && this->_root->data != value)
-						return (insertNode(this->_root->child[RIGHT], node, this->_root, 1));
-					else
-					{
-						dst.first = iterator(node, this->_sentinel);
-						dst.second = false;
-						this->_alloc.deallocate(node, 1);
-						return (dst);
-					}
-				}
+				ft::pair<pointer, bool>	ret = this->insertUnique(value);
+
+				return (ft::make_pair(iterator(ret.first), ret.second));
 			};
 
+			/* Su un set vuoto un range ordinato viene costruito in tempo lineare, vedi RBTree::insertRange. */
 			template <class InputIt>
 			void	insert(InputIt first, InputIt last)
 			{
-				while (first != last)
-					this->insert(*first++);
+				this->insertRange(first, last);
 			};
 
+			/* Usa 'pos' come suggerimento, vedi RBTree::insertHint */
 			iterator	insert(iterator pos, const Key & val)
 			{
-				ft::pair<iterator, bool> dst;
-
-				(void)pos;
-				dst = this->insert(val);
-				return (dst.first);
-			};
-
-			ft::pair<iterator, bool> insertNode(pointer &start, pointer &node, pointer& parent, int flag)
-			{
-				ft::pair<iterator, bool>	dst;
-
-				if (!start || start == this->_sentinel)
-				{
-					node->parent = parent;
-					if (this->_c(node->data, parent->data))
-						parent->child[LEFT] = node;
-					else
-						parent->child[RIGHT] = node;
-					start = node;
-					if (flag)
-						this->_size++;
-					this->balanceInsert(start);
-					dst.first = iterator(node, this->_sentinel);
-					dst.second = true;
-					return (dst);
-				}
-				if (this->_c(node->data, start->data))
-					return (insertNode(start->child[LEFT], node, start, flag));
-				else if (this->_c(start->data, node->data))
-					return (insertNode(start->child[RIGHT], node, start, flag));
-				dst.first = iterator(node, this->_sentinel);
-				this->_alloc.deallocate(node, 1);
-				dst.second = false;
-				return (dst);
+				return (iterator(this->insertHint(pos.node, val)));
 			};
 
 			//------------------------------------------------------//
 
-			/* A differenza di 'map', mi restituisce l'iteratore all'elemento successivo, perchè la chiave è univoca */
+			/* A differenza di 'map', mi restituisce l'iteratore all'elemento successivo, perchè la chiave è univoca.
+			   Il successore resta valido: la rimozione riaggancia i nodi senza spostarli. */
 			iterator	erase(iterator pos)
 			{
 				iterator	ret = this->getSuccessor(pos.node);
 
-				this->erase_deep(*pos);
+				this->eraseNode(pos.node);
 				return (ret);
 			}
 
@@ -176,144 +103,103 @@ namespace ft
 			iterator	erase(iterator first, iterator last)
 			{
 				while (first != last)
-					this->erase_deep(*first++);
+					this->eraseNode((first++).node);
 				return (last.node);
 			}
 
-			/* Se la funzione erase_deep(key) rimuove almeno un elemento,
-               restituirà un iteratore che punta all'elemento successivo a quello rimosso
-               (o all'iteratore end() se l'elemento rimosso era l'ultimo).
-               In tal caso, la funzione erase restituisce 1 per indicare che almeno un elemento è stato rimosso.
-               Se la funzione erase_deep non rimuove alcun elemento, restituirà un iteratore vuoto,
-               che viene confrontato con un iteratore vuoto per restituire 0.
-               In sostanza, la funzione erase(const Key& key) rimuove tutti gli elementi con la chiave specificata
-               e restituisce il numero di elementi rimossi (0 o 1). */
+			/* Restituisce il numero di elementi rimossi (0 o 1). */
 			size_type	erase(const Key& key)
 			{
-				if (erase_deep(key) != iterator(NULL, this->_sentinel))
-					return (1);
-				return (0);
+				pointer	node = this->findNode(key);
+
+				if (node == this->_sentinel)
+					return (0);
+				this->eraseNode(node);
+				return (1);
 			}
 
-			/* La funzione rimuoverà tutti gli elementi con la chiave specificata */
-			iterator	erase_deep(Key const & val)
-			{
-				pointer		node = this->find(val).node;
-				pointer		tmp;
-				pointer		successor;
-				iterator	ret;
-
-				if (node && node != this->_sentinel)
-					ret = this->find(this->getSuccessor(node)->data);
-				else
-					return (iterator(NULL, this->_sentinel));
-
-				if ((!node->child[LEFT] && !node->child[RIGHT]) || (node->child[LEFT] == this->_sentinel && node->child[RIGHT] == this->_sentinel))
-				{
-					tmp = node->parent;
-					if (node->color == BLACK && node != this->_root)
-						this->balanceDelete(node);
-					if (tmp != this->_sentinel)
-						this->unlink(tmp, node);
-					else
-					{
-						this->_root = this->_sentinel;
-						this->_sentinel->parent = this->_root;
-					}
-				}
-				else if (this->oneChild(node) != this->_sentinel)
-				{
-					if (node->color == BLACK && node != this->_root)
-					{
-						if (this->oneChild(node)->color != RED)
-							this->balanceDelete(node);
-						else
-							this->oneChild(node)->color = BLACK;
-					}
-					this->oneChild(node)->parent = node->parent;
-					if (node != this->_root)
-						this->link(node->parent, node, this->oneChild(node));
-					else
-					{
-						this->_root = this->oneChild(node);
-						this->_sentinel->parent = this->_root;
-					}
-				}
-				else
-				{
-					if (this->_c(node->data, this->_root->data))
-						successor = this->getSuccessor(node);
-					else
-						successor = this->getPredecessor(node);
-					this->balanceDelete(successor);
-					if (successor->child[RIGHT] != this->_sentinel)
-					{
-						successor->child[RIGHT] = this->_sentinel;
-					}
-					if (node != this->_root)
-					{
-						this->unlink(successor->parent, successor);
-						this->link(node->parent, node, successor);
-						if (node->child[LEFT] != this->_sentinel)
-						{
-							node->child[LEFT]->parent = successor;
-							successor->child[LEFT] = node->child[LEFT];
-						}
-						if (node->child[RIGHT] != this->_sentinel)
-						{
-							if (successor->child[RIGHT] != this->_sentinel)
-								this->link(successor->parent, successor, successor->child[RIGHT]);
-							node->child[RIGHT]->parent = successor;
-							successor->child[RIGHT] = node->child[RIGHT];
-						}
-					}
-					else
-					{
-						pointer toHandle = NULL;
-						pointer	toHandle2 = NULL;
-						this->_root = successor;
-						this->_sentinel->parent = successor;
-						if (this->_root->parent->child[LEFT] == this->_root)
-							this->_root->parent->child[LEFT] = this->_sentinel;
-						else
-							this->_root->parent->child[RIGHT] = this->_sentinel;
-						this->_root->parent = this->_sentinel;
-						if (node->child[RIGHT] == successor)
-						{
-							if (node->child[RIGHT] != this->_sentinel)
-								toHandle = node->child[RIGHT];
-							this->_root->child[LEFT] = node->child[LEFT];
-							node->child[LEFT]->parent = this->_root;
-							this->_root->color = BLACK;
-						}
-						else
-						{
-							if (node->child[LEFT] != this->_sentinel)
-								toHandle2 = node->child[LEFT];
-							this->_root->child[RIGHT] = node->child[RIGHT];
-							node->child[RIGHT]->parent = this->_root;
-							this->_root->color = BLACK;
-						}
-						if (toHandle)
-							insertNode(this->_root, toHandle, this->_root, 0);
-						if (toHandle2)
-							insertNode(this->_root, toHandle2, this->_root, 0);
-					}
+			/* Stacca l'elemento dal container e lo restituisce dentro una node handle, senza copiarlo:
+			   il valore viene spostato nella handle e lo slot del nodo torna al pool (vedi node_handle_base). */
+			node_type	extract(iterator pos)
+			{
+				node_type	handle;
 
-				}
-				this->_alloc.deallocate(node, 1);
-				node = NULL;
-				this->_size--;
-				return (ret);
+				this->extractInto(pos.node, handle);
+				return (handle);
 			}
 
-			//------------------------------------------------------//
+			/* Handle vuota se la chiave manca. */
+			node_type	extract(const Key& key)
+			{
+				node_type	handle;
+				pointer		node = this->findNode(key);
 
-			void	clear()
+				if (node != this->_sentinel)
+					this->extractInto(node, handle);
+				return (handle);
+			}
+
+			/* Reinserisce il valore di una handle (anche estratta da un altro container dello stesso tipo)
+			   spostandolo in un nodo del pool. Come insert(value): iteratore all'elemento inserito o a quello
+			   con la stessa chiave, e true se il valore è stato inserito; se la chiave c'era già la handle
+			   tiene il suo valore. Con una handle vuota restituisce end() e false. */
+			ft::pair<iterator, bool>	insert(node_type & handle)
 			{
-				while (this->_size)
-					this->erase(this->min());
-			};
+				ft::pair<pointer, bool>	ret = this->insertHandle(handle);
+
+				return (ft::make_pair(iterator(ret.first), ret.second));
+			}
+
+#if __cplusplus >= 201103L
+			ft::pair<iterator, bool>	insert(node_type && handle)
+			{
+				return (insert(handle));
+			}
+#endif
+
+			/* Usa 'pos' come suggerimento, vedi RBTree::insertHint. */
+			iterator	insert(iterator pos, node_type & handle)
+			{
+				return (iterator(this->insertHandle(handle, pos.node).first));
+			}
+
+			/* Operazioni in blocco, O(m log(n/m + 1)) con m la dimensione del più piccolo dei due container
+			   (vedi RBTree::mergeFrom). merge() sposta i nodi di 'source' con chiavi che qui mancano senza
+			   copiarli né riallocarli; quelli con chiavi già presenti restano in 'source'. */
+			void	merge(set & source)
+			{
+				this->mergeFrom(source);
+			}
+
+			/* Sposta in 'right' (svuotato prima) gli elementi con chiave non minore di 'key'. */
+			void	split(const Key& key, set & right)
+			{
+				this->splitAt(key, right);
+			}
+
+			/* Accoda gli elementi di 'right', che devono avere chiavi tutte maggiori: O(log n).
+			   Se le chiavi si sovrappongono diventa una merge(). */
+			void	join(set & right)
+			{
+				this->joinWith(right);
+			}
+
+			/* Unione, intersezione e differenza con 'other', che non viene modificato; a parità di chiave
+			   resta l'elemento di questo container. */
+			void	unite(set const & other)
+			{
+				this->uniteWith(other);
+			}
+
+			void	intersect(set const & other)
+			{
+				this->intersectWith(other);
+			}
+
+			void	subtract(set const & other)
+			{
+				this->subtractWith(other);
+			}
 
 			//------------------------------------------------------//
 
@@ -338,87 +224,151 @@ namespace ft
 
 			//------------------------------------------------------//
 
+			/* Ricerca iterativa, vedi RBTree::findNode */
 			iterator	find(Key const & val) const
 			{
-				pointer	node = this->_root;
+				return (iterator(this->findNode(val)));
+			};
+
+			//------------------------------------------------------//
+
+			size_type	count(Key const & key) const
+			{
+				if (this->findNode(key) == this->_sentinel)
+					return (0);
+				return (1);
+			};
+
+			//------------------------------------------------------//
+
+			/* I limiti vengono cercati scendendo dalla root dell'albero (O(log n)), vedi RBTree::lowerBound */
+			iterator	lower_bound(Key const & key)
+			{
+				return (iterator(this->lowerBound(key)));
+			};
 
-				if (!node || node == this->_sentinel)
-					return (iterator(this->_sentinel, this->_sentinel));
+			const_iterator	lower_bound(Key const & key) const
+			{
+				return (const_iterator(this->lowerBound(key)));
+			};
+
+			iterator	upper_bound(Key const & key)
+			{
+				return (iterator(this->upperBound(key)));
+			};
+
+			const_iterator	upper_bound(Key const & key) const
+			{
+				return (const_iterator(this->upperBound(key)));
+			};
+
+			ft::pair<iterator, iterator>	equal_range(const Key& key)
+			{
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
 
-				return (findPointer(node, val));
+				return (ft::make_pair(iterator(range.first), iterator(range.second)));
 			};
 
-			iterator	findPointer(pointer& start, Key const & val) const
+			ft::pair<const_iterator, const_iterator>	equal_range(const Key& key) const
 			{
-				if (!start || start->color == SENTINEL)		// valore inesistente
-					return (iterator(this->_sentinel, this->_sentinel));
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
 
-				if (start->data == val)			// valore uguale
-					return (iterator(start, this->_sentinel));
-				if (this->_c(val, start->data))
-					return (findPointer(start->child[LEFT], val));
-				if (this->_c(start->data, val))	// valore maggiore
-					return (findPointer(start->child[RIGHT], val));
-				else
-					return (iterator(start, this->_sentinel));
+				return (ft::make_pair(const_iterator(range.first), const_iterator(range.second)));
 			};
 
 			//------------------------------------------------------//
 
-			size_type	count(Key const & key) const
+			/* Statistiche d'ordine in O(log n), vedi RBTree::selectNode e RBTree::rankOf:
+			   select(k) è l'elemento in posizione k (end() se k >= size()), rank(key) il numero di elementi minori di key. */
+			iterator	select(size_type k)
 			{
-				iterator	dst = find(key);
-				if (dst == iterator(this->_sentinel, this->_sentinel))
-					return (0);
-				return (1);
+				return (iterator(this->selectNode(k)));
+			};
+
+			const_iterator	select(size_type k) const
+			{
+				return (const_iterator(this->selectNode(k)));
+			};
+
+			size_type	rank(Key const & key) const
+			{
+				return (this->rankOf(key));
 			};
 
 			//------------------------------------------------------//
 
-			iterator	lower_bound(Key const & key)
+			/* Ricerca eterogenea: se Compare è trasparente (vedi ft::is_transparent) questi overload accettano
+			   qualunque tipo K che il comparatore sa confrontare con Key e lo passano così com'è alle discese
+			   dell'albero, senza costruire un Key temporaneo. Con un comparatore normale non partecipano alla
+			   risoluzione e l'argomento viene convertito in Key come sempre. */
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type	find(K const & key) const
 			{
-				iterator	tmp = this->begin();
+				return (iterator(this->findNode(key)));
+			};
 
-				while (tmp != this->end() && this->_c(tmp.node->data, key))
-					tmp++;
-				return (tmp);
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, size_type>::type	count(K const & key) const
+			{
+				return (this->findNode(key) != this->_sentinel);
 			};
 
-			const_iterator	lower_bound(Key const & key) const
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type	lower_bound(K const & key)
 			{
-				const_iterator	tmp = this->begin();
+				return (iterator(this->lowerBound(key)));
+			};
 
-				while (tmp != this->end() && this->_c(tmp.node->data, key))
-					tmp++;
-				return (tmp);
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type	lower_bound(K const & key) const
+			{
+				return (const_iterator(this->lowerBound(key)));
 			};
 
-			iterator	upper_bound(Key const & key)
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, iterator>::type	upper_bound(K const & key)
 			{
-				iterator	tmp = this->begin();
+				return (iterator(this->upperBound(key)));
+			};
 
-				while (tmp != this->end() && !this->_c(key, tmp.node->data))
-					tmp++;
-				return (tmp);
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, const_iterator>::type	upper_bound(K const & key) const
+			{
+				return (const_iterator(this->upperBound(key)));
 			};
 
-			const_iterator	upper_bound(Key const & key) const
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, ft::pair<iterator, iterator> >::type	equal_range(K const & key)
 			{
-				const_iterator	tmp = this->begin();
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
 
-				while (tmp != this->end() && !this->_c(key, tmp.node->data))
-					tmp++;
-				return (tmp);
+				return (ft::make_pair(iterator(range.first), iterator(range.second)));
 			};
 
-			ft::pair<iterator, iterator>	equal_range(const Key& key)
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, ft::pair<const_iterator, const_iterator> >::type	equal_range(K const & key) const
+			{
+				ft::pair<pointer, pointer>	range = this->equalRange(key);
+
+				return (ft::make_pair(const_iterator(range.first), const_iterator(range.second)));
+			};
+
+			template <class K>
+			typename ft::enable_if_transparent<Compare, K, size_type>::type	rank(K const & key) const
 			{
-				return (ft::make_pair(this->lower_bound(key), this->upper_bound(key)));
+				return (this->rankOf(key));
 			};
 
-			ft::pair<const_iterator, const_iterator>	equal_range(const Key& key) const
+			/* Gli iteratori vanno sempre a erase(iterator): iterator è un overload esatto, const_iterator viene escluso. */
+			template <class K>
+			typename ft::enable_if<ft::is_transparent<Compare>::value && !ft::is_same<K, const_iterator>::value, size_type>::type	erase(K const & key)
 			{
-				return (ft::make_pair(this->lower_bound(key), this->upper_bound(key)));
+				pointer	node = this->findNode(key);
+
+				if (node == this->_sentinel)
+					return (0);
+				this->eraseNode(node);
+				return (1);
 			};
 
 	};
@@ -0,0 +1,375 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+/* Kernel vettoriali per confronti e ricerche su memoria contigua di tipi aritmetici, usati da
+   ft::equal, ft::lexicographical_compare, ft::find e ft::count quando gli iteratori sono puntatori
+   o iteratori di ft::vector (vedi utility.hpp).
+   Su x86-64 con GCC o Clang ogni kernel esiste in versione SSE2 (sempre disponibile) e AVX2;
+   la scelta avviene a runtime, una volta sola, interrogando la CPU. Altrove resta il ciclo scalare.
+   Definendo FT_NO_SIMD si forza il ciclo scalare ovunque. */
+#if !defined(FT_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+# define FT_SIMD_X86 1
+# include <immintrin.h>
+#endif
+
+namespace ft
+{
+	namespace simd
+	{
+		enum lane_kind
+		{
+			NONE,		// nessun kernel: resta l'algoritmo generico
+			BITWISE,	// interi: uguali se e solo se i byte sono uguali
+			FLOAT,		// float: serve il confronto IEEE (0.0 == -0.0, NaN != NaN)
+			DOUBLE
+		};
+
+		template <class T>
+		struct lane { static const lane_kind kind = NONE; };
+
+		template <> struct lane<bool> { static const lane_kind kind = BITWISE; };
+		template <> struct lane<char> { static const lane_kind kind = BITWISE; };
+		template <> struct lane<signed char> { static const lane_kind kind = BITWISE; };
+		template <> struct lane<unsigned char> { static const lane_kind kind = BITWISE; };
+		template <> struct lane<wchar_t> { static const lane_kind kind = BITWISE; };
+#if __cplusplus >= 201103L
+		template <> struct lane<char16_t> { static const lane_kind kind = BITWISE; };
+		template <> struct lane<char32_t> { static const lane_kind kind = BITWISE; };
+#endif
+		template <> struct lane<short int> { static const lane_kind kind = BITWISE; };
+		template <> struct lane<unsigned short int> { static const lane_kind kind = BITWISE; };
+		template <> struct lane<int> { static const lane_kind kind = BITWISE; };
+		template <> struct lane<unsigned int> { static const lane_kind kind = BITWISE; };
+		template <> struct lane<long int> { static const lane_kind kind = BITWISE; };
+		template <> struct lane<unsigned long int> { static const lane_kind kind = BITWISE; };
+		template <> struct lane<long long int> { static const lane_kind kind = BITWISE; };
+		template <> struct lane<unsigned long long int> { static const lane_kind kind = BITWISE; };
+		template <> struct lane<float> { static const lane_kind kind = FLOAT; };
+		template <> struct lane<double> { static const lane_kind kind = DOUBLE; };
+
+		/* memcmp ordina i byte come unsigned char: per questi tipi coincide con l'ordine lessicografico. */
+		template <class T>
+		struct memcmp_orders { static const bool value = false; };
+
+		template <> struct memcmp_orders<unsigned char> { static const bool value = true; };
+		template <> struct memcmp_orders<bool> { static const bool value = true; };
+		template <> struct memcmp_orders<char> { static const bool value = (static_cast<char>(-1) > 0); };
+
+		// * VERSIONE SCALARE * //
+
+		template <class T>
+		std::size_t	scalarMismatch(T const * a, T const * b, std::size_t n)
+		{
+			std::size_t	i = 0;
+
+			while (i < n && a[i] == b[i])
+				++i;
+			return (i);
+		}
+
+		template <class T>
+		std::size_t	scalarFind(T const * p, std::size_t n, T const & value)
+		{
+			std::size_t	i = 0;
+
+			while (i < n && !(p[i] == value))
+				++i;
+			return (i);
+		}
+
+		template <class T>
+		std::size_t	scalarCount(T const * p, std::size_t n, T const & value)
+		{
+			std::size_t	ret = 0;
+
+			for (std::size_t i = 0; i < n; ++i)
+				ret += (p[i] == value);
+			return (ret);
+		}
+
+#ifdef FT_SIMD_X86
+
+		/* Ogni confronto produce un vettore in cui le corsie uguali hanno tutti i byte a 1:
+		   movemask_epi8 ne ricava una maschera di un bit per byte, quindi l'indice di una corsia
+		   è (bit / sizeof(T)) e il numero di corsie uguali è (bit accesi / sizeof(T)). */
+
+		inline int				countBits(unsigned int mask)	{ return (__builtin_popcount(mask)); }
+		inline int				firstBit(unsigned int mask)		{ return (__builtin_ctz(mask)); }
+
+		/* Un vettore con 'value' ripetuto in ogni corsia, per qualunque larghezza di T. */
+		template <class T, std::size_t Bytes>
+		struct splat
+		{
+			T	lanes[Bytes / sizeof(T)];
+
+			explicit splat(T const & value)
+			{
+				for (std::size_t i = 0; i < Bytes / sizeof(T); ++i)
+					lanes[i] = value;
+			}
+		};
+
+		// * SSE2 * //
+
+		template <lane_kind Kind, std::size_t Size>
+		struct sse2_eq;
+
+		template <> struct sse2_eq<BITWISE, 1> { static __m128i apply(__m128i a, __m128i b) { return (_mm_cmpeq_epi8(a, b)); } };
+		template <> struct sse2_eq<BITWISE, 2> { static __m128i apply(__m128i a, __m128i b) { return (_mm_cmpeq_epi16(a, b)); } };
+		template <> struct sse2_eq<BITWISE, 4> { static __m128i apply(__m128i a, __m128i b) { return (_mm_cmpeq_epi32(a, b)); } };
+
+		/* SSE2 non ha il confronto a 64 bit: due metà a 32 bit uguali, scambiate e messe in AND. */
+		template <> struct sse2_eq<BITWISE, 8>
+		{
+			static __m128i apply(__m128i a, __m128i b)
+			{
+				__m128i	half = _mm_cmpeq_epi32(a, b);
+
+				return (_mm_and_si128(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1))));
+			}
+		};
+
+		template <> struct sse2_eq<FLOAT, 4>
+		{
+			static __m128i apply(__m128i a, __m128i b) { return (_mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)))); }
+		};
+
+		template <> struct sse2_eq<DOUBLE, 8>
+		{
+			static __m128i apply(__m128i a, __m128i b) { return (_mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)))); }
+		};
+
+		template <class T>
+		inline unsigned int	sse2Mask(T const * a, T const * b)
+		{
+			__m128i	x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(a));
+			__m128i	y = _mm_loadu_si128(reinterpret_cast<__m128i const *>(b));
+
+			return (static_cast<unsigned int>(_mm_movemask_epi8(sse2_eq<lane<T>::kind, sizeof(T)>::apply(x, y))));
+		}
+
+		template <class T>
+		std::size_t	sse2Mismatch(T const * a, T const * b, std::size_t n)
+		{
+			std::size_t const	step = 16 / sizeof(T);
+			std::size_t			i = 0;
+
+			for (; i + step <= n; i += step)
+			{
+				unsigned int	mask = sse2Mask(a + i, b + i) ^ 0xFFFFu;
+
+				if (mask)
+					return (i + firstBit(mask) / sizeof(T));
+			}
+			return (i + scalarMismatch(a + i, b + i, n - i));
+		}
+
+		template <class T>
+		std::size_t	sse2Find(T const * p, std::size_t n, T const & value)
+		{
+			std::size_t const	step = 16 / sizeof(T);
+			splat<T, 16>		v(value);
+			std::size_t			i = 0;
+
+			for (; i + step <= n; i += step)
+			{
+				unsigned int	mask = sse2Mask(p + i, v.lanes);
+
+				if (mask)
+					return (i + firstBit(mask) / sizeof(T));
+			}
+			return (i + scalarFind(p + i, n - i, value));
+		}
+
+		template <class T>
+		std::size_t	sse2Count(T const * p, std::size_t n, T const & value)
+		{
+			std::size_t const	step = 16 / sizeof(T);
+			splat<T, 16>		v(value);
+			std::size_t			bits = 0;
+			std::size_t			i = 0;
+
+			for (; i + step <= n; i += step)
+				bits += countBits(sse2Mask(p + i, v.lanes));
+			return (bits / sizeof(T) + scalarCount(p + i, n - i, value));
+		}
+
+		// * AVX2 * //
+
+		/* Queste funzioni vengono compilate per AVX2 anche se il resto del programma non lo è:
+		   vengono chiamate solo dopo aver verificato che la CPU lo supporti (vedi hasAvx2). */
+# if defined(__clang__)
+#  pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+# else
+#  pragma GCC push_options
+#  pragma GCC target("avx2")
+# endif
+
+		template <lane_kind Kind, std::size_t Size>
+		struct avx2_eq;
+
+		template <> struct avx2_eq<BITWISE, 1> { static __m256i apply(__m256i a, __m256i b) { return (_mm256_cmpeq_epi8(a, b)); } };
+		template <> struct avx2_eq<BITWISE, 2> { static __m256i apply(__m256i a, __m256i b) { return (_mm256_cmpeq_epi16(a, b)); } };
+		template <> struct avx2_eq<BITWISE, 4> { static __m256i apply(__m256i a, __m256i b) { return (_mm256_cmpeq_epi32(a, b)); } };
+		template <> struct avx2_eq<BITWISE, 8> { static __m256i apply(__m256i a, __m256i b) { return (_mm256_cmpeq_epi64(a, b)); } };
+
+		template <> struct avx2_eq<FLOAT, 4>
+		{
+			static __m256i apply(__m256i a, __m256i b) { return (_mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ))); }
+		};
+
+		template <> struct avx2_eq<DOUBLE, 8>
+		{
+			static __m256i apply(__m256i a, __m256i b) { return (_mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ))); }
+		};
+
+		template <class T>
+		inline unsigned int	avx2Mask(T const * a, T const * b)
+		{
+			__m256i	x = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(a));
+			__m256i	y = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(b));
+
+			return (static_cast<unsigned int>(_mm256_movemask_epi8(avx2_eq<lane<T>::kind, sizeof(T)>::apply(x, y))));
+		}
+
+		/* Due vettori per giro: il confronto del secondo parte mentre si controlla il primo. */
+		template <class T>
+		std::size_t	avx2Mismatch(T const * a, T const * b, std::size_t n)
+		{
+			std::size_t const	step = 32 / sizeof(T);
+			std::size_t			i = 0;
+
+			for (; i + 2 * step <= n; i += 2 * step)
+			{
+				unsigned int	lo = ~avx2Mask(a + i, b + i);
+				unsigned int	hi = ~avx2Mask(a + i + step, b + i + step);
+
+				if (lo | hi)
+					return (lo ? i + firstBit(lo) / sizeof(T) : i + step + firstBit(hi) / sizeof(T));
+			}
+			for (; i + step <= n; i += step)
+			{
+				unsigned int	mask = ~avx2Mask(a + i, b + i);
+
+				if (mask)
+					return (i + firstBit(mask) / sizeof(T));
+			}
+			return (i + scalarMismatch(a + i, b + i, n - i));
+		}
+
+		template <class T>
+		std::size_t	avx2Find(T const * p, std::size_t n, T const & value)
+		{
+			std::size_t const	step = 32 / sizeof(T);
+			splat<T, 32>		v(value);
+			std::size_t			i = 0;
+
+			for (; i + step <= n; i += step)
+			{
+				unsigned int	mask = avx2Mask(p + i, v.lanes);
+
+				if (mask)
+					return (i + firstBit(mask) / sizeof(T));
+			}
+			return (i + scalarFind(p + i, n - i, value));
+		}
+
+		template <class T>
+		std::size_t	avx2Count(T const * p, std::size_t n, T const & value)
+		{
+			std::size_t const	step = 32 / sizeof(T);
+			splat<T, 32>		v(value);
+			std::size_t			bits = 0;
+			std::size_t			i = 0;
+
+			for (; i + step <= n; i += step)
+				bits += countBits(avx2Mask(p + i, v.lanes));
+			return (bits / sizeof(T) + scalarCount(p + i, n - i, value));
+		}
+
+# if defined(__clang__)
+#  pragma clang attribute pop
+# else
+#  pragma GCC pop_options
+# endif
+
+		inline bool	hasAvx2()
+		{
+			static const bool	supported = __builtin_cpu_supports("avx2");
+
+			return (supported);
+		}
+
+#endif
+
+		// * PUNTI DI INGRESSO * //
+
+		/* Primo indice in cui a[i] == b[i] è falso, oppure n. */
+		template <class T>
+		std::size_t	mismatch(T const * a, T const * b, std::size_t n)
+		{
+#ifdef FT_SIMD_X86
+			if (lane<T>::kind != NONE)
+				return (hasAvx2() ? avx2Mismatch(a, b, n) : sse2Mismatch(a, b, n));
+#endif
+			return (scalarMismatch(a, b, n));
+		}
+
+		/* Per gli interi l'uguaglianza è quella dei byte: basta memcmp, già vettorizzata dalla libc. */
+		template <class T>
+		bool	equal(T const * a, T const * b, std::size_t n)
+		{
+			if (lane<T>::kind == BITWISE)
+				return (n == 0 || std::memcmp(a, b, n * sizeof(T)) == 0);
+			return (mismatch(a, b, n) == n);
+		}
+
+		/* Il primo elemento diverso decide; tra float due elementi possono essere diversi ma equivalenti
+		   (0.0 e -0.0, i NaN): in quel caso la scansione riprende dall'elemento successivo. */
+		template <class T>
+		bool	lexicographical_less(T const * a, std::size_t na, T const * b, std::size_t nb)
+		{
+			std::size_t	n = na < nb ? na : nb;
+
+			if (memcmp_orders<T>::value)
+			{
+				int	cmp = n ? std::memcmp(a, b, n) : 0;
+
+				return (cmp != 0 ? cmp < 0 : na < nb);
+			}
+			for (std::size_t i = 0; ; ++i)
+			{
+				i += mismatch(a + i, b + i, n - i);
+				if (i == n)
+					return (na < nb);
+				if (a[i] < b[i])
+					return (true);
+				if (b[i] < a[i])
+					return (false);
+			}
+		}
+
+		/* Indice del primo elemento uguale a 'value', oppure n. */
+		template <class T>
+		std::size_t	find(T const * p, std::size_t n, T const & value)
+		{
+#ifdef FT_SIMD_X86
+			if (lane<T>::kind != NONE)
+				return (hasAvx2() ? avx2Find(p, n, value) : sse2Find(p, n, value));
+#endif
+			return (scalarFind(p, n, value));
+		}
+
+		template <class T>
+		std::size_t	count(T const * p, std::size_t n, T const & value)
+		{
+#ifdef FT_SIMD_X86
+			if (lane<T>::kind != NONE)
+				return (hasAvx2() ? avx2Count(p, n, value) : sse2Count(p, n, value));
+#endif
+			return (scalarCount(p, n, value));
+		}
+	}
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "vector.hpp"
+
+namespace ft
+{
+	/*
+		Vettore con spazio interno per N elementi: finché la dimensione resta entro N
+		non viene allocata memoria, oltre gli elementi passano sull'heap come in ft::vector.
+		L'implementazione, gli iteratori e gli operatori di confronto sono quelli di ft::vector,
+		di cui small_vector è solo un nome con il parametro InlineCapacity fissato.
+		swap() funziona anche quando uno o entrambi i vettori usano lo spazio interno.
+	*/
+	template <class T, std::size_t N, class Allocator = std::allocator<T>, class Growth = ft::growth_double>
+	class small_vector : public vector<T, Allocator, Growth, N>
+	{
+		public:
+
+		typedef	vector<T, Allocator, Growth, N>				base_type;
+		typedef	typename base_type::value_type				value_type;
+		typedef	typename base_type::allocator_type			allocator_type;
+		typedef	typename base_type::size_type				size_type;
+
+		static const size_type	inline_capacity = N;
+
+		// * COSTRUTTORI * //
+
+		explicit small_vector(const allocator_type& alloc = allocator_type()):
+		base_type(alloc)
+		{};
+
+		explicit small_vector(size_type count, const value_type& value = value_type(), const allocator_type& alloc = allocator_type()):
+		base_type(count, value, alloc)
+		{};
+
+		template< class InputIterator >
+		small_vector( InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type * = 0 ):
+		base_type(first, last, alloc)
+		{};
+	};
+}
@@ -4,6 +4,10 @@
 
 namespace ft
 {
+	/* Il container sottostante deve fornire back, push_back e pop_back. Con ft::deque
+	   (ft::stack<T, ft::deque<T> >) la crescita alloca un blocco alla volta invece di copiare tutto
+	   il contenuto in un buffer più grande: nessun push paga la riallocazione, a costo di un accesso
+	   un po' più lento che in ft::vector. */
 	template <class T, class Container = ft::vector<T> >
 	class stack
 	{
@@ -50,7 +54,7 @@ namespace ft
 				return (_c.size());
 			};
 
-			reference& top()
+			reference top()
 			{
     			if (empty())
 				{
@@ -59,7 +63,7 @@ namespace ft
     			return _c.back();
 			};
 
-			const_reference& top() const
+			const_reference top() const
 			{
     			if (empty())
 				{
@@ -78,6 +82,20 @@ namespace ft
 				_c.pop_back();
 			};
 
+			/* Quella del container sottostante, che deve fornire memory_usage() (ft::vector e ft::deque lo fanno). */
+			memory_footprint	memory_usage() const
+			{
+				memory_footprint	usage = _c.memory_usage();
+
+				usage.overhead += sizeof(*this) - sizeof(_c);
+				return (usage);
+			};
+
+#ifdef FT_INSTRUMENT
+			void			set_alloc_stats(alloc_stats* stats)	{ _c.set_alloc_stats(stats); };
+			alloc_stats*	get_alloc_stats() const				{ return (_c.get_alloc_stats()); };
+#endif
+
 			template <class V, class Cont>
 			friend bool operator== (const stack<V,Cont>& lhs, const stack<V,Cont>& rhs);
 			template <class V, class Cont>
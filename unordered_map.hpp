@@ -0,0 +1,229 @@
+#pragma once
+
+#include <memory>
+#include <functional>
+#include <stdexcept>
+#include "utility.hpp"
+#include "iterator.hpp"
+#include "rb_tree.hpp"
+#include "hash_table.hpp"
+
+namespace ft
+{
+	/* Map non ordinata su tabella hash a indirizzamento aperto (vedi HashTable): stessa interfaccia
+	   di ft::map senza quello che dipende dall'ordine (lower_bound, upper_bound, select, rank, <),
+	   più i controlli sulla tabella (bucket_count, load_factor, max_load_factor, rehash, reserve).
+	   Gli elementi vivono direttamente negli slot della tabella: inserimenti e rimozioni possono
+	   spostarli, quindi puntatori, riferimenti e iteratori non restano validi come in ft::map. */
+	template <class Key, class T, class Hash = ft::hash<Key>, class KeyEqual = std::equal_to<Key>, class Allocator = std::allocator<ft::pair<const Key, T> > >
+	class unordered_map : public HashTable<ft::pair<const Key, T>, select_first<ft::pair<const Key, T> >, Hash, KeyEqual, Allocator>
+	{
+		public:
+
+			typedef Key																key_type;
+			typedef T																mapped_type;
+			typedef ft::pair<const Key, T>											value_type;
+			typedef HashTable<value_type, select_first<value_type>, Hash, KeyEqual, Allocator>	table_type;
+			typedef Hash															hasher;
+			typedef KeyEqual														key_equal;
+			typedef Allocator														allocator_type;
+			typedef typename allocator_type::reference								reference;
+			typedef typename allocator_type::const_reference						const_reference;
+			typedef typename allocator_type::pointer								pointer;
+			typedef typename allocator_type::const_pointer							const_pointer;
+			typedef typename table_type::size_type									size_type;
+			typedef typename table_type::difference_type							difference_type;
+			typedef typename table_type::iterator									iterator;
+			typedef typename table_type::const_iterator							const_iterator;
+
+
+			// * COSTRUTTORI * //
+
+			unordered_map() {};
+
+			explicit unordered_map(size_type bucket_count, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(), const Allocator& alloc = Allocator())
+				: table_type(bucket_count, hash, equal, alloc) {};
+
+			template <class InputIt>
+			unordered_map(InputIt first, InputIt last, size_type bucket_count = 0, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(), const Allocator& alloc = Allocator())
+				: table_type(bucket_count, hash, equal, alloc)
+			{
+				this->insert(first, last);
+			};
+
+			unordered_map(const unordered_map& other) : table_type(other) {};
+
+			unordered_map&	operator=(unordered_map const & other)
+			{
+				table_type::operator=(other);
+				return (*this);
+			};
+
+			~unordered_map() {};
+
+
+			// * MEMBER FUNCTION *//
+
+			/* Una ricerca; se la chiave manca, l'elemento viene costruito direttamente nel suo slot. */
+			T&	operator[](const Key& key)
+			{
+				size_type	i = this->findIndex(key);
+
+				if (i == this->npos())
+					i = this->insertNew(value_type(key, mapped_type()));
+				return (this->_slots[i].second);
+			};
+
+			T&	at(const Key& key)
+			{
+				size_type	i = this->findIndex(key);
+
+				if (i == this->npos())
+					throw std::out_of_range("ft::unordered_map::at");
+				return (this->_slots[i].second);
+			};
+
+			const mapped_type&	at(const Key& key) const
+			{
+				size_type	i = this->findIndex(key);
+
+				if (i == this->npos())
+					throw std::out_of_range("ft::unordered_map::at");
+				return (this->_slots[i].second);
+			};
+
+			ft::pair<iterator, bool>	insert(value_type const & value)
+			{
+				ft::pair<size_type, bool>	ret = this->insertUnique(value);
+
+				return (ft::make_pair(slotIterator(ret.first), ret.second));
+			};
+
+			/* Se il range si può misurare, la tabella viene dimensionata una volta sola prima di inserire. */
+			template <class InputIt>
+			void	insert(InputIt first, InputIt last)
+			{
+				typedef typename ft::iterator_traits<InputIt>::iterator_category	category;
+
+				if (is_forward_iterator_tagged<category>::value)
+					this->reserve(this->size() + static_cast<size_type>(ft::distance(first, last)));
+				for (; first != last; ++first)
+					this->insertUnique(*first);
+			};
+
+			/* Il suggerimento non serve a una tabella hash: c'è solo per compatibilità con ft::map. */
+			iterator	insert(iterator hint, const value_type& val)
+			{
+				(void)hint;
+				return (insert(val).first);
+			};
+
+			/* Restituisce l'iteratore all'elemento successivo (che il backward shift può aver spostato in 'pos'). */
+			iterator	erase(iterator pos)
+			{
+				return (slotIterator(this->eraseIndex(static_cast<size_type>(pos.slot - this->_slots))));
+			};
+
+			/* Gli elementi rimasti mantengono il loro ordine di visita, ma 'last' può essersi spostato:
+			   vengono quindi rimossi tanti elementi quanti ce n'erano nel range. */
+			iterator	erase(iterator first, iterator last)
+			{
+				difference_type	n = ft::distance(first, last);
+
+				while (n-- > 0)
+					first = erase(first);
+				return (first);
+			};
+
+			size_type	erase(const Key& key)
+			{
+				size_type	i = this->findIndex(key);
+
+				if (i == this->npos())
+					return (0);
+				this->eraseIndex(i);
+				return (1);
+			};
+
+			void	swap(unordered_map& other)
+			{
+				table_type::swap(other);
+			};
+
+			//------------------------------------------------------//
+
+			iterator	find(const Key& key)
+			{
+				return (slotIterator(this->findIndex(key)));
+			};
+
+			const_iterator	find(const Key& key) const
+			{
+				size_type	i = this->findIndex(key);
+
+				return (const_iterator(this->_slots + i, this->_dist + i));
+			};
+
+			size_type	count(const Key& key) const
+			{
+				return (this->findIndex(key) != this->npos());
+			};
+
+			ft::pair<iterator, iterator>	equal_range(const Key& key)
+			{
+				iterator	first = find(key);
+				iterator	last = first;
+
+				if (first != this->end())
+					++last;
+				return (ft::make_pair(first, last));
+			};
+
+			ft::pair<const_iterator, const_iterator>	equal_range(const Key& key) const
+			{
+				const_iterator	first = find(key);
+				const_iterator	last = first;
+
+				if (first != this->end())
+					++last;
+				return (ft::make_pair(first, last));
+			};
+
+		private:
+
+			iterator	slotIterator(size_type i)
+			{
+				return (iterator(this->_slots + i, this->_dist + i));
+			};
+	};
+
+	/* Stessi elementi, indipendentemente dall'ordine in cui le due tabelle li visitano. */
+	template< class Key, class T, class Hash, class KeyEqual, class Alloc >
+	bool operator==( const ft::unordered_map<Key, T, Hash, KeyEqual, Alloc>& lhs, const ft::unordered_map<Key, T, Hash, KeyEqual, Alloc>& rhs )
+	{
+		typedef typename ft::unordered_map<Key, T, Hash, KeyEqual, Alloc>::const_iterator	const_iterator;
+
+		if (lhs.size() != rhs.size())
+			return (false);
+		for (const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+		{
+			const_iterator	other = rhs.find(it->first);
+
+			if (other == rhs.end() || !(other->second == it->second))
+				return (false);
+		}
+		return (true);
+	};
+
+	template< class Key, class T, class Hash, class KeyEqual, class Alloc >
+	bool operator!=( const ft::unordered_map<Key, T, Hash, KeyEqual, Alloc>& lhs, const ft::unordered_map<Key, T, Hash, KeyEqual, Alloc>& rhs )
+	{
+		return (!(lhs == rhs));
+	};
+
+	template< class Key, class T, class Hash, class KeyEqual, class Alloc >
+	void	swap(ft::unordered_map<Key, T, Hash, KeyEqual, Alloc>& lhs, ft::unordered_map<Key, T, Hash, KeyEqual, Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+	};
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <memory>
+#include <functional>
+#include "utility.hpp"
+#include "iterator.hpp"
+#include "rb_tree.hpp"
+#include "hash_table.hpp"
+
+namespace ft
+{
+	/* Set non ordinato su tabella hash a indirizzamento aperto (vedi HashTable), con l'interfaccia di
+	   ft::set senza le operazioni che dipendono dall'ordine. Come in ft::set gli iteratori sono costanti. */
+	template <class Key, class Hash = ft::hash<Key>, class KeyEqual = std::equal_to<Key>, class Allocator = std::allocator<Key> >
+	class unordered_set : public HashTable<Key, identity<Key>, Hash, KeyEqual, Allocator>
+	{
+		public:
+
+			typedef Key																key_type;
+			typedef Key																value_type;
+			typedef HashTable<Key, identity<Key>, Hash, KeyEqual, Allocator>		table_type;
+			typedef Hash															hasher;
+			typedef KeyEqual														key_equal;
+			typedef Allocator														allocator_type;
+			typedef typename allocator_type::reference								reference;
+			typedef typename allocator_type::const_reference						const_reference;
+			typedef typename allocator_type::pointer								pointer;
+			typedef typename allocator_type::const_pointer							const_pointer;
+			typedef typename table_type::size_type									size_type;
+			typedef typename table_type::difference_type							difference_type;
+			typedef typename table_type::const_iterator							iterator;
+			typedef typename table_type::const_iterator							const_iterator;
+
+
+			// * COSTRUTTORI * //
+
+			unordered_set() {};
+
+			explicit unordered_set(size_type bucket_count, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(), const Allocator& alloc = Allocator())
+				: table_type(bucket_count, hash, equal, alloc) {};
+
+			template <class InputIt>
+			unordered_set(InputIt first, InputIt last, size_type bucket_count = 0, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(), const Allocator& alloc = Allocator())
+				: table_type(bucket_count, hash, equal, alloc)
+			{
+				this->insert(first, last);
+			};
+
+			unordered_set(const unordered_set& other) : table_type(other) {};
+
+			unordered_set&	operator=(unordered_set const & other)
+			{
+				table_type::operator=(other);
+				return (*this);
+			};
+
+			~unordered_set() {};
+
+
+			// * ITERATORI * //
+
+			iterator	begin() const	{ return (table_type::begin()); };
+			iterator	end() const		{ return (table_type::end()); };
+
+
+			// * MEMBER FUNCTION *//
+
+			ft::pair<iterator, bool>	insert(Key const & value)
+			{
+				ft::pair<size_type, bool>	ret = this->insertUnique(value);
+
+				return (ft::make_pair(slotIterator(ret.first), ret.second));
+			};
+
+			/* Se il range si può misurare, la tabella viene dimensionata una volta sola prima di inserire. */
+			template <class InputIt>
+			void	insert(InputIt first, InputIt last)
+			{
+				typedef typename ft::iterator_traits<InputIt>::iterator_category	category;
+
+				if (is_forward_iterator_tagged<category>::value)
+					this->reserve(this->size() + static_cast<size_type>(ft::distance(first, last)));
+				for (; first != last; ++first)
+					this->insertUnique(*first);
+			};
+
+			/* Il suggerimento non serve a una tabella hash: c'è solo per compatibilità con ft::set. */
+			iterator	insert(iterator hint, const Key & val)
+			{
+				(void)hint;
+				return (insert(val).first);
+			};
+
+			/* Restituisce l'iteratore all'elemento successivo (che il backward shift può aver spostato in 'pos'). */
+			iterator	erase(iterator pos)
+			{
+				return (slotIterator(this->eraseIndex(static_cast<size_type>(pos.slot - this->_slots))));
+			};
+
+			/* Vengono rimossi tanti elementi quanti ce n'erano nel range, vedi unordered_map::erase. */
+			iterator	erase(iterator first, iterator last)
+			{
+				difference_type	n = ft::distance(first, last);
+
+				while (n-- > 0)
+					first = erase(first);
+				return (first);
+			};
+
+			size_type	erase(const Key& key)
+			{
+				size_type	i = this->findIndex(key);
+
+				if (i == this->npos())
+					return (0);
+				this->eraseIndex(i);
+				return (1);
+			};
+
+			void	swap(unordered_set& other)
+			{
+				table_type::swap(other);
+			};
+
+			//------------------------------------------------------//
+
+			iterator	find(Key const & val) const
+			{
+				return (slotIterator(this->findIndex(val)));
+			};
+
+			size_type	count(Key const & val) const
+			{
+				return (this->findIndex(val) != this->npos());
+			};
+
+			ft::pair<iterator, iterator>	equal_range(Key const & val) const
+			{
+				iterator	first = find(val);
+				iterator	last = first;
+
+				if (first != end())
+					++last;
+				return (ft::make_pair(first, last));
+			};
+
+		private:
+
+			iterator	slotIterator(size_type i) const
+			{
+				return (iterator(this->_slots + i, this->_dist + i));
+			};
+	};
+
+	template< class Key, class Hash, class KeyEqual, class Alloc >
+	bool operator==( const ft::unordered_set<Key, Hash, KeyEqual, Alloc>& lhs, const ft::unordered_set<Key, Hash, KeyEqual, Alloc>& rhs )
+	{
+		typedef typename ft::unordered_set<Key, Hash, KeyEqual, Alloc>::const_iterator	const_iterator;
+
+		if (lhs.size() != rhs.size())
+			return (false);
+		for (const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+			if (rhs.find(*it) == rhs.end())
+				return (false);
+		return (true);
+	};
+
+	template< class Key, class Hash, class KeyEqual, class Alloc >
+	bool operator!=( const ft::unordered_set<Key, Hash, KeyEqual, Alloc>& lhs, const ft::unordered_set<Key, Hash, KeyEqual, Alloc>& rhs )
+	{
+		return (!(lhs == rhs));
+	};
+
+	template< class Key, class Hash, class KeyEqual, class Alloc >
+	void	swap(ft::unordered_set<Key, Hash, KeyEqual, Alloc>& lhs, ft::unordered_set<Key, Hash, KeyEqual, Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+	};
+}
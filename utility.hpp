@@ -1,6 +1,24 @@
 #pragma once
 #include <typeinfo>
 #include <string>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include "simd.hpp"
+#if __cplusplus >= 201103L
+# include <utility>
+# include <type_traits>
+#endif
+
+/* In C++11 e successivi i container spostano gli elementi invece di copiarli;
+   in C++98 le stesse espressioni si riducono a una copia. */
+#if __cplusplus >= 201103L
+# define FT_MOVE(x)				std::move(x)
+# define FT_MOVE_IF_NOEXCEPT(x)	std::move_if_noexcept(x)
+#else
+# define FT_MOVE(x)				(x)
+# define FT_MOVE_IF_NOEXCEPT(x)	(x)
+#endif
 
 namespace ft
 {
@@ -24,9 +42,14 @@ namespace ft
 	template <>
 	struct is_integral_type<wchar_t> : public is_integral_res<true, wchar_t> {};
 
+#if __cplusplus >= 201103L
 	template <>
 	struct is_integral_type<char16_t> : public is_integral_res<true, char16_t> {};
 
+	template <>
+	struct is_integral_type<char32_t> : public is_integral_res<true, char32_t> {};
+#endif
+
 	template <>
 	struct is_integral_type<signed char> : public is_integral_res<true, signed char> {};
 
@@ -60,6 +83,35 @@ namespace ft
 	template <typename T>
 	struct is_integral : public is_integral_type<T> {};
 
+	/* Tipi che si possono copiare byte per byte (memcpy/memmove) senza passare dal costruttore di copia
+	   e che non hanno un distruttore da chiamare. Con GCC e Clang la risposta è data dal compilatore
+	   (funziona anche in C++98); altrove vengono riconosciuti solo i tipi interi e i puntatori. */
+	template <typename T>
+	struct is_trivially_copyable
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		static const bool	value = __is_trivially_copyable(T);
+#else
+		static const bool	value = is_integral<T>::value;
+#endif
+	};
+
+	template <typename T>
+	struct is_trivially_copyable<T*>
+	{
+		static const bool	value = true;
+	};
+
+	/* Tipi che possono essere spostati in un'altra zona di memoria copiandone i byte, senza chiamare
+	   il costruttore di copia sulla nuova posizione né il distruttore sulla vecchia.
+	   Di default coincide con is_trivially_copyable; un tipo che non tiene puntatori a se stesso può
+	   dichiararsi rilocabile specializzando questo trait (std::string di libstdc++ per esempio non lo è). */
+	template <typename T>
+	struct is_relocatable
+	{
+		static const bool	value = is_trivially_copyable<T>::value;
+	};
+
 	struct input_iterator_tag {};
 	struct output_iterator_tag {};
 	struct forward_iterator_tag : public input_iterator_tag	{};
@@ -128,6 +180,32 @@ namespace ft
 	template <>
 	struct is_ft_iterator_tagged< ::std::output_iterator_tag> : public valid_iterator_tag_res<true, ::std::output_iterator_tag> {};
 
+	/* Vero per le categorie che garantiscono più passate sullo stesso range (forward e superiori):
+	   su questi iteratori si può misurare il range prima di consumarlo. */
+	template <typename T>
+	struct is_forward_iterator_tagged : public valid_iterator_tag_res<false, T> {};
+
+	template <>
+	struct is_forward_iterator_tagged<forward_iterator_tag> : public valid_iterator_tag_res<true, forward_iterator_tag> {};
+
+	template <>
+	struct is_forward_iterator_tagged< ::std::forward_iterator_tag> : public valid_iterator_tag_res<true, ::std::forward_iterator_tag> {};
+
+	template <>
+	struct is_forward_iterator_tagged<bidirectional_iterator_tag> : public valid_iterator_tag_res<true, bidirectional_iterator_tag> {};
+
+	template <>
+	struct is_forward_iterator_tagged< ::std::bidirectional_iterator_tag> : public valid_iterator_tag_res<true, ::std::bidirectional_iterator_tag> {};
+
+	template <>
+	struct is_forward_iterator_tagged<random_access_iterator_tag> : public valid_iterator_tag_res<true, random_access_iterator_tag> {};
+
+	template <>
+	struct is_forward_iterator_tagged< ::std::random_access_iterator_tag> : public valid_iterator_tag_res<true, ::std::random_access_iterator_tag> {};
+
+	template <>
+	struct is_forward_iterator_tagged<contiguous_iterator_tag> : public valid_iterator_tag_res<true, contiguous_iterator_tag> {};
+
 	template <typename T>
 	class InvalidIteratorException : public std::exception
 	{
@@ -147,17 +225,166 @@ namespace ft
 	template <class T>
 	struct enable_if<true, T> { typedef T type; };
 
-	template <class InputIterator1, class InputIterator2>
-	bool	lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
+	template <class T, class U>
+	struct is_same { static const bool value = false; };
+
+	template <class T>
+	struct is_same<T, T> { static const bool value = true; };
+
+	template <class T>
+	struct remove_const { typedef T type; };
+
+	template <class T>
+	struct remove_const<const T> { typedef T type; };
+
+	/* true se il comparatore dichiara 'is_transparent' (come std::less<> da C++14): map e set accettano
+	   allora nelle ricerche qualunque tipo che il comparatore sa confrontare con la chiave, senza
+	   costruire un key_type (es. const char* o una string_view su una map di std::string). */
+	template <class Compare>
+	struct is_transparent
 	{
-		while (first1 != last1)
+		private:
+			typedef char	yes[1];
+			typedef char	no[2];
+
+			template <class U>
+			static yes&	test(typename U::is_transparent*);
+			template <class U>
+			static no&	test(...);
+
+		public:
+			static const bool	value = sizeof(test<Compare>(0)) == sizeof(yes);
+	};
+
+	/* enable_if per gli overload di ricerca eterogenea. La condizione deve dipendere dal parametro K
+	   del template: solo così, con un comparatore non trasparente, l'overload viene scartato (SFINAE)
+	   invece di rendere invalida l'intera classe. */
+	template <class Compare, class K, class Ret>
+	struct enable_if_transparent : public enable_if<is_transparent<Compare>::value, Ret> {};
+
+	template <class Iterator>
+	struct iterator_traits;
+
+	/* Iteratori che puntano a memoria contigua: 'address' restituisce il puntatore all'elemento.
+	   Sono i puntatori e gli iteratori di ft::vector (specializzazione in iterator.hpp). */
+	template <class Iterator>
+	struct contiguous_address
+	{
+		static const bool	value = false;
+		typedef void		element_type;
+	};
+
+	template <class T>
+	struct contiguous_address<T*>
+	{
+		static const bool							value = true;
+		typedef typename remove_const<T>::type		element_type;
+		static T*	address(T* it) { return (it); }
+	};
+
+	/* Due range contigui dello stesso tipo aritmetico: equal e lexicographical_compare passano
+	   ai kernel vettoriali di simd.hpp. */
+	template <class Iterator1, class Iterator2>
+	struct simd_comparable
+	{
+		typedef typename contiguous_address<Iterator1>::element_type	element_type;
+		static const bool	value = contiguous_address<Iterator1>::value && contiguous_address<Iterator2>::value
+			&& is_same<element_type, typename contiguous_address<Iterator2>::element_type>::value
+			&& simd::lane<element_type>::kind != simd::NONE;
+	};
+
+	/* Un range contiguo di tipo aritmetico in cui si cerca un valore dello stesso tipo
+	   (con tipi diversi la conversione cambierebbe il significato del confronto). */
+	template <class Iterator, class T>
+	struct simd_searchable
+	{
+		typedef typename contiguous_address<Iterator>::element_type	element_type;
+		static const bool	value = contiguous_address<Iterator>::value && is_same<element_type, T>::value
+			&& simd::lane<element_type>::kind != simd::NONE;
+	};
+
+	/* Versioni generiche, un elemento per iterazione attraverso gli iteratori. */
+	template <bool Simd>
+	struct algorithm_dispatch
+	{
+		template <class InputIterator1, class InputIterator2>
+		static bool	equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
 		{
-			if (first2 == last2 || *first2 < *first1) return false;
-			else if (*first1 < *first2) return true;
-			first1++;
-			first2++;
+			while (first1 != last1)
+			{
+				if (*first1++ != *first2++) return false;
+			}
+			return (true);
 		}
-		return (first2 != last2);
+
+		template <class InputIterator1, class InputIterator2>
+		static bool	lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
+		{
+			while (first1 != last1)
+			{
+				if (first2 == last2 || *first2 < *first1) return false;
+				else if (*first1 < *first2) return true;
+				first1++;
+				first2++;
+			}
+			return (first2 != last2);
+		}
+
+		template <class InputIterator, class T>
+		static InputIterator	find(InputIterator first, InputIterator last, T const & value)
+		{
+			while (first != last && !(*first == value))
+				++first;
+			return (first);
+		}
+
+		template <class InputIterator, class T>
+		static typename ft::iterator_traits<InputIterator>::difference_type	count(InputIterator first, InputIterator last, T const & value)
+		{
+			typename ft::iterator_traits<InputIterator>::difference_type	ret = 0;
+
+			for (; first != last; ++first)
+				if (*first == value)
+					ret++;
+			return (ret);
+		}
+	};
+
+	/* Range contigui di tipi aritmetici: i puntatori passano ai kernel di simd.hpp. */
+	template <>
+	struct algorithm_dispatch<true>
+	{
+		template <class InputIterator1, class InputIterator2>
+		static bool	equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+		{
+			return (simd::equal(contiguous_address<InputIterator1>::address(first1), contiguous_address<InputIterator2>::address(first2),
+				static_cast<std::size_t>(last1 - first1)));
+		}
+
+		template <class InputIterator1, class InputIterator2>
+		static bool	lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
+		{
+			return (simd::lexicographical_less(contiguous_address<InputIterator1>::address(first1), static_cast<std::size_t>(last1 - first1),
+				contiguous_address<InputIterator2>::address(first2), static_cast<std::size_t>(last2 - first2)));
+		}
+
+		template <class InputIterator, class T>
+		static InputIterator	find(InputIterator first, InputIterator last, T const & value)
+		{
+			return (first + simd::find(contiguous_address<InputIterator>::address(first), static_cast<std::size_t>(last - first), value));
+		}
+
+		template <class InputIterator, class T>
+		static typename ft::iterator_traits<InputIterator>::difference_type	count(InputIterator first, InputIterator last, T const & value)
+		{
+			return (simd::count(contiguous_address<InputIterator>::address(first), static_cast<std::size_t>(last - first), value));
+		}
+	};
+
+	template <class InputIterator1, class InputIterator2>
+	bool	lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
+	{
+		return (algorithm_dispatch<simd_comparable<InputIterator1, InputIterator2>::value>::lexicographical_compare(first1, last1, first2, last2));
 	}
 
 	template <class InputIterator1, class InputIterator2, class Compare>
@@ -176,11 +403,20 @@ namespace ft
 	template <class InputIterator1, class InputIterator2>
 	bool	equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
 	{
-		while (first1 != last1)
-		{
-			if (*first1++ != *first2++) return false;
-		}
-		return (true);
+		return (algorithm_dispatch<simd_comparable<InputIterator1, InputIterator2>::value>::equal(first1, last1, first2));
+	}
+
+	/* Primo elemento uguale a 'value', oppure last. */
+	template <class InputIterator, class T>
+	InputIterator	find(InputIterator first, InputIterator last, T const & value)
+	{
+		return (algorithm_dispatch<simd_searchable<InputIterator, T>::value>::find(first, last, value));
+	}
+
+	template <class InputIterator, class T>
+	typename ft::iterator_traits<InputIterator>::difference_type	count(InputIterator first, InputIterator last, T const & value)
+	{
+		return (algorithm_dispatch<simd_searchable<InputIterator, T>::value>::count(first, last, value));
 	}
 
 	template <class T1, class T2>
@@ -194,6 +430,13 @@ namespace ft
 		pair(first_type const & x, second_type const & y) : first(x), second(y) {}
 		template <class U1, class U2>
 		pair(pair<U1, U2> const & p) : first(p.first), second(p.second) {}
+#if __cplusplus >= 201103L
+		/* Costruisce i membri spostando gli argomenti temporanei (vedi relocate_value); partecipa solo
+		   se i membri si possono costruire dagli argomenti, così pair<int*, int>(NULL, 0) resta valido. */
+		template <class U1, class U2, class = typename std::enable_if<std::is_constructible<T1, U1&&>::value
+			&& std::is_constructible<T2, U2&&>::value>::type>
+		pair(U1&& x, U2&& y) : first(std::forward<U1>(x)), second(std::forward<U2>(y)) {}
+#endif
 		template <class U1, class U2>
 		pair<U1, U2>&	operator=(pair<U1, U2> const & rhs)
 		{
@@ -206,6 +449,43 @@ namespace ft
 		~pair() {};
 	};
 
+	/* ft::pair ha un distruttore dichiarato e quindi non è mai banalmente copiabile,
+	   ma byte per byte si può spostare quando lo sono entrambi i membri (flat_map ne fa vettori). */
+	template <class T1, class T2>
+	struct is_relocatable<pair<T1, T2> >
+	{
+		static const bool	value = is_relocatable<T1>::value && is_relocatable<T2>::value;
+	};
+
+	/* Sposta il valore di 'src' nella memoria non inizializzata 'dst' e ne chiude la vita: 'src' non va più
+	   distrutto. Byte per byte se il tipo è rilocabile, altrimenti con uno spostamento (una copia in C++98)
+	   seguito dalla distruzione di 'src'; se lo spostamento lancia un'eccezione 'src' resta intatto.
+	   Per le coppie di map si sposta anche la chiave, che è const: 'src' sparisce subito dopo e nessuno
+	   la vede cambiare. Serve alle node handle di map e set. */
+	template <class T>
+	void	relocate_value(T* dst, T& src)
+	{
+		if (is_relocatable<T>::value)
+		{
+			std::memcpy(static_cast<void*>(dst), static_cast<void*>(&src), sizeof(T));
+			return ;
+		}
+		::new (static_cast<void*>(dst)) T(FT_MOVE(src));
+		src.~T();
+	}
+
+	template <class K, class V>
+	void	relocate_value(pair<const K, V>* dst, pair<const K, V>& src)
+	{
+		if (is_relocatable<pair<const K, V> >::value)
+		{
+			std::memcpy(static_cast<void*>(dst), static_cast<void*>(&src), sizeof(src));
+			return ;
+		}
+		::new (static_cast<void*>(dst)) pair<const K, V>(FT_MOVE(const_cast<K&>(src.first)), FT_MOVE(src.second));
+		src.~pair<const K, V>();
+	}
+
 	template <class T1, class T2>
 	bool	operator==(pair<T1, T2> const & lhs, pair<T1, T2> const & rhs)
 	{
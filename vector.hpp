@@ -1,20 +1,58 @@
 #pragma once
 
 #include <memory>
+#include <cstring>
 #include <stdexcept>
 #include <iostream>
 #include "iterator.hpp"
 #include "utility.hpp"
+#include "growth_policy.hpp"
+#include "memory_stats.hpp"
 
 namespace ft
 {
-	template< class T, class Allocator = std::allocator<T> >
-	class vector
+	/* Spazio per InlineCapacity elementi dentro l'oggetto stesso, usato da ft::small_vector.
+	   Con capacità 0 (il caso di ft::vector) è una classe vuota e non occupa memoria. */
+	template <class T, std::size_t InlineCapacity>
+	class vector_inline_storage
+	{
+		protected:
+
+		T*			inlineData()		{ return (reinterpret_cast<T*>(_inline.bytes)); };
+		T const *	inlineData() const	{ return (reinterpret_cast<T const *>(_inline.bytes)); };
+
+		private:
+
+		// i membri oltre all'array servono solo ad allineare il buffer per qualunque tipo fondamentale
+		union
+		{
+			char		bytes[sizeof(T) * InlineCapacity];
+			long double	alignLongDouble;
+			long long	alignLongLong;
+			void*		alignPointer;
+		}	_inline;
+	};
+
+	template <class T>
+	class vector_inline_storage<T, 0>
+	{
+		protected:
+
+		T*			inlineData()		{ return (NULL); };
+		T const *	inlineData() const	{ return (NULL); };
+	};
+
+	/* Growth decide di quanto cresce la capacità quando il vettore è pieno (vedi growth_policy.hpp).
+	   InlineCapacity è il numero di elementi tenuti dentro l'oggetto prima di passare all'heap:
+	   0 per ft::vector, N per ft::small_vector<T, N>. */
+	template< class T, class Allocator = std::allocator<T>, class Growth = ft::growth_double, std::size_t InlineCapacity = 0 >
+	class vector : private vector_inline_storage<T, InlineCapacity>, public alloc_stats_hook
 	{
 		public:
 
 		typedef	T													value_type;
 		typedef	Allocator											allocator_type;
+		typedef	Growth												growth_policy;
 		typedef	std::size_t											size_type;
 		typedef	std::ptrdiff_t										difference_type;
 		typedef	value_type&											reference;
@@ -32,9 +70,9 @@ namespace ft
 		explicit vector(const allocator_type& alloc = allocator_type()):
 		_alloc(alloc),
 		_size(0),
-		_capacity(0),
-		_begin(NULL),
-		_end(NULL)
+		_capacity(InlineCapacity),
+		_begin(this->inlineData()),
+		_end(_begin)
 		{};
 
 		// Costruttore con 'count' copie dell'elemento 'val'
@@ -44,10 +82,16 @@ namespace ft
 		_capacity(count),
 		_begin(NULL)
 		{
-			_begin = _alloc.allocate(count);
-			_end = _begin;
-			while (count--)
-				_alloc.construct(_end++, value);
+			_begin = allocateBuffer(_capacity);
+			try
+			{
+				_end = fillConstruct(_begin, count, value);
+			}
+			catch (...)
+			{
+				deallocateBuffer(_begin, _capacity);
+				throw ;
+			}
 		};
 
 		// Costruttore con range da 'first' a 'last'
@@ -61,50 +105,98 @@ namespace ft
 			difference_type n = ft::distance(first, last);
 			_size = n;
 			_capacity = n;
-			_begin = _alloc.allocate(_capacity);
-			_end = _begin;
-			while (n--)
+			_begin = allocateBuffer(_capacity);
+			try
 			{
-				_alloc.construct(_end, *first);
-				_end++;
-				first++;
+				_end = copyConstructN(first, n, _begin);
+			}
+			catch (...)
+			{
+				deallocateBuffer(_begin, _capacity);
+				throw ;
 			}
 		};
 
 		// Copy Constructor
 		vector( const vector& other ):
-		_size(other.size()),
+		alloc_stats_hook(),
+		_alloc(other._alloc),
+		_size(0),
 		_capacity(other.capacity()),
-		_begin(_alloc.allocate(other.capacity()))
+		_begin(NULL),
+		_end(NULL)
 		{
-			if (!other.empty())
-				assign(other.begin(), other.end());
-			_end = _begin + _size;
+			_begin = allocateBuffer(_capacity);
+			_end = _begin;
+			try
+			{
+				_end = copyConstruct(other._begin, other._end, _begin);
+			}
+			catch (...)
+			{
+				deallocateBuffer(_begin, _capacity);
+				throw ;
+			}
+			_size = other.size();
 		};
 
 		// Copy Assign operator
 		vector&	operator=(const vector &other)
 		{
-			if (other == *this)
+			if (this == &other)
 				return (*this);
 			this->clear();
 			if (this->capacity())
 			{
-				_alloc.deallocate(_begin, _capacity);
-				_begin = _alloc.allocate(other.capacity());
-				_capacity = other.capacity();
+				deallocateBuffer(_begin, _capacity);
+				_begin = NULL;
+				_end = NULL;
+				_capacity = 0;
+
+				size_type	new_cap = other.capacity();
+
+				_begin = allocateBuffer(new_cap);
+				_capacity = new_cap;
 				_end = _begin;
 			}
 			this->insert(this->end(), other.begin(), other.end());
 			return (*this);
 		};
 
+#if __cplusplus >= 201103L
+		// Move Constructor: prende il buffer di other, che resta vuoto.
+		// Se other usa lo spazio interno gli elementi vanno spostati uno per uno.
+		vector( vector&& other ) noexcept(ft::is_relocatable<T>::value || InlineCapacity == 0):
+		_alloc(std::move(other._alloc)),
+		_size(0),
+		_capacity(InlineCapacity),
+		_begin(this->inlineData()),
+		_end(_begin)
+		{
+			this->steal(other);
+		}
+
+		// Move Assign operator
+		vector&	operator=(vector&& other) noexcept(ft::is_relocatable<T>::value || InlineCapacity == 0)
+		{
+			if (this == &other)
+				return (*this);
+			this->clear();
+			deallocateBuffer(_begin, _capacity);
+			_capacity = InlineCapacity;
+			_begin = this->inlineData();
+			_end = _begin;
+			_alloc = std::move(other._alloc);
+			this->steal(other);
+			return (*this);
+		}
+#endif
+
 		// Distruttore
 		~vector()
 		{
-			// this->clear();
-			if (this->_begin != NULL || _capacity != 0)
-				_alloc.deallocate(_begin, _capacity);
+			this->clear();
+			deallocateBuffer(_begin, _capacity);
 		}
 
 		// * MEMBER FUNCTION *//
@@ -132,29 +224,12 @@ namespace ft
 		*/
 		void 			resize(size_type n, value_type val = value_type())
 		{
-			size_type	new_cap = this->capacity();
-
 			if (n > this->max_size())
 				throw std::length_error("vector::resize");
-			if (n > this->capacity())
-			{
-				while (n > new_cap)
-					new_cap *= 2;
-				this->reserve(new_cap);
-				this->insert(this->end(), n - this->size(), val);
-			}
-			else if (n > this->size())
+			if (n > this->size())
 				this->insert(this->end(), n - this->size(), val);
-			else if (n == this->size())
-				return ;
-			else
-			{
-				for (size_type i = _size - n; i > 0; i--)
-				{
-					_alloc.destroy(_end--);
-					_size--;
-				}
-			}
+			else if (n < this->size())
+				this->erase(this->begin() + n, this->end());
 		}
 
 		// Getter Capacity
@@ -169,37 +244,32 @@ namespace ft
 			return (_size == 0 ? true : false);
 		};
 
-		// Riserva spazio allocato per n elementi
+		/* Riserva spazio allocato per n elementi. Gli elementi vengono trasferiti nel nuovo buffer con
+		   relocate(): un solo memcpy per i tipi rilocabili, copia + distruzione degli originali altrimenti.
+		   Se una copia lancia un'eccezione il vettore resta com'era. */
 		void reserve(size_type n)
 		{
-			pointer	prev_begin;
-			pointer prev_end;
-			pointer	tmp_begin;
-			size_type	prev_capacity;
+			pointer	new_begin;
 
-			/* gestione errori */
 			if (_capacity >= n)
 				return ;
 			if (n > max_size())
 				throw std::length_error("ft::vector::reserve()");
 
-			prev_begin = _begin;
-			tmp_begin = prev_begin;
-			prev_end = _end;
-			prev_capacity = _capacity;
-
-			/* allocazione ed eventuale cambio indirizzo di memoria*/
-			_begin = _alloc.allocate(n);
-			_capacity = n;
-			_end = _begin;
-
-			while (prev_begin != prev_end) // parte a copiare gli elementi solo se esistevano già
+			new_begin = allocateBuffer(n);
+			try
 			{
-				_alloc.construct(_end++, *prev_begin); // inserisce nel punto _end il contenuto del punto prev_begin
-				prev_begin++;
+				relocate(_begin, _end, new_begin);
+			}
+			catch (...)
+			{
+				deallocateBuffer(new_begin, n);
+				throw ;
 			}
-			if (tmp_begin && tmp_begin != _begin) // elimina lo spazio predefinito e non più utilizzato
-				_alloc.deallocate(tmp_begin, prev_capacity);
+			deallocateBuffer(_begin, _capacity);
+			_begin = new_begin;
+			_end = _begin + _size;
+			_capacity = n;
 		};
 
 
@@ -261,22 +331,21 @@ namespace ft
 			this->insert(this->begin(), n, val);
 		};
 
-		// inserisce un elemento in ultima posizione
+		/* inserisce un elemento in ultima posizione. Il valore viene copiato prima di un'eventuale
+		   riallocazione, perché potrebbe essere un elemento del vettore stesso. */
 		void push_back (const value_type& val)
 		{
-			if (_size == _capacity && _capacity + 1 > this->max_size())
-				throw std::length_error("ft::vector::push_back");
-
 			if (_size == _capacity)
 			{
-				if (_capacity == 0)
-					this->reserve(1);
-				else
-					this->reserve(_capacity * 2);
+				value_type	copy(val);
+
+				this->grow(_size + 1);
+				_alloc.construct(_end, FT_MOVE(copy));
 			}
-			_alloc.construct(_end++, val);
+			else
+				_alloc.construct(_end, val);
+			_end++;
 			_size++;
-			return ;
 		};
 
 		void pop_back(void)
@@ -286,52 +355,87 @@ namespace ft
 			_size--;
 		}
 
-		/* inserisce un valore nel punto position */
-		iterator insert (iterator position, const value_type& val)
+#if __cplusplus >= 201103L
+		void push_back (value_type&& val)
+		{
+			this->emplace_back(std::move(val));
+		}
+
+		/* costruisce un elemento in ultima posizione a partire dagli argomenti. Se serve riallocare,
+		   l'elemento viene prima costruito a parte, perché gli argomenti potrebbero riferirsi al vettore. */
+		template <class... Args>
+		void emplace_back (Args&&... args)
 		{
-			size_type	dist = position - this->begin();
 			if (_size == _capacity)
 			{
-				if (_capacity == 0)
-					this->reserve(1);
-				else
-					this->reserve(_capacity * 2);
-				position = this->begin() + dist;
+				value_type	tmp(std::forward<Args>(args)...);
+
+				this->grow(_size + 1);
+				_alloc.construct(_end, std::move(tmp));
 			}
+			else
+				_alloc.construct(_end, std::forward<Args>(args)...);
 			_end++;
-			dist = _end - position.pointed() + 1;
-			size_type i = _size + 1;
-			while (dist--) // spostamento dei dati precedentemente inseriti
+			_size++;
+		}
+
+		iterator insert (iterator position, value_type&& val)
+		{
+			return (this->emplace(position, std::move(val)));
+		}
+
+		/* costruisce un elemento nel punto position a partire dagli argomenti */
+		template <class... Args>
+		iterator emplace (iterator position, Args&&... args)
+		{
+			size_type	dist = position - this->begin();
+
+			if (position == this->end())
 			{
-				_alloc.construct(_begin + i, _begin[i - 1]);
-				i--;
+				this->emplace_back(std::forward<Args>(args)...);
+				return (iterator(_begin + dist));
 			}
-			_alloc.construct(position.pointed(), val);
-			_size++;
-			return (position);
+
+			value_type	tmp(std::forward<Args>(args)...);
+
+			this->grow(_size + 1);
+			insertOne(_begin + dist, tmp);
+			return (iterator(_begin + dist));
+		}
+#endif
+
+		/* inserisce un valore nel punto position. Si lavora su una copia: val potrebbe essere
+		   un elemento del vettore stesso, spostato dalla riallocazione o dallo scorrimento della coda. */
+		iterator insert (iterator position, const value_type& val)
+		{
+			size_type	dist = position - this->begin();
+			value_type	copy(val);
+
+			this->grow(_size + 1);
+			insertOne(_begin + dist, copy);
+			return (iterator(_begin + dist));
 		};
 
 		/* inserisce n valori uguali consecutivi a partire da position */
 		void insert (iterator position, size_type n, const value_type& val)
 		{
 			size_type	dist = position - this->begin();
-			if (this->size() + n > _capacity)
-				this->reserve(this->size() + n);
-			position = this->begin() + dist;
-			size_type dist2 = ft::distance(position, this->end());
-			_end += n;
-			size_type i = 1;
-			while (dist2--) // spostamento dei dati precedentemente inseriti
-				_alloc.construct(_end - i++  , _begin[dist2 + dist]);
-			for (size_type j = 0; j < n; j++)
-				_alloc.construct(_begin + dist + j, val);
-			_size += n;
+
+			if (!n)
+				return ;
+
+			value_type	copy(val);
+
+			this->grow(_size + n);
+			insertFill(_begin + dist, n, copy);
 		};
 
 		/*
 			dati due iteratori dello stesso tipo,
 			inserisce i valori trovati dal punto first al punto last
 			nel punto position appartenente al vettore.
+			Per i tipi rilocabili la coda viene spostata con un solo memmove e i nuovi valori
+			costruiti nel buco; altrimenti si usa lo schema classico copia/assegnazione (vedi insertRange).
 		*/
 		template <class InputIterator>
 		void insert (iterator position, InputIterator first, InputIterator last,
@@ -343,86 +447,51 @@ namespace ft
 				throw ft::InvalidIteratorException<typename ft::is_ft_iterator_tagged<typename ft::iterator_traits<InputIterator>::iterator_category>::type>();
 
 			size_type	positionDist = position - this->begin();
-			size_type	finalSize = this->size() + ft::distance(first, last);
-			size_type	new_cap = this->capacity();
-			if (finalSize > this->capacity())
-			{
-				if (!this->capacity())
-					new_cap = 1;
-				while (finalSize > new_cap)
-					new_cap *= 2;
-				this->reserve(new_cap);
-			}
-			position = this->begin() + positionDist;
-			_end = _begin + _size;
-			size_type	toMove = ft::distance(position, this->end());
-			_end = _begin + finalSize;
-			_size = finalSize;
-			size_type	dist = ft::distance(first, last);
-
-			try
-			{
-				int i = 1;
-				while (toMove--)
-					_begin[_size - i++] = _begin[positionDist + toMove];
-				while (dist--)
-					_begin[positionDist++] = *first++;
-			}
-			catch (...)
-			{
-				_size = 0;
-				_capacity = 0;
-				throw ;
-			}
+			size_type	count = ft::distance(first, last);
 
+			if (!count)
+				return ;
+			this->grow(_size + count);
+			insertRange(_begin + positionDist, first, count);
 		};
 
 		/* elimina il valore nel punto position, spostando tutti gli altri elementi */
 		iterator erase (iterator position)
 		{
-			size_type	i = position - this->begin();
-			while (i + 1 < this->size())
-			{
-				_begin[i] = _begin[i + 1];
-				i++;
-			}
-			_alloc.destroy(_end--);
-			_size--;
-			return (position);
+			return (this->erase(position, position + 1));
 		};
 
-		/* elimina i valori dal punto first al punto last, spostando tutti gli altri elementi */
+		/* elimina i valori dal punto first al punto last, spostando tutti gli altri elementi.
+		   Per i tipi rilocabili gli elementi eliminati vengono distrutti e la coda scivola indietro con un memmove;
+		   altrimenti la coda viene assegnata sopra il buco e vengono distrutti gli ultimi elementi rimasti doppi. */
 		iterator erase (iterator first, iterator last)
 		{
-			if(last == this->end())
+			pointer		from = first.pointed();
+			pointer		to = last.pointed();
+			size_type	count = to - from;
+
+			if (!count)
+				return (first);
+			if (ft::is_relocatable<value_type>::value)
 			{
-				_size = first - _begin;
-				_end = _begin + _size;
-				size_type	dist = ft::distance(first, last);
-				size_type	i = last - _begin;
-				while(dist--)
-					_alloc.destroy(_begin + i--);
-				return (this->end());
+				destroyRange(from, to);
+				moveBytes(from, to, _end - to);
 			}
-			iterator	ret = first;
-			_size -= ft::distance(first, last);
-			while (last != this->end())
+			else
 			{
-					_alloc.construct(first.pointed(), *last++);
-					first++;
-			}
+				pointer	dst = from;
 
-			// pulizia ultimi elementi non utilizzati
-			_end = _begin + _size;
-			while (first != last)
-			{
-				_alloc.destroy(first.pointed());
-				first++;
+				for (pointer src = to; src != _end; ++src, ++dst)
+					*dst = FT_MOVE(*src);
+				destroyRange(dst, _end);
 			}
-			return (ret);
+			_end -= count;
+			_size -= count;
+			return (first);
 		}
 
-		// Scambia il contenuto e la lungezza del vettore con il vettore passato come parametro, utilizzando i puntatori
+		/* Scambia il contenuto e la lungezza del vettore con il vettore passato come parametro, utilizzando i puntatori.
+		   Se uno dei due usa lo spazio interno i puntatori non si possono scambiare: si passa da un temporaneo. */
 		void swap (vector& x)
 		{
 			pointer					tmpBegin = x._begin;
@@ -431,8 +500,16 @@ namespace ft
 			size_type				tmpSize = x._size;
 			allocator_type			tmpAlloc = x._alloc;
 
-			if (*this == x)
+			if (this == &x)
 				return ;
+			if (this->usesInline() || x.usesInline())
+			{
+				vector	tmp(FT_MOVE(x));
+
+				x = FT_MOVE(*this);
+				*this = FT_MOVE(tmp);
+				return ;
+			}
 
 			x._begin = this->_begin;
 			x._end = this->_end;
@@ -449,16 +526,25 @@ namespace ft
 		// Chiama il distruttore di ogni oggetto all' interno del vettore
 		void clear()
 		{
-			while(_size)
-			{
-				_alloc.destroy(_end);
-				_size--;
-				_end--;
-			}
+			destroyRange(_begin, _end);
+			_end = _begin;
+			_size = 0;
 		}
 
 		allocator_type	get_allocator() const { return (_alloc); };
 
+		/* Lo spazio interno di small_vector fa parte dell'oggetto: finché è in uso conta come payload e
+		   slack, quando gli elementi sono sull'heap resta inutilizzato e conta come slack. */
+		memory_footprint	memory_usage() const
+		{
+			std::size_t	inlineBytes = InlineCapacity * sizeof(value_type);
+			std::size_t	slack = (_capacity - _size) * sizeof(value_type);
+
+			if (InlineCapacity != 0 && !usesInline())
+				slack += inlineBytes;
+			return (memory_footprint(_size * sizeof(value_type), sizeof(*this) - inlineBytes, slack));
+		};
+
 
 		private:
 
@@ -467,62 +553,383 @@ namespace ft
 		size_type		_capacity; //dimensione massima che il vettore può raggiungere prima che sia necessario allocare più memoria
 		pointer			_begin; //puntatore all'inizio del vettore
 		pointer			_end; //puntatore alla fine del vettore
+
+		bool	usesInline() const
+		{
+			return (InlineCapacity != 0 && _begin == this->inlineData());
+		}
+
+		/* Restituisce un buffer per almeno n elementi: lo spazio interno se basta (e allora n diventa
+		   InlineCapacity), altrimenti memoria presa dall'allocatore. */
+		pointer	allocateBuffer(size_type& n)
+		{
+			if (n <= InlineCapacity)
+			{
+				n = InlineCapacity;
+				return (this->inlineData());
+			}
+			this->recordAllocate(n * sizeof(value_type));
+			return (_alloc.allocate(n));
+		}
+
+		void	deallocateBuffer(pointer p, size_type n)
+		{
+			if (p != NULL && p != this->inlineData())
+			{
+				this->recordDeallocate(n * sizeof(value_type));
+				_alloc.deallocate(p, n);
+			}
+		}
+
+#if __cplusplus >= 201103L
+		/* Prende il contenuto di other, lasciandolo vuoto; *this deve essere vuoto e sullo spazio interno. */
+		void	steal(vector& other)
+		{
+			if (other.usesInline())
+			{
+				relocate(other._begin, other._end, _begin);
+				_end = _begin + other._size;
+				_size = other._size;
+				other._end = other._begin;
+				other._size = 0;
+				return ;
+			}
+			_size = other._size;
+			_capacity = other._capacity;
+			_begin = other._begin;
+			_end = other._end;
+			other._size = 0;
+			other._capacity = InlineCapacity;
+			other._begin = other.inlineData();
+			other._end = other._begin;
+		}
+#endif
+
+		/* Porta la capacità ad almeno 'required' elementi, nella misura decisa dalla politica di crescita */
+		void	grow(size_type required)
+		{
+			size_type	next;
+
+			if (required <= _capacity)
+				return ;
+			if (required > max_size())
+				throw std::length_error("ft::vector::grow()");
+			next = Growth::next_capacity(_size, required, sizeof(value_type));
+			if (next > max_size())
+				next = max_size();
+			this->reserve(next);
+		}
+
+		/* Sposta i byte di 'count' elementi (le zone possono sovrapporsi). Solo per i tipi rilocabili. */
+		static void	moveBytes(pointer dst, pointer src, size_type count)
+		{
+			if (count)
+				std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(value_type));
+		}
+
+		void	destroyRange(pointer first, pointer last)
+		{
+			if (ft::is_trivially_copyable<value_type>::value)
+				return ;
+			for (; first != last; ++first)
+				_alloc.destroy(first);
+		}
+
+		/* Costruisce in memoria non inizializzata le copie di [first, last) a partire da dst e restituisce la fine.
+		   Se una copia lancia un'eccezione, quelle già costruite vengono distrutte. */
+		template <class InputIterator>
+		pointer	copyConstruct(InputIterator first, InputIterator last, pointer dst)
+		{
+			pointer	cur = dst;
+
+			try
+			{
+				for (; first != last; ++first, ++cur)
+					_alloc.construct(cur, *first);
+			}
+			catch (...)
+			{
+				destroyRange(dst, cur);
+				throw ;
+			}
+			return (cur);
+		}
+
+		/* Come sopra, ma copia 'count' valori a partire da first (l'iteratore può essere di sola andata). */
+		template <class InputIterator>
+		pointer	copyConstructN(InputIterator first, size_type count, pointer dst)
+		{
+			pointer	cur = dst;
+
+			try
+			{
+				for (; count; --count, ++cur, ++first)
+					_alloc.construct(cur, *first);
+			}
+			catch (...)
+			{
+				destroyRange(dst, cur);
+				throw ;
+			}
+			return (cur);
+		}
+
+		/* Come copyConstruct, ma con 'count' copie dello stesso valore. */
+		pointer	fillConstruct(pointer dst, size_type count, const value_type& val)
+		{
+			pointer	cur = dst;
+
+			try
+			{
+				for (; count; --count, ++cur)
+					_alloc.construct(cur, val);
+			}
+			catch (...)
+			{
+				destroyRange(dst, cur);
+				throw ;
+			}
+			return (cur);
+		}
+
+		/* Come copyConstruct, ma sposta gli elementi di [first, last) (in C++98 li copia). */
+		pointer	moveConstruct(pointer first, pointer last, pointer dst)
+		{
+			pointer	cur = dst;
+
+			try
+			{
+				for (; first != last; ++first, ++cur)
+					_alloc.construct(cur, FT_MOVE(*first));
+			}
+			catch (...)
+			{
+				destroyRange(dst, cur);
+				throw ;
+			}
+			return (cur);
+		}
+
+		/* Trasferisce [first, last) nella memoria non inizializzata 'dst' (che non si sovrappone), lasciando
+		   la zona di partenza non inizializzata. Per i tipi rilocabili è un solo memcpy.
+		   Gli altri vengono spostati solo se il loro costruttore di spostamento è noexcept, altrimenti
+		   copiati: se una copia lancia un'eccezione gli originali sono ancora intatti. */
+		void	relocate(pointer first, pointer last, pointer dst)
+		{
+			pointer	cur = dst;
+
+			if (ft::is_relocatable<value_type>::value)
+			{
+				if (first != last)
+					std::memcpy(static_cast<void*>(dst), static_cast<const void*>(first), (last - first) * sizeof(value_type));
+				return ;
+			}
+			try
+			{
+				for (pointer src = first; src != last; ++src, ++cur)
+					_alloc.construct(cur, FT_MOVE_IF_NOEXCEPT(*src));
+			}
+			catch (...)
+			{
+				destroyRange(dst, cur);
+				throw ;
+			}
+			destroyRange(first, last);
+		}
+
+		/* Inserisce in 'pos' il valore temporaneo 'tmp', spostandolo, con capacità già sufficiente.
+		   Usato dall'inserimento di un singolo elemento e da emplace. */
+		void	insertOne(pointer pos, value_type& tmp)
+		{
+			pointer	oldEnd = _end;
+
+			if (pos == _end)
+				_alloc.construct(_end, FT_MOVE(tmp));
+			else if (ft::is_relocatable<value_type>::value)
+			{
+				moveBytes(pos + 1, pos, _end - pos);
+				try
+				{
+					_alloc.construct(pos, FT_MOVE(tmp));
+				}
+				catch (...)
+				{
+					moveBytes(pos, pos + 1, _end - pos);
+					throw ;
+				}
+			}
+			else
+			{
+				_alloc.construct(_end, FT_MOVE(*(_end - 1)));
+				++_end;
+				++_size;
+				for (pointer dst = oldEnd - 1; dst != pos; --dst)
+					*dst = FT_MOVE(*(dst - 1));
+				*pos = FT_MOVE(tmp);
+				return ;
+			}
+			++_end;
+			++_size;
+		}
+
+		/* Inserisce 'count' copie di 'val' in 'pos', con capacità già sufficiente.
+		   Per i tipi rilocabili la coda scorre con un memmove e i valori vengono costruiti nel buco;
+		   altrimenti la parte della coda che finisce oltre la vecchia fine viene costruita lì
+		   e il resto viene assegnato, come fa la libreria standard. */
+		void	insertFill(pointer pos, size_type count, const value_type& val)
+		{
+			size_type	tail = _end - pos;
+			pointer		oldEnd = _end;
+
+			if (ft::is_relocatable<value_type>::value)
+			{
+				moveBytes(pos + count, pos, tail);
+				try
+				{
+					fillConstruct(pos, count, val);
+				}
+				catch (...)
+				{
+					moveBytes(pos, pos + count, tail);
+					throw ;
+				}
+				_end += count;
+				_size += count;
+			}
+			else if (tail > count)
+			{
+				_end = moveConstruct(oldEnd - count, oldEnd, oldEnd);
+				_size += count;
+				for (pointer src = oldEnd - count, dst = oldEnd; src != pos; )
+				{
+					--dst;
+					*dst = FT_MOVE(*--src);
+				}
+				for (pointer dst = pos; dst != pos + count; ++dst)
+					*dst = val;
+			}
+			else
+			{
+				_end = fillConstruct(oldEnd, count - tail, val);
+				try
+				{
+					_end = moveConstruct(pos, oldEnd, _end);
+				}
+				catch (...)
+				{
+					destroyRange(oldEnd, _end);
+					_end = oldEnd;
+					throw ;
+				}
+				_size += count;
+				for (pointer dst = pos; dst != oldEnd; ++dst)
+					*dst = val;
+			}
+		}
+
+		/* Inserisce i 'count' valori a partire da 'first' in 'pos', con capacità già sufficiente.
+		   Stesso schema di insertFill. */
+		template <class InputIterator>
+		void	insertRange(pointer pos, InputIterator first, size_type count)
+		{
+			size_type	tail = _end - pos;
+			pointer		oldEnd = _end;
+
+			if (ft::is_relocatable<value_type>::value)
+			{
+				moveBytes(pos + count, pos, tail);
+				try
+				{
+					copyConstructN(first, count, pos);
+				}
+				catch (...)
+				{
+					moveBytes(pos, pos + count, tail);
+					throw ;
+				}
+				_end += count;
+				_size += count;
+			}
+			else if (tail > count)
+			{
+				_end = moveConstruct(oldEnd - count, oldEnd, oldEnd);
+				_size += count;
+				for (pointer src = oldEnd - count, dst = oldEnd; src != pos; )
+				{
+					--dst;
+					*dst = FT_MOVE(*--src);
+				}
+				for (pointer dst = pos; dst != pos + count; ++dst, ++first)
+					*dst = *first;
+			}
+			else
+			{
+				InputIterator	mid = first;
+
+				for (size_type i = 0; i < tail; ++i)
+					++mid;
+				_end = copyConstructN(mid, count - tail, oldEnd);
+				try
+				{
+					_end = moveConstruct(pos, oldEnd, _end);
+				}
+				catch (...)
+				{
+					destroyRange(oldEnd, _end);
+					_end = oldEnd;
+					throw ;
+				}
+				_size += count;
+				for (pointer dst = pos; dst != oldEnd; ++dst, ++first)
+					*dst = *first;
+			}
+		}
 	};
 
 	// * OVERLOADS * //
 
-	template <class T, class Alloc>
-	bool operator==(const ft::vector<T, Alloc> &lhs, const ft::vector<T, Alloc> &rhs)
+	template <class T, class Alloc, class Growth, std::size_t N>
+	bool operator==(const ft::vector<T, Alloc, Growth, N> &lhs, const ft::vector<T, Alloc, Growth, N> &rhs)
 	{
 		if (lhs.size() != rhs.size())
 			return (false);
-
-		typename vector<T>::const_iterator	i = lhs.begin();
-		typename vector<T>::const_iterator	i2 = rhs.begin();
-		while (i != lhs.end())
-		{
-			if (i2 == rhs.end() || *i != *i2)
-				return (false);
-			i++;
-			i2++;
-		}
-		return (true);
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
 	}
 
-	template <class T, class Alloc>
-	bool operator!=(const ft::vector<T, Alloc> &lhs, const ft::vector<T, Alloc> &rhs)
+	template <class T, class Alloc, class Growth, std::size_t N>
+	bool operator!=(const ft::vector<T, Alloc, Growth, N> &lhs, const ft::vector<T, Alloc, Growth, N> &rhs)
 	{
 		return (!(lhs == rhs));
 	}
 
-	template <class T, class Alloc>
-	bool operator<(const ft::vector<T, Alloc> &lhs, const ft::vector<T, Alloc> &rhs)
+	template <class T, class Alloc, class Growth, std::size_t N>
+	bool operator<(const ft::vector<T, Alloc, Growth, N> &lhs, const ft::vector<T, Alloc, Growth, N> &rhs)
 	{
 		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
 	}
 
-	template <class T, class Alloc>
-	bool operator<=(const ft::vector<T, Alloc> &lhs, const ft::vector<T, Alloc> &rhs)
+	template <class T, class Alloc, class Growth, std::size_t N>
+	bool operator<=(const ft::vector<T, Alloc, Growth, N> &lhs, const ft::vector<T, Alloc, Growth, N> &rhs)
 	{
 		return (!(lhs > rhs));
 	}
 
-	template <class T, class Alloc>
-	bool operator>(const ft::vector<T, Alloc> &lhs, const ft::vector<T, Alloc> &rhs)
+	template <class T, class Alloc, class Growth, std::size_t N>
+	bool operator>(const ft::vector<T, Alloc, Growth, N> &lhs, const ft::vector<T, Alloc, Growth, N> &rhs)
 	{
 		return (!(lhs == rhs || lhs < rhs));
 	}
 
-	template <class T, class Alloc>
-	bool operator>=(const ft::vector<T, Alloc> &lhs, const ft::vector<T, Alloc> &rhs)
+	template <class T, class Alloc, class Growth, std::size_t N>
+	bool operator>=(const ft::vector<T, Alloc, Growth, N> &lhs, const ft::vector<T, Alloc, Growth, N> &rhs)
 	{
 		return (!(lhs < rhs));
 	}
 }
 namespace std
 {
-	template <class T, class Alloc>
-	void	swap(ft::vector<T, Alloc>& x, ft::vector<T, Alloc>& y)
+	template <class T, class Alloc, class Growth, std::size_t N>
+	void	swap(ft::vector<T, Alloc, Growth, N>& x, ft::vector<T, Alloc, Growth, N>& y)
 	{
 		x.swap(y);
 	}